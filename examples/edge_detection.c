@@ -30,11 +30,11 @@
  * @param show_values If true, show actual values; if false, show edge map
  */
 static void print_matrix(const fx_matrix_t* mat, const char* label, int show_values) {
-    printf("%s (%d×%d):\n", label, mat->rows, mat->cols);
+    printf("%s (%u×%u):\n", label, (unsigned)mat->rows, (unsigned)mat->cols);
 
-    for (uint16_t r = 0; r < mat->rows; r++) {
+    for (uint32_t r = 0; r < mat->rows; r++) {
         printf("  ");
-        for (uint16_t c = 0; c < mat->cols; c++) {
+        for (uint32_t c = 0; c < mat->cols; c++) {
             fixed_t val = mat->data[r * mat->cols + c];
 
             if (show_values) {
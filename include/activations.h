@@ -21,10 +21,42 @@
 
 #include "matrix.h"
 
+/**
+ * @brief Built-in activation functions.
+ *
+ * @details Used by fused layer kernels (e.g. fx_dense_forward()) so the
+ * activation can be applied in-register before the single store.
+ */
+typedef enum {
+    FX_ACT_IDENTITY = 0,         /**< f(x) = x */
+    FX_ACT_RELU,                 /**< f(x) = max(0, x) */
+    FX_ACT_LEAKY_RELU,           /**< f(x) = x > 0 ? x : alpha * x */
+    FX_ACT_RELU6,                /**< f(x) = min(max(0, x), 6) */
+    FX_ACT_CLAMP,                /**< f(x) = min(max(lo, x), hi) */
+    FX_ACT_SIGMOID,              /**< f(x) = 1 / (1 + e^-x), table-driven */
+    FX_ACT_TANH,                 /**< f(x) = tanh(x), table-driven */
+    FX_ACT_EXP                   /**< f(x) = e^x, table-driven, saturating */
+} fx_activation_kind_t;
+
+/** @brief Upper bound of ReLU6 (6.0 in Q16.16) */
+#define FX_RELU6_MAX (6 * FIXED_ONE)
+
+/**
+ * @brief Activation selection with its parameters.
+ */
+typedef struct {
+    fx_activation_kind_t kind;   /**< Which activation to apply */
+    fixed_t alpha;               /**< Negative slope (FX_ACT_LEAKY_RELU only) */
+    fixed_t lo;                  /**< Lower bound (FX_ACT_CLAMP only) */
+    fixed_t hi;                  /**< Upper bound (FX_ACT_CLAMP only, >= lo) */
+} fx_activation_t;
+
 /**
  * @brief Rectified Linear Unit (ReLU) activation function.
  *
- * @details Implements f(x) = max(0, x) in-place on matrix.
+ * @details Implements f(x) = max(0, x) in-place on matrix, branch-free
+ * (packed signed max on SSE4.1/AVX2, mask select in the scalar kernel), so
+ * execution time does not depend on the data (SRS-007).
  * Most common activation in safety-critical neural networks due to:
  * - Simple implementation (one comparison per element)
  * - Bit-perfect determinism across all platforms
@@ -52,6 +84,9 @@ void fx_relu(fx_matrix_t* mat);
  *
  * Typical alpha: 0.01 (allows 1% gradient for negative values)
  *
+ * Branch-free: every element is multiplied (widening multiply on SIMD
+ * levels) and the product is selected by the sign mask.
+ *
  * @param[in,out] mat Matrix to apply Leaky ReLU to (modified in-place)
  * @param[in] alpha Slope for negative values (typically 0.01)
  *
@@ -66,6 +101,173 @@ void fx_relu(fx_matrix_t* mat);
  */
 void fx_leaky_relu(fx_matrix_t* mat, fixed_t alpha);
 
+/**
+ * @brief ReLU6: f(x) = min(max(0, x), 6).
+ *
+ * @details Bounded activation used by mobile architectures; a clamp to
+ * [0, FX_RELU6_MAX], branch-free like fx_relu().
+ *
+ * @param[in,out] mat Matrix to transform in place
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect, data-independent timing
+ *
+ * @traceability SRS-004.10
+ */
+void fx_relu6(fx_matrix_t* mat);
+
+/**
+ * @brief Clamp every element to [lo, hi].
+ *
+ * @param[in,out] mat Matrix to transform in place
+ * @param[in] lo Lower bound
+ * @param[in] hi Upper bound
+ *
+ * @pre lo <= hi (otherwise mat is left unchanged)
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect, data-independent timing
+ *
+ * @traceability SRS-004.10
+ */
+void fx_clamp(fx_matrix_t* mat, fixed_t lo, fixed_t hi);
+
+/**
+ * @brief Logistic sigmoid applied element-wise.
+ *
+ * @details Each element is fixed_sigmoid(x): table lookup plus one integer
+ * interpolation, no libm call and no floating point.
+ *
+ * @param[in,out] mat Matrix to transform in place
+ *
+ * @post |mat->data[i] - sigmoid(original)| <= 1 LSB
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.11
+ */
+void fx_sigmoid(fx_matrix_t* mat);
+
+/**
+ * @brief Hyperbolic tangent applied element-wise (fixed_tanh()).
+ *
+ * @param[in,out] mat Matrix to transform in place
+ *
+ * @post |mat->data[i] - tanh(original)| <= 1 LSB
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.11
+ */
+void fx_tanh(fx_matrix_t* mat);
+
+/**
+ * @brief Exponential applied element-wise (fixed_exp()), saturating.
+ *
+ * @param[in,out] mat Matrix to transform in place
+ *
+ * @post mat->data[i] = fixed_exp(original)
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.11
+ */
+void fx_exp(fx_matrix_t* mat);
+
+/**
+ * @brief Row-wise softmax, in place.
+ *
+ * @details For each row: m = max(x), e_i = e^(x_i - m) from the exp table
+ * in Q.24 (8 guard bits), S = Σ e_i in int64_t, then one reciprocal
+ * R = round(2^56 / S) and y_i = round(e_i · R / 2^40); no fixed_div per
+ * element and no floating point. Subtracting the maximum keeps every
+ * exponent <= 0, so nothing overflows and adding a constant to a row
+ * leaves its output bit-identical.
+ *
+ * This makes three traversals of each row (max, exp/sum, normalize), not
+ * one fused pass. Every e_i must be taken against the final maximum to be
+ * bit-exact: an online running maximum would rescale the partial sum by
+ * e^(m_old − m_new) in Q.24, adding a rounding at every new maximum and
+ * making the result depend on element order, and restarting the sum on a
+ * new maximum makes the worst case O(cols²). All three traversals finish
+ * one row before the next starts, so rows that fit in cache are read from
+ * memory once; larger rows (big vocabulary heads) stream three times.
+ *
+ * @param[in,out] mat Logits, one distribution per row (modified in-place)
+ *
+ * @post Each row is in [0, FIXED_ONE], summing to FIXED_ONE within cols LSB
+ * @post |y_i - softmax(x)_i| <= 1 LSB
+ *
+ * @complexity O(rows * cols), one 64-bit division per row
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.6
+ */
+void fx_softmax(fx_matrix_t* mat);
+
+/**
+ * @brief Row-wise log-softmax, in place: y_i = x_i - m - ln(Σ e^(x_j - m)).
+ *
+ * @details Same max-subtraction and int64_t sum as fx_softmax(), with the
+ * same three traversals per row for the same reason; the log-sum-exp is
+ * evaluated once per row from a log2 table, so the output does not lose
+ * the resolution of small probabilities. Results below FIXED_MIN saturate.
+ *
+ * @param[in,out] mat Logits, one distribution per row (modified in-place)
+ *
+ * @post |y_i - log_softmax(x)_i| <= 1 LSB
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.6
+ */
+void fx_log_softmax(fx_matrix_t* mat);
+
+/**
+ * @brief Apply an activation in place to a run of values.
+ *
+ * @details Shared by the fused layer kernels (dense, depthwise-separable)
+ * so an activation is applied to freshly rounded values before they are
+ * stored. The kind is switched on once per call, not per element, and
+ * runs the dispatched branch-free kernel. Arithmetic matches fx_relu(),
+ * fx_leaky_relu(), fx_relu6(), fx_clamp(), fx_sigmoid() and fx_tanh()
+ * exactly; a clamp with lo > hi leaves data unchanged.
+ *
+ * @param[in] act Activation, or NULL for identity
+ * @param[in,out] data Values to transform
+ * @param[in] n Number of values
+ *
+ * @complexity O(n)
+ * @determinism Bit-perfect, identical to the matrix functions
+ *
+ * @traceability SRS-004.2, SRS-004.9, SRS-004.10, SRS-004.11
+ */
+void fx_activation_apply(const fx_activation_t* act, fixed_t* data, size_t n);
+
+/**
+ * @brief Apply a built-in activation to every element of a matrix.
+ *
+ * @details Enum-driven counterpart of fx_matrix_apply(): the kind is
+ * resolved once and the matching loop (SIMD clamp/leaky kernel, or the
+ * table evaluator inlined into its loop) runs over the whole matrix, with
+ * no indirect call per element. Results are identical to the dedicated
+ * functions (fx_relu(), fx_sigmoid(), ...). Use fx_matrix_apply() only for
+ * custom element functions.
+ *
+ * @param[in,out] mat Matrix to modify in-place
+ * @param[in] act Activation, or NULL for identity
+ *
+ * @complexity O(rows * cols)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.12, SRS-007.3
+ */
+void fx_matrix_apply_activation(fx_matrix_t* mat, const fx_activation_t* act);
+
 /**
  * @brief Identity activation (no operation).
  *
@@ -20,6 +20,39 @@
 #define CONVOLUTION_H
 
 #include "matrix.h"
+#include "tensor.h"
+#include "activations.h"
+
+/**
+ * @brief Convolution filter bank (C_out × C_in × KH × KW).
+ *
+ * @details The layout follows the feature maps it is applied to:
+ * - FX_LAYOUT_NCHW: OIHW, w[o][i][ky][kx]
+ * - FX_LAYOUT_NHWC: OHWI, w[o][ky][kx][i]
+ *
+ * @note Memory managed by caller - no dynamic allocation.
+ */
+typedef struct {
+    fixed_t* data;               /**< Pointer to pre-allocated weights */
+    uint32_t out_channels;       /**< C_out */
+    uint32_t in_channels;        /**< C_in */
+    uint32_t rows;               /**< Kernel height (KH) */
+    uint32_t cols;               /**< Kernel width (KW) */
+    fx_layout_t layout;          /**< OIHW (NCHW) or OHWI (NHWC) */
+} fx_conv_filter_t;
+
+/**
+ * @brief Element offset of w[o][i][ky][kx] for the filter's layout.
+ *
+ * @complexity O(1)
+ */
+static inline size_t fx_filter_index(const fx_conv_filter_t* f, size_t o,
+                                     size_t i, size_t ky, size_t kx) {
+    if (f->layout == FX_LAYOUT_NHWC) {
+        return ((o * f->rows + ky) * f->cols + kx) * f->in_channels + i;
+    }
+    return ((o * f->in_channels + i) * f->rows + ky) * f->cols + kx;
+}
 
 /**
  * @brief Deterministic 2D Convolution with valid padding.
@@ -75,4 +108,483 @@
  */
 void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out);
 
+/**
+ * @brief Multi-channel 2D convolution with valid padding.
+ *
+ * @details For each output channel o and position (y, x):
+ *   out[o][y][x] = round( bias[o] + Σ(i,ky,kx) in[i][y+ky][x+kx] × w[o][i][ky][kx] )
+ *
+ * All C_in × KH × KW products are accumulated in one int64_t accumulator and
+ * rounded once, so the result is exact up to a single Q16.16 rounding step,
+ * unlike C_in separate fx_conv2d() calls whose partial sums are each rounded.
+ * Because the accumulation is exact, NCHW and NHWC produce identical values.
+ *
+ * - NCHW: each output row is accumulated as a tile of int64_t lanes, reading
+ *   input rows with unit stride.
+ * - NHWC: for each kernel row, KW × C_in contiguous inputs are reduced with
+ *   the dispatched dot kernel (SRS-003.10).
+ *
+ * @param[in] in Input (C_in × H × W)
+ * @param[in] filter Filter bank, same layout as in
+ * @param[in] bias Bias row vector (1 × C_out), or NULL
+ * @param[out] out Output (C_out × (H-KH+1) × (W-KW+1)), same layout as in
+ *
+ * @pre in, filter and out share one layout
+ * @pre filter->in_channels == in->channels, out->channels == filter->out_channels
+ * @pre out does not overlap in or filter
+ * @post out contains the convolution if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(C_out × OH × OW × C_in × KH × KW) time, O(1) space
+ * @determinism Bit-perfect, identical across layouts and kernel levels
+ *
+ * @traceability SRS-006.3, SRS-006.4, SRS-006.8
+ */
+void fx_conv2d_tensor(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                      const fx_matrix_t* bias, fx_tensor_t* out);
+
+/**
+ * @brief Fused convolution → bias → activation → 2×2 stride-2 max-pool.
+ *
+ * @details Bit-identical to
+ *   fx_conv2d_tensor(in, filter, bias, conv);
+ *   fx_activation_apply(act, conv);
+ *   fx_maxpool_2x2(conv, out);   (per channel)
+ * but the full-resolution conv tensor is never written. Rounding and every
+ * accepted activation are monotone non-decreasing, so they commute with
+ * max: each 2×2 group of exact accumulators is reduced first, then rounded
+ * and activated once per pooled value.
+ *
+ * @param[in] in Input (C_in × H × W)
+ * @param[in] filter Filter bank, same layout as in
+ * @param[in] bias Bias row vector (1 × C_out), or NULL
+ * @param[in] act Activation (identity, ReLU, ReLU6, clamp, sigmoid, tanh, or
+ *                leaky ReLU with 0 <= alpha <= 1), or NULL
+ * @param[out] out Pooled output (C_out × (H-KH+1)/2 × (W-KW+1)/2), same layout as in
+ *
+ * @pre H-KH+1 and W-KW+1 are even (as required by fx_maxpool_2x2())
+ * @post out contains the pooled result if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(C_out × OH × OW × C_in × KH × KW) time, O(1) space
+ * @determinism Bit-perfect, identical to the unfused sequence
+ *
+ * @traceability SRS-006.18, SRS-008.1
+ */
+void fx_conv2d_act_maxpool(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                           const fx_matrix_t* bias, const fx_activation_t* act,
+                           fx_tensor_t* out);
+
+/**
+ * @brief Scratch elements needed by fx_conv2d_im2col().
+ *
+ * One lowered patch of C_in × KH × KW values per output position.
+ */
+#define FX_IM2COL_SCRATCH_LEN(c_in, k_h, k_w, out_h, out_w) \
+    ((size_t)(c_in) * (k_h) * (k_w) * (out_h) * (out_w))
+
+/**
+ * @brief Multi-channel convolution lowered to GEMM (im2col).
+ *
+ * @details Copies every receptive field into a column matrix in caller
+ * scratch, then multiplies:
+ * - NCHW: the OIHW filter bank is already a C_out × (C_in·KH·KW) row-major
+ *   matrix and the NCHW output a C_out × (OH·OW) matrix, so
+ *   out = W × col is one fx_matrix_mul() call (SRS-003.9/.10 kernels).
+ * - NHWC: each lowered row holds one (KH, KW, C_in) patch in OHWI order,
+ *   so out[p][o] is a contiguous dot product of patch p with filter o.
+ *
+ * Same products, exact int64_t accumulation and single rounding as
+ * fx_conv2d_tensor(), so the outputs are bit-identical to it (and to
+ * fx_conv2d() for one channel). In NCHW the bias is added after the GEMM
+ * rounding, which is exact because bias << 16 is a multiple of the rounding
+ * unit.
+ *
+ * @param[in] in Input (C_in × H × W)
+ * @param[in] filter Filter bank, same layout as in
+ * @param[in] bias Bias row vector (1 × C_out), or NULL
+ * @param[out] out Output (C_out × (H-KH+1) × (W-KW+1)), same layout as in
+ * @param[out] scratch Lowering buffer
+ * @param[in] scratch_len Number of fixed_t elements in scratch
+ *
+ * @pre Same shape requirements as fx_conv2d_tensor()
+ * @pre scratch_len >= FX_IM2COL_SCRATCH_LEN(C_in, KH, KW, OH, OW)
+ * @pre scratch does not overlap in, filter or out
+ * @post out contains the convolution if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(C_out × OH × OW × C_in × KH × KW) time, O(1) extra stack
+ * @determinism Bit-perfect, identical to fx_conv2d_tensor()
+ *
+ * @traceability SRS-006.3, SRS-006.4, SRS-006.11
+ */
+void fx_conv2d_im2col(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                      const fx_matrix_t* bias, fx_tensor_t* out,
+                      fixed_t* scratch, size_t scratch_len);
+
+/**
+ * @brief im2col convolution over a filter bank packed at load time.
+ *
+ * @details Each output position is lowered into one row of C_in × KH × KW
+ * values in the input's layout order (OIHW order for NCHW, OHWI for NHWC),
+ * and the rows are multiplied by the packed filters with the
+ * register-blocked micro-kernel (fx_matrix_mul_packed()). The filter bank,
+ * viewed as a C_out × (C_in·KH·KW) matrix, is packed once by
+ * fx_pack_weights_transposed(). NHWC results are stored row by row; NCHW
+ * results are scattered into the output planes.
+ *
+ * The bias starts each accumulator, so the outputs are bit-identical to
+ * fx_conv2d_tensor() and fx_conv2d_im2col() with the unpacked filter.
+ *
+ * @param[in] in Input (C_in × H × W)
+ * @param[in] filter Packed filters (rows = C_in·KH·KW, cols = C_out)
+ * @param[in] k_h Kernel height
+ * @param[in] k_w Kernel width
+ * @param[in] bias Bias row vector (1 × C_out), or NULL
+ * @param[out] out Output (C_out × (H-KH+1) × (W-KW+1)), same layout as in
+ * @param[out] scratch Lowering buffer
+ * @param[in] scratch_len Number of fixed_t elements in scratch
+ *
+ * @pre scratch_len >= FX_IM2COL_SCRATCH_LEN(C_in, KH, KW, OH, OW)
+ * @pre scratch does not overlap in, filter or out
+ * @post out contains the convolution if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(C_out × OH × OW × C_in × KH × KW) time, O(1) extra stack
+ * @determinism Bit-perfect, identical to fx_conv2d_tensor()
+ *
+ * @traceability SRS-003.13, SRS-006.3, SRS-006.4, SRS-006.11
+ */
+void fx_conv2d_im2col_packed(const fx_tensor_t* in, const fx_packed_weights_t* filter,
+                             uint32_t k_h, uint32_t k_w, const fx_matrix_t* bias,
+                             fx_tensor_t* out, fixed_t* scratch, size_t scratch_len);
+
+/**
+ * @brief Stride, dilation and implicit zero padding for convolution.
+ *
+ * @details Padding is never materialized: taps that fall outside the input
+ * are skipped, which equals multiplying by a zero border exactly.
+ */
+typedef struct {
+    uint32_t stride_h;           /**< Vertical stride (>= 1) */
+    uint32_t stride_w;           /**< Horizontal stride (>= 1) */
+    uint32_t dilation_h;         /**< Vertical tap spacing (>= 1) */
+    uint32_t dilation_w;         /**< Horizontal tap spacing (>= 1) */
+    uint32_t pad_top;            /**< Zero rows above the input */
+    uint32_t pad_bottom;         /**< Zero rows below the input */
+    uint32_t pad_left;           /**< Zero columns left of the input */
+    uint32_t pad_right;          /**< Zero columns right of the input */
+} fx_conv_params_t;
+
+/** @brief Stride 1, no dilation, no padding (same as fx_conv2d) */
+#define FX_CONV_PARAMS_VALID {1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u}
+
+/**
+ * @brief Output extent along one axis.
+ *
+ * @details out = (in + pad_before + pad_after − dilation·(k − 1) − 1) / stride + 1
+ *
+ * @return Output size, or 0 if the dilated kernel does not fit or stride,
+ *         dilation or k is zero
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-006.7, SRS-006.9, SRS-006.10
+ */
+uint32_t fx_conv_output_dim(uint32_t in, uint32_t k, uint32_t stride,
+                            uint32_t dilation, uint32_t pad_before,
+                            uint32_t pad_after);
+
+/**
+ * @brief Single-plane convolution with stride, dilation and padding.
+ *
+ * @details out[y][x] = round( Σ(ky,kx) in[y·sh − pt + ky·dh][x·sw − pl + kx·dw] × k[ky][kx] )
+ * with out-of-range input positions contributing zero.
+ *
+ * The output is split into an interior region, where every tap is in
+ * bounds and no checks are made, and the border rows/columns, where the
+ * valid tap range is clipped once per output. With FX_CONV_PARAMS_VALID the
+ * result is bit-identical to fx_conv2d(); with padding it is bit-identical
+ * to fx_conv2d() on an explicitly zero-padded copy.
+ *
+ * @param[in] in Input feature map (H×W)
+ * @param[in] kernel Convolution kernel (KH×KW)
+ * @param[in] params Stride, dilation and padding
+ * @param[out] out Output (fx_conv_output_dim() along each axis)
+ *
+ * @pre out dimensions match fx_conv_output_dim() for both axes
+ * @post out contains the convolution if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(OH × OW × KH × KW) time, O(1) space
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-006.3, SRS-006.4, SRS-006.7, SRS-006.9, SRS-006.10
+ */
+void fx_conv2d_ex(const fx_matrix_t* in, const fx_matrix_t* kernel,
+                  const fx_conv_params_t* params, fx_matrix_t* out);
+
+/**
+ * @brief Multi-channel convolution with stride, dilation and padding.
+ *
+ * @details fx_conv2d_tensor() generalized with @p params; same single
+ * int64_t accumulation over all channels and taps, same interior/border
+ * split as fx_conv2d_ex(). NCHW and NHWC give identical bits.
+ *
+ * @param[in] in Input (C_in × H × W)
+ * @param[in] filter Filter bank, same layout as in
+ * @param[in] bias Bias row vector (1 × C_out), or NULL
+ * @param[in] params Stride, dilation and padding
+ * @param[out] out Output (C_out × OH × OW), same layout as in
+ *
+ * @pre out->rows/cols match fx_conv_output_dim() for both axes
+ * @post out contains the convolution if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(C_out × OH × OW × C_in × KH × KW) time, O(1) space
+ * @determinism Bit-perfect, identical across layouts
+ *
+ * @traceability SRS-006.7, SRS-006.8, SRS-006.9, SRS-006.10
+ */
+void fx_conv2d_tensor_ex(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                         const fx_matrix_t* bias, const fx_conv_params_t* params,
+                         fx_tensor_t* out);
+
+/**
+ * @brief Depthwise convolution: one KH × KW kernel per channel.
+ *
+ * @details out[c][y][x] = round( bias[c] + Σ(ky,kx) in[c][iy][ix] × w[c][ky][kx] )
+ * with the stride/dilation/padding conventions of fx_conv2d_tensor_ex().
+ * The filter bank has out_channels == C and in_channels == 1, so its
+ * storage is [c][ky][kx] in either layout. Border handling follows the
+ * interior/edge split of SRS-006.7.
+ *
+ * @param[in] in Input (C × H × W)
+ * @param[in] filter Depthwise filters (C × 1 × KH × KW), same layout as in
+ * @param[in] bias Bias row vector (1 × C), or NULL
+ * @param[in] params Stride, dilation and padding
+ * @param[out] out Output (C × OH × OW), same layout as in
+ *
+ * @pre out->rows/cols match fx_conv_output_dim() for both axes
+ * @post out contains the convolution if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(C × OH × OW × KH × KW) time, O(1) space
+ * @determinism Bit-perfect, identical across layouts
+ *
+ * @traceability SRS-006.3, SRS-006.4, SRS-006.12
+ */
+void fx_conv2d_depthwise(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                         const fx_matrix_t* bias, const fx_conv_params_t* params,
+                         fx_tensor_t* out);
+
+/**
+ * @brief Depthwise-separable block: depthwise → activation → 1×1 pointwise → activation.
+ */
+typedef struct {
+    const fx_conv_filter_t* dw_filter;   /**< C × 1 × KH × KW */
+    const fx_matrix_t* dw_bias;          /**< 1 × C, or NULL */
+    const fx_activation_t* dw_act;       /**< After depthwise, or NULL */
+    const fx_conv_filter_t* pw_filter;   /**< C_out × C × 1 × 1 */
+    const fx_matrix_t* pw_bias;          /**< 1 × C_out, or NULL */
+    const fx_activation_t* pw_act;       /**< After pointwise, or NULL */
+} fx_dwsep_layer_t;
+
+/** @brief Scratch elements for fx_conv2d_dwsep(): one depthwise output row */
+#define FX_DWSEP_SCRATCH_LEN(channels, out_w) ((size_t)(channels) * (out_w))
+
+/**
+ * @brief Fused depthwise-separable convolution.
+ *
+ * @details Produces one output row at a time: the depthwise row (C × OW)
+ * is computed into @p scratch, rounded and activated exactly as a separate
+ * layer would store it, then immediately projected by the 1×1 filters while
+ * still in cache. The C × OH × OW intermediate tensor is never written.
+ *
+ * Bit-identical to
+ *   fx_conv2d_depthwise(in, dw, dw_bias, params, mid);
+ *   fx_activation_apply(dw_act, mid);
+ *   fx_conv2d_tensor(mid, pw, pw_bias, out);
+ *   fx_activation_apply(pw_act, out);
+ *
+ * @param[in] in Input (C × H × W)
+ * @param[in] layer Weights, biases and activations
+ * @param[in] params Depthwise stride, dilation and padding
+ * @param[out] out Output (C_out × OH × OW), same layout as in
+ * @param[out] scratch Row buffer
+ * @param[in] scratch_len Elements in scratch, >= FX_DWSEP_SCRATCH_LEN(C, OW)
+ *
+ * @pre All filters share the layout of in and out
+ * @post out contains the block output if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(OH × OW × C × (KH × KW + C_out)) time, O(C × OW) scratch
+ * @determinism Bit-perfect, identical to the unfused sequence
+ *
+ * @traceability SRS-006.12, SRS-006.13
+ */
+void fx_conv2d_dwsep(const fx_tensor_t* in, const fx_dwsep_layer_t* layer,
+                     const fx_conv_params_t* params, fx_tensor_t* out,
+                     fixed_t* scratch, size_t scratch_len);
+
+/** @brief Scratch elements (int64_t) for fx_conv2d_separable(): one input row */
+#define FX_SEPARABLE_SCRATCH_LEN(in_w) ((size_t)(in_w))
+
+/** @brief Largest supported extra intermediate precision (exact Q32.32) */
+#define FX_SEPARABLE_MAX_INTER_BITS 16u
+
+/**
+ * @brief Separable (rank-1) convolution with valid padding.
+ *
+ * @details For a kernel k[ky][kx] = v[ky] × h[kx], runs a vertical 1-D pass
+ * with v followed by a horizontal 1-D pass with h, at KH + KW instead of
+ * KH × KW MACs per output.
+ *
+ * The vertical sum (exact Q32.32) is kept in int64_t scratch, rounded to
+ * Q(16 + inter_frac_bits); the horizontal sum is exact and rounded once to
+ * Q16.16. When the vertical pass loses nothing in that rounding, i.e. every
+ * v[ky] is a multiple of 2^-inter_frac_bits, and every v[ky] × h[kx] is
+ * exactly representable in Q16.16, the result is bit-identical to
+ * fx_conv2d() with the 2-D kernel v × h:
+ * - inter_frac_bits = 0: integer-valued v (Sobel [1 2 1], box filters)
+ * - inter_frac_bits = 16: any v
+ * Otherwise the intermediate rounding adds at most ½·2^-(16+G)·Σ|h| before
+ * the final rounding.
+ *
+ * Both passes accumulate in int64_t. Before any work the input is scanned
+ * once for max|in|, and the call is rejected unless the worst-case sums
+ * fit: Σ|v| · max|in| < 2^63 for the vertical pass and
+ * (Σ|v| · max|in| / 2^(16-G) + 1) · Σ|h| < 2^63 for the horizontal one
+ * (raw Q16.16 magnitudes). With G = 16 and unit taps this limits the input
+ * to roughly |in| < 2^31 / (KH · KW) in raw units.
+ *
+ * @param[in] in Input feature map (H×W)
+ * @param[in] col_kernel Vertical factor v (KH×1)
+ * @param[in] row_kernel Horizontal factor h (1×KW)
+ * @param[in] inter_frac_bits Extra intermediate fraction bits G, 0..16
+ * @param[out] out Output ((H-KH+1)×(W-KW+1))
+ * @param[out] scratch One int64_t row of vertical sums
+ * @param[in] scratch_len Elements in scratch, >= FX_SEPARABLE_SCRATCH_LEN(W)
+ *
+ * @pre Σ|v| · max|in| < 2^63 and (Σ|v| · max|in| / 2^(16-G) + 1) · Σ|h| < 2^63
+ *      (raw Q16.16 magnitudes), checked at run time
+ * @post out contains the convolution if all shapes are valid and the bound
+ *       holds, unchanged otherwise
+ *
+ * @complexity O(H × W + OH × W × KH + OH × OW × KW) time, O(W) scratch
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-006.3, SRS-006.14
+ */
+void fx_conv2d_separable(const fx_matrix_t* in, const fx_matrix_t* col_kernel,
+                         const fx_matrix_t* row_kernel, uint32_t inter_frac_bits,
+                         fx_matrix_t* out, int64_t* scratch, size_t scratch_len);
+
+/**
+ * @brief Winograd-domain 3×3 filter bank (C_out × C_in tiles of 4×4).
+ *
+ * @details Holds U' = G' g G'ᵀ with G' = 2G, the F(2×2,3×3) filter
+ * transform with its ½ factors multiplied out, so every entry is an exact
+ * integer combination of Q16.16 weights (|U'| < 2^37).
+ */
+typedef struct {
+    int64_t* data;               /**< Caller buffer, FX_WINOGRAD_FILTER_LEN */
+    uint32_t out_channels;       /**< C_out (0 if not initialized) */
+    uint32_t in_channels;        /**< C_in */
+} fx_winograd_filter_t;
+
+/** @brief int64_t elements for a transformed C_out × C_in filter bank */
+#define FX_WINOGRAD_FILTER_LEN(c_out, c_in) ((size_t)(c_out) * (c_in) * 16u)
+
+/** @brief int64_t scratch elements for fx_conv2d_winograd() */
+#define FX_WINOGRAD_SCRATCH_LEN(c_in) ((size_t)(c_in) * 16u)
+
+/**
+ * @brief Transform a 3×3 filter bank into the Winograd domain (once per model).
+ *
+ * @param[out] wf Transformed filter; dimensions set only on success
+ * @param[in] buffer Storage for wf->data
+ * @param[in] buffer_len Elements in buffer, >= FX_WINOGRAD_FILTER_LEN(C_out, C_in)
+ * @param[in] filter 3×3 filter bank (any layout)
+ *
+ * @post wf->out_channels == 0 if filter is not 3×3 or buffer is too small
+ *
+ * @complexity O(C_out × C_in)
+ *
+ * @traceability SRS-006.15
+ */
+void fx_winograd_filter_init(fx_winograd_filter_t* wf, int64_t* buffer,
+                             size_t buffer_len, const fx_conv_filter_t* filter);
+
+/**
+ * @brief 3×3 valid convolution via integer Winograd F(2×2,3×3).
+ *
+ * @details Each 2×2 output tile costs 16 multiplies per channel pair
+ * instead of 36. All transforms use integer matrices (B, A unchanged,
+ * G' = 2G), so the tile result is 4·Y where Y is the exact Q32.32 sum the
+ * direct convolution forms. Products can exceed 64 bits, so the element-wise
+ * stage and both transforms run in uint64_t arithmetic modulo 2^64; since
+ * that is a ring homomorphism, 4·Y is recovered exactly whenever
+ * |Y| < 2^61, and Y = (4·Y) >> 2 is then rounded once exactly like
+ * fx_conv2d_tensor(). For an odd output height or width the last tile reads
+ * zeros past the input edge; they only reach outputs that are not stored.
+ *
+ * @param[in] in Input (C_in × H × W)
+ * @param[in] wf Transformed filters from fx_winograd_filter_init()
+ * @param[in] bias Bias row vector (1 × C_out), or NULL
+ * @param[out] out Output (C_out × (H-2) × (W-2)), same layout as in
+ * @param[out] scratch Input-tile transforms for all channels
+ * @param[in] scratch_len Elements in scratch, >= FX_WINOGRAD_SCRATCH_LEN(C_in)
+ *
+ * @pre |Σ in × w| < 2^61 in Q32.32 for every output (|y| < 2^29 in real terms)
+ * @post out contains the convolution if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(C_out × C_in × OH × OW × 4) multiplies, O(C_in) scratch
+ * @determinism Bit-perfect, identical to fx_conv2d_tensor() within the precondition
+ *
+ * @traceability SRS-006.3, SRS-006.4, SRS-006.15
+ */
+void fx_conv2d_winograd(const fx_tensor_t* in, const fx_winograd_filter_t* wf,
+                        const fx_matrix_t* bias, fx_tensor_t* out,
+                        int64_t* scratch, size_t scratch_len);
+
+/**
+ * @brief uint32_t scratch elements for fx_conv2d_ntt().
+ *
+ * @details 4 × N1 × N2, where N1, N2 are the powers of two >= in_h, in_w.
+ *
+ * @return Required length, or 0 if a transform length would exceed 2^23
+ *
+ * @traceability SRS-006.16
+ */
+size_t fx_conv2d_ntt_scratch_len(uint32_t in_h, uint32_t in_w);
+
+/**
+ * @brief Exact large-kernel convolution via number-theoretic transforms.
+ *
+ * @details Computes the valid 2-D correlation of fx_conv2d() as a cyclic
+ * convolution of size N1 × N2 (powers of two covering the input; wrap-around
+ * only touches discarded outputs) with 2-D NTTs modulo three NTT-friendly
+ * primes (998244353, 167772161, 469762049, generator 3). Each prime yields
+ * the exact accumulator modulo p; before reconstruction 2^63 is added so
+ * the value Z = Y + 2^63 lies in [0, 2^64), far below the product of the
+ * primes (~2^86). Garner's mixed-radix reconstruction evaluated modulo 2^64
+ * then returns Z exactly, and Y = Z − 2^63.
+ *
+ * The int64_t accumulators are therefore exactly those of the direct loop,
+ * and the Q16.16 output uses the same single rounding. Cost is
+ * O(N1·N2·log(N1·N2)) independent of the kernel size.
+ *
+ * @param[in] in Input feature map (H×W)
+ * @param[in] kernel Convolution kernel (KH×KW)
+ * @param[out] out Output ((H-KH+1)×(W-KW+1))
+ * @param[out] acc Optional (may be NULL): OH×OW exact accumulators before rounding
+ * @param[out] scratch Transform buffers
+ * @param[in] scratch_len Elements in scratch, >= fx_conv2d_ntt_scratch_len(H, W)
+ *
+ * @pre Every accumulator fits in int64_t (same as the direct loop)
+ * @post out (and acc) contain the convolution if all shapes are valid,
+ *       unchanged otherwise
+ *
+ * @complexity O(N1 × N2 × log(N1 × N2)) time, O(N1 × N2) scratch
+ * @determinism Bit-perfect, identical to fx_conv2d()
+ *
+ * @traceability SRS-006.3, SRS-006.4, SRS-006.16
+ */
+void fx_conv2d_ntt(const fx_matrix_t* in, const fx_matrix_t* kernel,
+                   fx_matrix_t* out, int64_t* acc,
+                   uint32_t* scratch, size_t scratch_len);
+
 #endif /* CONVOLUTION_H */
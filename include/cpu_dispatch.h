@@ -0,0 +1,96 @@
+/**
+ * @file cpu_dispatch.h
+ * @project Certifiable Inference Engine
+ * @brief Runtime selection of bit-identical SIMD kernels.
+ *
+ * @details The integer kernels behind fx_matrix_mul(), fx_matrix_mul_blocked()
+ * and fx_vector_dot() exist in a portable scalar form (the reference) and, on
+ * x86, in SSE4.1 and AVX2 forms. Because Q16.16 × Q16.16 products are
+ * accumulated exactly in 64-bit lanes, every variant produces the same bits.
+ *
+ * The instruction set is chosen once at startup via cpuid. Before a SIMD
+ * variant is accepted it is run against the scalar reference on a fixed set
+ * of test vectors (including INT32_MIN/INT32_MAX operands); any mismatch
+ * drops the selection back to the next lower level.
+ *
+ * @traceability SRS-003.3, SRS-003.10
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+#include <stdint.h>
+
+/**
+ * @brief Kernel instruction-set levels, ordered from lowest to highest.
+ */
+typedef enum {
+    FX_ISA_SCALAR = 0,           /**< Portable C99 reference kernels */
+    FX_ISA_SSE41,                /**< x86 SSE4.1 (_mm_mul_epi32) */
+    FX_ISA_AVX2                  /**< x86 AVX2 (_mm256_mul_epi32) */
+} fx_isa_t;
+
+/**
+ * @brief Detect the CPU and select the best self-checked kernel set.
+ *
+ * @details Idempotent. Kernels call this lazily on first use, but it should
+ * be called once at startup, before inference threads are created, so the
+ * selection is fixed before any concurrent access.
+ *
+ * @return Selected instruction-set level
+ *
+ * @post Active kernels are bit-identical to the scalar reference
+ *
+ * @complexity O(1) (fixed-size self-check)
+ * @determinism Selection depends on the CPU; results do not
+ *
+ * @traceability SRS-003.10
+ */
+fx_isa_t fx_dispatch_init(void);
+
+/**
+ * @brief Force a specific kernel level (e.g. scalar-only validation runs).
+ *
+ * @details Falls back to the highest level at or below the request that is
+ * supported by the CPU and passes the self-check. Requesting FX_ISA_SCALAR
+ * always succeeds.
+ *
+ * @param[in] isa Requested level
+ * @return Level actually selected
+ *
+ * @pre No kernel is executing concurrently
+ *
+ * @complexity O(1)
+ * @determinism Results are unaffected by the selected level
+ *
+ * @traceability SRS-003.10
+ */
+fx_isa_t fx_dispatch_force(fx_isa_t isa);
+
+/**
+ * @brief Currently selected kernel level (initializes on first call).
+ *
+ * @return Active instruction-set level
+ *
+ * @complexity O(1)
+ * @determinism Stable after initialization
+ */
+fx_isa_t fx_dispatch_active(void);
+
+/**
+ * @brief Human-readable name of a kernel level.
+ *
+ * @param[in] isa Level
+ * @return Static string ("scalar", "sse4.1", "avx2")
+ *
+ * @complexity O(1)
+ */
+const char* fx_isa_name(fx_isa_t isa);
+
+#endif /* CPU_DISPATCH_H */
@@ -0,0 +1,92 @@
+/**
+ * @file dense.h
+ * @project Certifiable Inference Engine
+ * @brief Fused dense (fully connected) layer forward pass.
+ *
+ * @details Computes y = activation(x × W + b) in a single pass over the
+ * output. The bias is added to the 64-bit accumulator before the one
+ * rounding step and the activation is applied before the single store, so
+ * the output matrix is written exactly once.
+ *
+ * @traceability SRS-004-ACTIVATIONS
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef DENSE_H
+#define DENSE_H
+
+#include "matrix.h"
+#include "activations.h"
+
+/**
+ * @brief Fused dense layer: out = activation(in × weights + bias)
+ *
+ * @details Equivalent to the three-pass sequence
+ *   fx_matrix_mul(in, weights, out);
+ *   fx_matrix_add_bias(out, bias);
+ *   fx_relu(out) / fx_leaky_relu(out, alpha);
+ * and bit-identical to it: bias[j] is folded into the Q32.32 accumulator as
+ * bias[j] << 16, which is a multiple of the rounding unit, so
+ *   (acc + (bias << 16) + FIXED_HALF) >> 16 == round(acc) + bias
+ * exactly. The activation uses the same fixed-point arithmetic as the
+ * stand-alone functions.
+ *
+ * @param[in] in Input activations (N×M)
+ * @param[in] weights Weight matrix (M×P)
+ * @param[in] bias Bias row vector (1×P), or NULL for no bias
+ * @param[in] act Activation to apply, or NULL for identity
+ * @param[out] out Output activations (N×P), must be pre-allocated
+ *
+ * @pre in, weights, out are valid pointers with allocated data
+ * @pre in->cols == weights->rows
+ * @pre out dimensions are in->rows × weights->cols
+ * @pre bias (if given) is 1 × weights->cols
+ * @pre out does not overlap in or weights
+ * @post out contains the layer output if dimensions valid, unchanged otherwise
+ *
+ * @complexity O(N * M * P) time, O(1) space
+ * @determinism Bit-perfect, identical to the unfused sequence
+ *
+ * @traceability SRS-003.5, SRS-004.3, SRS-004.9
+ */
+void fx_dense_forward(const fx_matrix_t* in, const fx_matrix_t* weights,
+                      const fx_matrix_t* bias, const fx_activation_t* act,
+                      fx_matrix_t* out);
+
+/**
+ * @brief Fused dense layer over weights packed at load time.
+ *
+ * @details Same result as fx_dense_forward() with the unpacked weights. The
+ * weights are packed once by fx_pack_weights() (K×P) or
+ * fx_pack_weights_transposed() (P×K), and every call then runs the
+ * register-blocked micro-kernel directly over the panels, with the bias
+ * folded into the Q32.32 accumulator before the single rounding and the
+ * activation applied to each FX_GEMM_MR × FX_GEMM_NC tile row before it is
+ * stored, so every output element is written exactly once.
+ *
+ * @param[in] in Input activations (N×K)
+ * @param[in] weights Packed weights (K×P)
+ * @param[in] bias Bias row vector (1×P), or NULL for no bias
+ * @param[in] act Activation to apply, or NULL for identity
+ * @param[out] out Output activations (N×P), must be pre-allocated
+ *
+ * @pre in->cols == weights->rows, out dimensions are in->rows × weights->cols
+ * @pre bias (if given) is 1 × weights->cols
+ * @pre out does not overlap in or weights
+ * @post out contains the layer output if dimensions valid, unchanged otherwise
+ *
+ * @complexity O(N * K * P) time, O(1) space
+ * @determinism Bit-perfect, identical to fx_dense_forward()
+ *
+ * @traceability SRS-003.13, SRS-004.3, SRS-004.9
+ */
+void fx_dense_forward_packed(const fx_matrix_t* in, const fx_packed_weights_t* weights,
+                             const fx_matrix_t* bias, const fx_activation_t* act,
+                             fx_matrix_t* out);
+
+#endif /* DENSE_H */
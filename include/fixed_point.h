@@ -200,6 +200,61 @@ fixed_t fixed_mul(fixed_t a, fixed_t b);
  */
 fixed_t fixed_div(fixed_t a, fixed_t b);
 
+/**
+ * @brief Deterministic logistic sigmoid, 1 / (1 + e^-x).
+ *
+ * @details Linear interpolation in a generated 1025-entry table over
+ * [0, 16) with a single rounding; negative inputs use
+ * sigmoid(-x) = 1 - sigmoid(x). Integer operations only.
+ *
+ * @param[in] x Input value (any fixed_t)
+ * @return sigmoid(x) in [0, FIXED_ONE]
+ *
+ * @post |result - sigmoid(x)| <= 1 LSB (2^-16)
+ *
+ * @complexity O(1), no branches on the data
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.11
+ */
+fixed_t fixed_sigmoid(fixed_t x);
+
+/**
+ * @brief Deterministic hyperbolic tangent.
+ *
+ * @details Linear interpolation in a generated 1025-entry table over
+ * [0, 8); exactly odd, tanh(-x) = -tanh(x).
+ *
+ * @param[in] x Input value (any fixed_t)
+ * @return tanh(x) in [-FIXED_ONE, FIXED_ONE]
+ *
+ * @post |result - tanh(x)| <= 1 LSB (2^-16)
+ *
+ * @complexity O(1), no branches on the data
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.11
+ */
+fixed_t fixed_tanh(fixed_t x);
+
+/**
+ * @brief Deterministic exponential e^x.
+ *
+ * @details Evaluated as 2^(x * log2 e): exact Q.46 product, table for the
+ * fractional power of two, shift for the integer part.
+ *
+ * @param[in] x Input value (any fixed_t)
+ * @return e^x, FIXED_MAX when e^x >= 32768, FIXED_ZERO when e^x < 2^-17
+ *
+ * @post |result - e^x| <= 1/2 LSB + 2^-23 * e^x; for x <= 0 at most 1 LSB
+ *
+ * @complexity O(1)
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-004.11
+ */
+fixed_t fixed_exp(fixed_t x);
+
 /**
  * @brief Fixed-point absolute value.
  *
@@ -28,14 +28,16 @@
  * @brief Matrix structure for fixed-point data.
  *
  * @details Uses row-major layout for cache efficiency.
- * Element [i][j] stored at data[i * cols + j].
+ * Element [i][j] stored at data[i * cols + j]. Dimensions are 32-bit and all
+ * element indexing is done in size_t, so rows * cols may exceed 2^32 on
+ * 64-bit hosts.
  *
  * @note Memory managed by caller - no dynamic allocation.
  */
 typedef struct {
     fixed_t* data;               /**< Pointer to pre-allocated buffer */
-    uint16_t rows;               /**< Number of rows */
-    uint16_t cols;               /**< Number of columns */
+    uint32_t rows;               /**< Number of rows */
+    uint32_t cols;               /**< Number of columns */
 } fx_matrix_t;
 
 /**
@@ -61,7 +63,7 @@ typedef struct {
  *
  * @traceability SRS-003.1, SRS-003.2
  */
-void fx_matrix_init(fx_matrix_t* mat, fixed_t* buffer, uint16_t rows, uint16_t cols);
+void fx_matrix_init(fx_matrix_t* mat, fixed_t* buffer, uint32_t rows, uint32_t cols);
 
 /**
  * @brief Attach a pre-populated buffer to a matrix (no zeroing).
@@ -91,7 +93,7 @@ void fx_matrix_init(fx_matrix_t* mat, fixed_t* buffer, uint16_t rows, uint16_t c
  * @traceability SRS-003.1
  */
 static inline void fx_matrix_attach(fx_matrix_t* mat, fixed_t* buffer,
-                                    uint16_t rows, uint16_t cols) {
+                                    uint32_t rows, uint32_t cols) {
     if (!mat || !buffer) {
         return;
     }
@@ -106,8 +108,9 @@ static inline void fx_matrix_attach(fx_matrix_t* mat, fixed_t* buffer,
  * @details Implements GEMM (General Matrix Multiply) with:
  * - 64-bit intermediate accumulators (prevents overflow)
  * - Proper rounding (minimizes quantization error)
- * - Sequential operations only (no SIMD, bit-perfect)
- * - Row-major access pattern (cache-friendly)
+ * - Exact integer accumulation, so the runtime-selected SIMD kernels
+ *   (see cpu_dispatch.h) give the same bits as the scalar reference
+ * - Row-major access pattern: B is read in FX_GEMM_NR-wide row strips
  *
  * Dimension requirements: A(N×M) × B(M×P) = C(N×P)
  * Must have: A.cols == B.rows
@@ -126,10 +129,214 @@ static inline void fx_matrix_attach(fx_matrix_t* mat, fixed_t* buffer,
  *
  * @note Returns early without modifying C if dimensions incompatible
  *
- * @traceability SRS-003.3, SRS-003.4, SRS-003.5, SRS-003.6
+ * @traceability SRS-003.3, SRS-003.4, SRS-003.5, SRS-003.6, SRS-003.10
  */
 void fx_matrix_mul(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C);
 
+/** @brief Rows of C produced by one GEMM micro-tile (register block height) */
+#define FX_GEMM_MR 4
+
+/** @brief Columns of C produced by one GEMM micro-tile (packed panel width) */
+#define FX_GEMM_NR 8
+
+/** @brief Columns of B packed per outer block (multiple of FX_GEMM_NR) */
+#define FX_GEMM_NC 64
+
+/** @brief Depth of each k-block streamed through the micro-kernel */
+#define FX_GEMM_KC 256
+
+/**
+ * @brief Scratch elements required by fx_matrix_mul_blocked().
+ *
+ * @details One outer block of B (all k rows × FX_GEMM_NC columns) is packed
+ * into the scratch buffer as contiguous FX_GEMM_NR-wide panels.
+ *
+ * @param k Shared dimension (A.cols == B.rows)
+ */
+#define FX_GEMM_SCRATCH_LEN(k) ((size_t)(k) * FX_GEMM_NC)
+
+/**
+ * @brief Cache-blocked matrix multiplication: C = A × B
+ *
+ * @details Produces exactly the same bits as fx_matrix_mul(), but walks the
+ * operands in a cache-friendly order:
+ * - B is packed, FX_GEMM_NC columns at a time, into contiguous
+ *   FX_GEMM_NR-wide panels in the caller-provided scratch buffer
+ * - C is computed in FX_GEMM_MR × FX_GEMM_NC tiles whose 64-bit
+ *   accumulators stay resident while k advances in FX_GEMM_KC blocks
+ * - A register-blocked FX_GEMM_MR × FX_GEMM_NR micro-kernel performs the
+ *   multiply-accumulate over unit-stride panel data
+ *
+ * Every element is still one exact int64_t sum of Q32.32 products followed
+ * by a single round-to-nearest step. Integer addition is associative, so the
+ * blocked evaluation order cannot change the result.
+ *
+ * @param[in] A First matrix (N×M)
+ * @param[in] B Second matrix (M×P)
+ * @param[out] C Result matrix (N×P), must be pre-allocated
+ * @param[in] scratch Packing buffer owned by the caller
+ * @param[in] scratch_len Number of fixed_t elements in scratch
+ *
+ * @pre A, B, C, scratch are valid pointers
+ * @pre A.cols == B.rows, C dimensions are A.rows × B.cols
+ * @pre scratch_len >= FX_GEMM_SCRATCH_LEN(A.cols)
+ * @pre scratch does not overlap A, B or C
+ * @post C is bit-identical to fx_matrix_mul(A, B, C) if preconditions hold,
+ *       unchanged otherwise
+ *
+ * @complexity O(N * M * P) time, O(1) stack (one MR×NC accumulator tile)
+ * @determinism Bit-perfect, identical to fx_matrix_mul()
+ *
+ * @traceability SRS-003.4, SRS-003.5, SRS-003.9
+ */
+void fx_matrix_mul_blocked(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C,
+                           fixed_t* scratch, size_t scratch_len);
+
+/**
+ * @brief Weights packed once, at load time, into GEMM panel order.
+ *
+ * @details Holds a K×P weight matrix W as ceil(P / FX_GEMM_NR) contiguous
+ * panels, each K × FX_GEMM_NR and stored k-major:
+ *   data[(j / NR) * K * NR + k * NR + j % NR] = W[k][j]
+ * which is exactly the layout fx_matrix_mul_blocked() re-packs into scratch
+ * on every call. Columns past P in the last panel are zero. FX_GEMM_NR is
+ * shared by every kernel set, so one packing serves whichever set
+ * cpu_dispatch.h selects.
+ *
+ * @note Memory managed by caller - no dynamic allocation.
+ */
+typedef struct {
+    fixed_t* data;               /**< FX_PACKED_WEIGHTS_LEN(rows, cols) elements */
+    uint32_t rows;               /**< K (inputs) */
+    uint32_t cols;               /**< P (outputs) */
+} fx_packed_weights_t;
+
+/**
+ * @brief Elements needed to pack K×P weights (P rounded up to FX_GEMM_NR).
+ *
+ * @param k Inputs (W.rows)
+ * @param p Outputs (W.cols)
+ */
+#define FX_PACKED_WEIGHTS_LEN(k, p) \
+    ((size_t)(k) * ((((size_t)(p) + FX_GEMM_NR - 1u) / FX_GEMM_NR) * FX_GEMM_NR))
+
+/**
+ * @brief Pack K×P weights into panel order.
+ *
+ * @param[in] W Weights (K×P), as used by fx_matrix_mul(in, W, out)
+ * @param[out] buffer Destination owned by the caller
+ * @param[in] buffer_len Number of fixed_t elements in buffer
+ * @param[out] packed Packed weights referencing buffer
+ *
+ * @pre buffer_len >= FX_PACKED_WEIGHTS_LEN(W.rows, W.cols)
+ * @pre buffer does not overlap W
+ * @post packed describes W if preconditions hold, packed and buffer unchanged otherwise
+ *
+ * @complexity O(K × P), once per model load
+ * @determinism Bit-perfect (copy only)
+ *
+ * @traceability SRS-003.13
+ */
+void fx_pack_weights(const fx_matrix_t* W, fixed_t* buffer, size_t buffer_len,
+                     fx_packed_weights_t* packed);
+
+/**
+ * @brief Pack weights stored one row per output (Wᵀ, P×K) into panel order.
+ *
+ * @details Same result as fx_pack_weights() on W. Accepts the nn.Linear
+ * layout of fx_matrix_vec_mul() and, viewed as C_out × (C_in·KH·KW), a
+ * convolution filter bank for fx_conv2d_im2col_packed().
+ *
+ * @param[in] Wt Transposed weights (P×K)
+ * @param[out] buffer Destination owned by the caller
+ * @param[in] buffer_len Number of fixed_t elements in buffer
+ * @param[out] packed Packed weights (rows = K, cols = P) referencing buffer
+ *
+ * @pre buffer_len >= FX_PACKED_WEIGHTS_LEN(Wt.cols, Wt.rows)
+ * @pre buffer does not overlap Wt
+ * @post packed describes Wtᵀ if preconditions hold, packed and buffer unchanged otherwise
+ *
+ * @complexity O(K × P), once per model load
+ * @determinism Bit-perfect (copy only)
+ *
+ * @traceability SRS-003.13
+ */
+void fx_pack_weights_transposed(const fx_matrix_t* Wt, fixed_t* buffer, size_t buffer_len,
+                                fx_packed_weights_t* packed);
+
+/**
+ * @brief Matrix multiplication with pre-packed weights: C = A × W
+ *
+ * @details fx_matrix_mul_blocked() without the per-call packing: the
+ * FX_GEMM_MR × FX_GEMM_NR micro-kernel reads the panels of W in place, so
+ * no scratch is needed and W is never re-read in row-major order. Each
+ * element is one exact int64_t sum followed by a single round-to-nearest.
+ *
+ * @param[in] A Input (N×K)
+ * @param[in] W Packed weights (K×P)
+ * @param[out] C Result (N×P), must be pre-allocated
+ *
+ * @pre A, W, C are valid pointers; C does not overlap A or W
+ * @pre A.cols == W.rows, C dimensions are A.rows × W.cols
+ * @post C is bit-identical to fx_matrix_mul() with the unpacked weights if
+ *       dimensions compatible, unchanged otherwise
+ *
+ * @complexity O(N × K × P) time, O(1) stack (one MR×NC accumulator tile)
+ * @determinism Bit-perfect, identical to fx_matrix_mul()
+ *
+ * @traceability SRS-003.4, SRS-003.5, SRS-003.13
+ */
+void fx_matrix_mul_packed(const fx_matrix_t* A, const fx_packed_weights_t* W, fx_matrix_t* C);
+
+/**
+ * @brief Matrix-vector product for batch-1 layers: y = x × W, with W given as Wᵀ.
+ *
+ * @details GEMV with the weights stored one row per output (Wᵀ, P×K, the
+ * layout of PyTorch nn.Linear; fx_matrix_transpose() produces it once at
+ * load time from a K×P W). Every output is then a contiguous dot product, so
+ * the weights are streamed exactly once, front to back:
+ * - Four weight rows are processed together against one shared load of x,
+ *   each into its own accumulators, hiding multiply-add latency
+ * - Each row is prefetched a fixed distance ahead of the loads
+ * - The active kernel set (cpu_dispatch.h) does the multiply-accumulate
+ *
+ * Each output is one exact int64_t sum followed by a single round-to-nearest,
+ * so y is bit-identical to fx_matrix_mul(x, W, y).
+ *
+ * @param[in] x Input row vector (1×K)
+ * @param[in] Wt Transposed weights (P×K)
+ * @param[out] y Output row vector (1×P), must be pre-allocated
+ *
+ * @pre x, Wt, y are valid pointers; y does not overlap x or Wt
+ * @pre x.rows == 1, y.rows == 1, x.cols == Wt.cols, y.cols == Wt.rows
+ * @post y contains x × Wtᵀ if dimensions compatible, unchanged otherwise
+ *
+ * @complexity O(K * P) time, O(1) space
+ * @determinism Bit-perfect, identical to fx_matrix_mul()
+ *
+ * @traceability SRS-003.4, SRS-003.5, SRS-003.12
+ */
+void fx_matrix_vec_mul(const fx_matrix_t* x, const fx_matrix_t* Wt, fx_matrix_t* y);
+
+/**
+ * @brief Matrix transpose: out = inᵀ
+ *
+ * @details Converts K×P weights into the P×K layout of fx_matrix_vec_mul().
+ * Intended for load time; no arithmetic, so exact.
+ *
+ * @param[in] in Source matrix (R×C)
+ * @param[out] out Destination matrix (C×R), must be pre-allocated
+ *
+ * @pre in and out are valid pointers and do not overlap
+ * @post out[j][i] = in[i][j] if dimensions match, unchanged otherwise
+ *
+ * @complexity O(R * C)
+ * @determinism Bit-perfect
+ *
+ * @traceability SRS-003.12
+ */
+void fx_matrix_transpose(const fx_matrix_t* in, fx_matrix_t* out);
+
 /**
  * @brief Dot product of two fixed-point vectors.
  *
@@ -148,11 +355,11 @@ void fx_matrix_mul(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C);
  * @post Returns sum(a[i] * b[i])
  *
  * @complexity O(len)
- * @determinism Bit-perfect across all platforms
+ * @determinism Bit-perfect across all platforms and kernel levels
  *
- * @traceability SRS-003.5, SRS-003.6
+ * @traceability SRS-003.5, SRS-003.6, SRS-003.10
  */
-fixed_t fx_vector_dot(const fixed_t* a, const fixed_t* b, uint16_t len);
+fixed_t fx_vector_dot(const fixed_t* a, const fixed_t* b, size_t len);
 
 /**
  * @brief Element-wise matrix addition: C = A + B
@@ -179,8 +386,9 @@ void fx_matrix_add(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C);
 /**
  * @brief Apply function element-wise to matrix.
  *
- * @details Applies activation function to each element.
- * Used for ReLU, sigmoid, etc. in neural network layers.
+ * @details Applies a custom element function through a pointer. Built-in
+ * activations should use fx_matrix_apply_activation() (activations.h),
+ * which avoids the indirect call per element.
  *
  * @param[in,out] mat Matrix to modify in-place
  * @param[in] fn Function to apply to each element
@@ -191,7 +399,7 @@ void fx_matrix_add(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C);
  * @complexity O(rows * cols)
  * @determinism Depends on fn determinism
  *
- * @traceability SRS-003.3
+ * @traceability SRS-003.3, SRS-004.12
  */
 void fx_matrix_apply(fx_matrix_t* mat, fixed_t (*fn)(fixed_t));
 
@@ -0,0 +1,148 @@
+/**
+ * @file parallel.h
+ * @project Certifiable Inference Engine
+ * @brief Fixed-size worker pool and deterministic multi-threaded GEMM.
+ *
+ * @details The pool is a caller-owned structure: threads are created once by
+ * fx_pool_init() and reused for every job, with no allocation. Work is split
+ * by a static partition computed from the problem shape and the thread count
+ * only, never from run-time scheduling, so each output element is produced
+ * by exactly the same sequential k-loop as in fx_matrix_mul(). Results are
+ * therefore bit-identical for every thread count, including one.
+ *
+ * @traceability SRS-003.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "matrix.h"
+#include <pthread.h>
+#include <stdint.h>
+
+/** @brief Maximum number of participants (caller thread + workers) */
+#define FX_POOL_MAX_THREADS 64u
+
+/**
+ * @brief Job body: process partition @p part of @p n_parts.
+ */
+typedef void (*fx_pool_job_fn)(void* ctx, uint32_t part, uint32_t n_parts);
+
+/**
+ * @brief Result codes for pool setup.
+ */
+typedef enum {
+    FX_POOL_OK = 0,              /**< Pool ready */
+    FX_POOL_INVALID_PARAM,       /**< NULL pool or thread count out of range */
+    FX_POOL_THREAD_ERROR         /**< OS refused a thread or sync object */
+} fx_pool_res_t;
+
+struct fx_pool_s;
+
+/** @brief Per-worker start argument (index 0 is the calling thread) */
+typedef struct {
+    struct fx_pool_s* pool;
+    uint32_t index;
+} fx_pool_worker_t;
+
+/**
+ * @brief Worker pool. Opaque to callers; storage is caller-provided.
+ */
+typedef struct fx_pool_s {
+    pthread_t threads[FX_POOL_MAX_THREADS];
+    fx_pool_worker_t workers[FX_POOL_MAX_THREADS];
+    pthread_mutex_t lock;
+    pthread_cond_t start_cv;
+    pthread_cond_t done_cv;
+    fx_pool_job_fn job;
+    void* job_ctx;
+    uint64_t generation;         /**< Incremented once per submitted job */
+    uint32_t n_threads;          /**< Participants, including the caller */
+    uint32_t pending;            /**< Workers still running the current job */
+    uint32_t started;            /**< Worker threads actually created */
+    int shutdown;
+} fx_pool_t;
+
+/**
+ * @brief Start a pool of @p n_threads participants.
+ *
+ * @details The calling thread always runs partition 0, so n_threads − 1
+ * worker threads are created. Also fixes the SIMD kernel selection
+ * (fx_dispatch_init()) before any worker exists.
+ *
+ * @param[out] pool Pool storage
+ * @param[in] n_threads Participants, 1..FX_POOL_MAX_THREADS
+ * @return FX_POOL_OK, or an error with no threads left running
+ *
+ * @post On success, fx_pool_destroy() must be called exactly once
+ *
+ * @complexity O(n_threads)
+ * @determinism Thread count never affects results
+ *
+ * @traceability SRS-003.11
+ */
+fx_pool_res_t fx_pool_init(fx_pool_t* pool, uint32_t n_threads);
+
+/**
+ * @brief Stop and join all workers.
+ *
+ * @param[in,out] pool Pool started by fx_pool_init()
+ *
+ * @pre No job is running
+ *
+ * @traceability SRS-003.11
+ */
+void fx_pool_destroy(fx_pool_t* pool);
+
+/**
+ * @brief Run job(ctx, p, n) for every p in [0, n) and wait for completion.
+ *
+ * @details Partition 0 runs on the calling thread; partition p > 0 always
+ * runs on worker p. Returns only after every partition has finished.
+ *
+ * @param[in,out] pool Initialized pool
+ * @param[in] job Job body
+ * @param[in] ctx Passed unchanged to every partition
+ *
+ * @pre Called from one thread at a time
+ *
+ * @complexity One wake-up and one join per job
+ *
+ * @traceability SRS-003.11
+ */
+void fx_pool_run(fx_pool_t* pool, fx_pool_job_fn job, void* ctx);
+
+/**
+ * @brief Multi-threaded GEMM: C = A × B
+ *
+ * @details The output is split statically into contiguous bands: row bands
+ * when A has at least as many rows as the pool has threads, otherwise
+ * FX_GEMM_NR-aligned column bands (batch-1 layers). Every element is
+ * computed by the same kernel and k-order as fx_matrix_mul(), so C is
+ * byte-identical to the single-threaded result for any thread count.
+ *
+ * @param[in,out] pool Initialized pool (NULL runs single-threaded)
+ * @param[in] A Left matrix (N×M)
+ * @param[in] B Right matrix (M×P)
+ * @param[out] C Result matrix (N×P), must be pre-allocated
+ *
+ * @pre A->cols == B->rows
+ * @pre C dimensions are A->rows × B->cols
+ * @pre C does not overlap A or B
+ * @post C contains A × B if dimensions valid, unchanged otherwise
+ *
+ * @complexity O(N * M * P / T) time per thread, O(1) space
+ * @determinism Bit-perfect, independent of thread count
+ *
+ * @traceability SRS-003.5, SRS-003.11
+ */
+void fx_matrix_mul_parallel(fx_pool_t* pool, const fx_matrix_t* A,
+                            const fx_matrix_t* B, fx_matrix_t* C);
+
+#endif /* PARALLEL_H */
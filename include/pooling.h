@@ -1,7 +1,7 @@
 /**
  * @file pooling.h
  * @project Certifiable Inference Engine
- * @brief Bounded-resource, deterministic Max Pooling operations for CNNs.
+ * @brief Bounded-resource, deterministic max and average pooling for CNNs.
  *
  * @details Implements max pooling layers for spatial dimension reduction
  * in convolutional neural networks. All operations are deterministic,
@@ -19,6 +19,7 @@
 #define POOLING_H
 
 #include "matrix.h"
+#include "tensor.h"
 
 /**
  * @brief Deterministic 2×2 Max Pooling with stride 2.
@@ -75,4 +76,199 @@
  */
 void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out);
 
+/**
+ * @brief Window, stride and implicit padding for generic pooling.
+ *
+ * @details Padding is never materialized. Max pooling ignores padded
+ * positions; average pooling counts them as zeros (the divisor is always
+ * pool_h × pool_w). Each pad must be smaller than the window along its axis,
+ * so every window covers at least one input element.
+ */
+typedef struct {
+    uint32_t pool_h;             /**< Window height (>= 1) */
+    uint32_t pool_w;             /**< Window width (>= 1) */
+    uint32_t stride_h;           /**< Vertical stride (>= 1) */
+    uint32_t stride_w;           /**< Horizontal stride (>= 1) */
+    uint32_t pad_top;            /**< Padding rows above the input (< pool_h) */
+    uint32_t pad_bottom;         /**< Padding rows below the input (< pool_h) */
+    uint32_t pad_left;           /**< Padding columns left of the input (< pool_w) */
+    uint32_t pad_right;          /**< Padding columns right of the input (< pool_w) */
+} fx_pool_params_t;
+
+/** @brief 2×2 stride 2, no padding (same as fx_maxpool_2x2) */
+#define FX_POOL_PARAMS_2X2 {2u, 2u, 2u, 2u, 0u, 0u, 0u, 0u}
+
+/** @brief Largest supported average-pooling window area */
+#define FX_AVGPOOL_MAX_AREA ((uint32_t)1 << 30)
+
+/**
+ * @brief Output extent along one axis.
+ *
+ * @details out = (in + pad_before + pad_after − k) / stride + 1
+ *
+ * @return Output size, or 0 if the window does not fit, k or stride is zero,
+ *         or a pad is not smaller than k
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-008.9, SRS-008.10
+ */
+uint32_t fx_pool_output_dim(uint32_t in, uint32_t k, uint32_t stride,
+                            uint32_t pad_before, uint32_t pad_after);
+
+/**
+ * @brief fixed_t scratch elements needed by fx_maxpool().
+ *
+ * @details H × OW for the horizontal pass plus three line buffers of the
+ * longer padded axis.
+ *
+ * @return Required length, or 0 if params are invalid for this input
+ *
+ * @traceability SRS-008.9
+ */
+size_t fx_maxpool_scratch_len(uint32_t in_h, uint32_t in_w,
+                              const fx_pool_params_t* params);
+
+/**
+ * @brief Generic max pooling (any window, stride and padding).
+ *
+ * @details Runs as two separable 1-D passes (rows, then columns). Along an
+ * axis with a window of more than 4 elements each line is reduced with the
+ * van Herk / Gil-Werman running max: per-block prefix and suffix maxima
+ * give every window in one comparison, so the cost per element is constant
+ * in the window size. Smaller windows are scanned directly.
+ *
+ * Max is exact, so both strategies and any pass order give the same result;
+ * for 2×2 stride 2 the output equals fx_maxpool_2x2().
+ *
+ * @param[in] in Input feature map
+ * @param[in] params Window, stride and padding
+ * @param[out] out Output (fx_pool_output_dim() along each axis)
+ * @param[out] scratch Working memory
+ * @param[in] scratch_len Elements in scratch, >= fx_maxpool_scratch_len()
+ *
+ * @post out contains the pooled map if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(H × W + H × OW) time, independent of window size for
+ *             windows > 4; O(H × OW) scratch
+ * @determinism Bit-perfect; execution time depends only on dimensions
+ *
+ * @traceability SRS-008.2, SRS-008.9, SRS-008.10
+ */
+void fx_maxpool(const fx_matrix_t* in, const fx_pool_params_t* params,
+                fx_matrix_t* out, fixed_t* scratch, size_t scratch_len);
+
+/**
+ * @brief Generic average pooling (any window, stride and padding).
+ *
+ * @details The window sum S is accumulated exactly in int64_t and divided
+ * by the window area A (padding counted as zero) with round half away from
+ * zero:
+ *   out = sign(S) × ⌊(2|S| + A) / 2A⌋
+ *
+ * No division runs per element: a power-of-two A uses a shift, any other A
+ * a precomputed 64-bit reciprocal (Granlund–Montgomery) that is exact for
+ * every 64-bit numerator.
+ *
+ * @param[in] in Input feature map
+ * @param[in] params Window, stride and padding (area <= FX_AVGPOOL_MAX_AREA)
+ * @param[out] out Output (fx_pool_output_dim() along each axis)
+ *
+ * @post out contains the pooled map if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(OH × OW × pool_h × pool_w) time, O(1) space
+ * @determinism Bit-perfect; exact quotient with a fixed rounding rule
+ *
+ * @traceability SRS-008.8, SRS-008.9, SRS-008.10
+ */
+void fx_avgpool(const fx_matrix_t* in, const fx_pool_params_t* params,
+                fx_matrix_t* out);
+
+/** @brief int64_t elements of an integral image for an h × w input */
+#define FX_INTEGRAL_LEN(h, w) (((size_t)(h) + 1u) * ((size_t)(w) + 1u))
+
+/**
+ * @brief Integral image (summed-area table).
+ *
+ * @details data[y][x] = Σ in[0..y)[0..x) in a (rows + 1) × (cols + 1)
+ * row-major table with a zero first row and column. Entries are exact
+ * int64_t sums of raw Q16.16 values (|sum| <= rows·cols·2^31).
+ *
+ * @note Memory managed by caller - no dynamic allocation.
+ */
+typedef struct {
+    int64_t* data;               /**< (rows + 1) × (cols + 1) sums */
+    uint32_t rows;               /**< Source height; 0 if build failed */
+    uint32_t cols;               /**< Source width */
+} fx_integral_t;
+
+/**
+ * @brief Build the integral image of in.
+ *
+ * @param[out] sat Integral image
+ * @param[in] buffer Table storage
+ * @param[in] buffer_len Elements in buffer, >= FX_INTEGRAL_LEN(in->rows, in->cols)
+ * @param[in] in Source feature map
+ *
+ * @post sat holds the table; sat->rows is 0 on invalid input
+ *
+ * @complexity O(H × W) time, one addition pair per element
+ * @determinism Exact integer sums
+ *
+ * @traceability SRS-008.12
+ */
+void fx_integral_build(fx_integral_t* sat, int64_t* buffer, size_t buffer_len,
+                       const fx_matrix_t* in);
+
+/**
+ * @brief Exact sum of in[y0..y1)[x0..x1) from four table lookups.
+ *
+ * @return Raw int64_t sum of Q16.16 values, or 0 for an invalid rectangle
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-008.12
+ */
+int64_t fx_integral_box_sum(const fx_integral_t* sat, uint32_t y0, uint32_t x0,
+                            uint32_t y1, uint32_t x1);
+
+/**
+ * @brief Box filter (window mean) from an integral image.
+ *
+ * @details Bit-identical to fx_avgpool() on the source with the same params
+ * (padding counts as zero, round half away from zero), at O(1) per output
+ * regardless of window size.
+ *
+ * @param[in] sat Integral image of the input
+ * @param[in] params Window, stride and padding (area <= FX_AVGPOOL_MAX_AREA)
+ * @param[out] out Output (fx_pool_output_dim() along each axis)
+ *
+ * @post out contains the filtered map if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(OH × OW) time
+ * @determinism Bit-perfect, identical to fx_avgpool()
+ *
+ * @traceability SRS-008.8, SRS-008.12
+ */
+void fx_box_filter(const fx_integral_t* sat, const fx_pool_params_t* params,
+                   fx_matrix_t* out);
+
+/**
+ * @brief Global average pooling: one mean per channel.
+ *
+ * @details Exact int64_t sum over each H × W plane, rounded with the
+ * fx_avgpool() rule; equals fx_avgpool() with a window covering the plane.
+ *
+ * @param[in] in Input tensor (C × H × W, either layout, H × W <= FX_AVGPOOL_MAX_AREA)
+ * @param[out] out Row vector (1 × C)
+ *
+ * @post out contains the channel means if shapes are valid, unchanged otherwise
+ *
+ * @complexity O(C × H × W) time, O(1) space
+ * @determinism Bit-perfect
+ *
+ * @traceability SRS-008.8, SRS-008.12
+ */
+void fx_global_avgpool(const fx_tensor_t* in, fx_matrix_t* out);
+
 #endif /* POOLING_H */
@@ -0,0 +1,231 @@
+/**
+ * @file qint8.h
+ * @project Certifiable Inference Engine
+ * @brief Integer-only int8 inference: int8 activations and weights, int32 sums.
+ *
+ * @details Affine quantization as used by TFLite: real = s · (q − z).
+ * Activations are int8 with a zero point, weights are symmetric int8 with
+ * one row per output channel (zero point 0). Each output is
+ *
+ *   acc_j = Σ_k x_k · w_jk + b'_j      (int32_t dot product, exact)
+ *   y_j   = clamp(z_y + round(acc_j · M_j / 2^(31 + shift_j)), lo, hi)
+ *
+ * where b'_j = b_j − z_x · Σ_k w_jk is folded once at load time by
+ * fx_q8_fold_bias(), M_j / 2^(31 + shift_j) approximates s_x · s_w,j / s_y,
+ * and [lo, hi] is the int8 range narrowed by a folded ReLU/ReLU6.
+ * Rounding is the library's single round-half-up of an exact int64_t
+ * product, as in fixed_mul(), so results are identical on every platform.
+ *
+ * @traceability SRS-009-QUANTIZATION
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef QINT8_H
+#define QINT8_H
+
+#include "matrix.h"
+#include "tensor.h"
+#include "activations.h"
+#include <stdint.h>
+
+/** @brief Smallest / largest accepted shift (total right shift 31 + shift in [1, 62]) */
+#define FX_Q8_SHIFT_MIN (-30)
+#define FX_Q8_SHIFT_MAX 31
+
+/** @brief Longest reduction for which Σ x·w cannot overflow int32_t (2^16 · 2^14) */
+#define FX_Q8_MAX_DEPTH 65536u
+
+/**
+ * @brief int8 matrix (row-major).
+ *
+ * @note Memory managed by caller - no dynamic allocation.
+ */
+typedef struct {
+    int8_t* data;                /**< Pointer to pre-allocated values */
+    uint32_t rows;               /**< Number of rows */
+    uint32_t cols;               /**< Number of columns */
+} fx_q8_matrix_t;
+
+/**
+ * @brief int8 tensor (C × H × W) in NCHW or NHWC layout.
+ *
+ * @note Memory managed by caller - no dynamic allocation.
+ */
+typedef struct {
+    int8_t* data;                /**< Pointer to pre-allocated values */
+    uint32_t channels;           /**< C */
+    uint32_t rows;               /**< H */
+    uint32_t cols;               /**< W */
+    fx_layout_t layout;          /**< Memory order */
+} fx_q8_tensor_t;
+
+/**
+ * @brief Element offset of (c, y, x), same rule as fx_tensor_index().
+ *
+ * @complexity O(1)
+ */
+static inline size_t fx_q8_tensor_index(const fx_q8_tensor_t* t, size_t c,
+                                        size_t y, size_t x) {
+    if (t->layout == FX_LAYOUT_NHWC) {
+        return (y * t->cols + x) * t->channels + c;
+    }
+    return (c * t->rows + y) * t->cols + x;
+}
+
+/**
+ * @brief Fixed-point rescale: v ↦ round(v · multiplier / 2^(31 + shift)).
+ *
+ * @details multiplier is normally normalized to [2^30, 2^31) so it keeps
+ * 31 significant bits; shift < 0 scales up. tools/quantize.py
+ * (quantize_multiplier) derives both from a real scale offline.
+ */
+typedef struct {
+    int32_t multiplier;          /**< Q0.31 mantissa, > 0 */
+    int32_t shift;               /**< In [FX_Q8_SHIFT_MIN, FX_Q8_SHIFT_MAX] */
+} fx_requant_t;
+
+/**
+ * @brief Output stage of an int8 layer.
+ */
+typedef struct {
+    const int32_t* bias;         /**< Folded bias b' per output channel (fx_q8_fold_bias()), or NULL */
+    const fx_requant_t* channel; /**< Per-output-channel rescale, or NULL */
+    fx_requant_t tensor;         /**< Rescale used when channel is NULL */
+    int32_t out_zero_point;      /**< z_y */
+    int32_t act_min;             /**< Lower clamp in output units (>= -128) */
+    int32_t act_max;             /**< Upper clamp in output units (<= 127) */
+} fx_q8_params_t;
+
+/**
+ * @brief Apply a rescale with a single round-half-up.
+ *
+ * @details For |v| < 2^32 the product v · multiplier is exact in int64_t;
+ * adding half of 2^(31 + shift) before the arithmetic shift gives the same
+ * rounding as fixed_mul().
+ *
+ * @complexity O(1)
+ * @determinism Bit-perfect
+ */
+static inline int64_t fx_requant_apply(int64_t v, const fx_requant_t* r) {
+    const uint32_t s = (uint32_t)(31 + r->shift);
+    return (v * r->multiplier + ((int64_t)1 << (s - 1u))) >> s;
+}
+
+/**
+ * @brief Fold the input zero point into the bias: b'_j = b_j − z_x · Σ_k w_jk.
+ *
+ * @details Done once at load time, so the layer kernels multiply raw int8
+ * values and stay a plain int8 × int8 → int32 reduction. The result
+ * saturates to int32_t.
+ *
+ * @param[in] weights Weights (C_out × K, row per output channel)
+ * @param[in] in_zero_point z_x of the layer input
+ * @param[in] bias Raw int32 bias at scale s_x · s_w,j (C_out values), or NULL
+ * @param[out] folded Folded bias (C_out values)
+ *
+ * @complexity O(C_out × K)
+ * @determinism Bit-perfect
+ *
+ * @traceability SRS-009.4
+ */
+void fx_q8_fold_bias(const fx_q8_matrix_t* weights, int32_t in_zero_point,
+                     const int32_t* bias, int32_t* folded);
+
+/**
+ * @brief Fold an activation into the requantization clamp.
+ *
+ * @details Identity keeps [-128, 127]; ReLU raises act_min to z_y; ReLU6
+ * also lowers act_max to z_y + six. Other kinds are not representable as a
+ * clamp and leave params unchanged.
+ *
+ * @param[in,out] params Output stage (out_zero_point must be set)
+ * @param[in] kind FX_ACT_IDENTITY, FX_ACT_RELU or FX_ACT_RELU6
+ * @param[in] six 6.0 in output units, round(6 / s_y) (ReLU6 only)
+ *
+ * @traceability SRS-009.4
+ */
+void fx_q8_fold_activation(fx_q8_params_t* params, fx_activation_kind_t kind,
+                           int32_t six);
+
+/**
+ * @brief int8 GEMM: out = requant(in × Wᵀ + b').
+ *
+ * @param[in] in Input (N × K, int8 at s_x, z_x)
+ * @param[in] weights Weights (P × K, row per output channel)
+ * @param[in] params Folded bias, rescale, zero point and clamp
+ * @param[out] out Output (N × P, int8 at s_y, z_y)
+ *
+ * @pre K <= FX_Q8_MAX_DEPTH
+ * @post out contains the layer output if shapes and params are valid, unchanged otherwise
+ *
+ * @complexity O(N × K × P) time, O(1) space
+ * @determinism Bit-perfect across all platforms
+ *
+ * @traceability SRS-009.4, SRS-009.5
+ */
+void fx_q8_matrix_mul(const fx_q8_matrix_t* in, const fx_q8_matrix_t* weights,
+                      const fx_q8_params_t* params, fx_q8_matrix_t* out);
+
+/**
+ * @brief int8 convolution (valid padding, stride 1).
+ *
+ * @details Filter rows hold C_in × KH × KW weights in the order of
+ * in->layout (OIHW for NCHW, OHWI for NHWC), as for fx_qconv2d_tensor().
+ *
+ * @param[in] in Input (C_in × H × W)
+ * @param[in] filter Weights (C_out × (C_in · KH · KW))
+ * @param[in] k_h Kernel height
+ * @param[in] k_w Kernel width
+ * @param[in] params Folded bias, rescale, zero point and clamp
+ * @param[out] out Output (C_out × (H-KH+1) × (W-KW+1)), same layout as in
+ *
+ * @pre C_in · KH · KW <= FX_Q8_MAX_DEPTH
+ * @post out contains the convolution if shapes and params are valid, unchanged otherwise
+ *
+ * @complexity O(C_out × OH × OW × C_in × KH × KW) time, O(1) space
+ * @determinism Bit-perfect, identical across layouts
+ *
+ * @traceability SRS-009.4, SRS-009.5
+ */
+void fx_q8_conv2d(const fx_q8_tensor_t* in, const fx_q8_matrix_t* filter,
+                  uint32_t k_h, uint32_t k_w, const fx_q8_params_t* params,
+                  fx_q8_tensor_t* out);
+
+/**
+ * @brief Quantize Q16.16 values into int8: q = clamp(z + round(x · r), -128, 127).
+ *
+ * @details Entry into the int8 pipeline; r encodes 1 / (s · 2^16).
+ *
+ * @param[in] in Values (n)
+ * @param[in] n Number of values
+ * @param[in] r Rescale from Q16.16 to output units
+ * @param[in] zero_point z of the output
+ * @param[out] out int8 values (n)
+ *
+ * @traceability SRS-009.6
+ */
+void fx_q8_quantize(const fixed_t* in, size_t n, const fx_requant_t* r,
+                    int32_t zero_point, int8_t* out);
+
+/**
+ * @brief Dequantize int8 values into Q16.16: x = round((q − z) · r), saturating.
+ *
+ * @details Exit from the int8 pipeline; r encodes s · 2^16.
+ *
+ * @param[in] in int8 values (n)
+ * @param[in] n Number of values
+ * @param[in] r Rescale from input units to Q16.16
+ * @param[in] zero_point z of the input
+ * @param[out] out Q16.16 values (n)
+ *
+ * @traceability SRS-009.6
+ */
+void fx_q8_dequantize(const int8_t* in, size_t n, const fx_requant_t* r,
+                      int32_t zero_point, fixed_t* out);
+
+#endif /* QINT8_H */
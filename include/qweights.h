@@ -0,0 +1,151 @@
+/**
+ * @file qweights.h
+ * @project Certifiable Inference Engine
+ * @brief Mixed-precision layers: int8/int16 weights, Q16.16 activations.
+ *
+ * @details Weights are stored as narrow integers q with a power-of-two
+ * scale, w = q · 2^-f, where f ("fraction bits") is given per tensor or per
+ * output channel. Each output is the exact int64_t sum Σ x · q in
+ * Q(16 + f) with the bias folded in at the same scale, rounded once to
+ * Q16.16. For f <= 16 this is the Q32.32 accumulator of fx_matrix_mul()
+ * divided by 2^(16 - f), so the result is bit-identical to running the
+ * fixed_t layer with weights q << (16 - f).
+ *
+ * Weights are stored one row per output channel (rows × cols = outputs ×
+ * inputs), the layout of PyTorch nn.Linear and nn.Conv2d; each output is
+ * then one contiguous stream over its weights. tools/quantize.py --int8 /
+ * --int16 exports this format.
+ *
+ * The dot products run in int32_t instead of int64_t when that is proven
+ * exact: every partial sum of Σ x · q is bounded by max|x| · Σ|q|, so with
+ * the largest row L1 norm l1_max from the quantizer and the largest input
+ * magnitude, measured once per call, the kernel picks the int32_t path
+ * only when max|x| · l1_max <= INT32_MAX. Integer sums are exact on both
+ * paths, so the choice never changes a result.
+ *
+ * Selection deliberately uses the measured input rather than a calibrated
+ * activation range: an input outside the calibration set then falls back
+ * to int64_t instead of overflowing. The scan is O(K) per input row for
+ * dense and O(C_in · H · W) per call for convolution, against
+ * O(K · P) and O(C_out · OH · OW · C_in · KH · KW) multiply-adds.
+ * tools/quantize.py --act-range only reports the calibrated bound.
+ *
+ * @traceability SRS-009-QUANTIZATION
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef QWEIGHTS_H
+#define QWEIGHTS_H
+
+#include "matrix.h"
+#include "tensor.h"
+#include "activations.h"
+#include <stdint.h>
+
+/** @brief Largest supported fraction bits (keeps bias · 2^f well inside int64_t) */
+#define FX_QW_MAX_FRAC 24u
+
+/** @brief Longest reduction for which Σ x·q cannot overflow int64_t (2^16 · 2^31 · 2^15) */
+#define FX_QW_MAX_DEPTH 65536u
+
+/**
+ * @brief Storage type of quantized weights.
+ */
+typedef enum {
+    FX_QW_INT8 = 0,              /**< int8_t, 4× less traffic than fixed_t */
+    FX_QW_INT16                  /**< int16_t, 2× less traffic than fixed_t */
+} fx_qw_type_t;
+
+/**
+ * @brief Quantized weight matrix, one row per output channel.
+ *
+ * @note Memory managed by caller - no dynamic allocation.
+ */
+typedef struct {
+    const void* data;            /**< int8_t or int16_t values, row-major rows × cols */
+    fx_qw_type_t type;           /**< Element type of data */
+    uint32_t rows;               /**< Output channels */
+    uint32_t cols;               /**< Inputs per output channel */
+    const uint8_t* frac_bits;    /**< Per-output-channel f (rows entries), or NULL */
+    uint8_t frac;                /**< Per-tensor f, used when frac_bits is NULL */
+    uint32_t l1_max;             /**< max_j Σ_k |q[j][k]|, or 0 if unknown (int64_t sums only) */
+} fx_qweights_t;
+
+/**
+ * @brief Fraction bits of output channel o.
+ *
+ * @complexity O(1)
+ */
+static inline uint32_t fx_qweights_frac(const fx_qweights_t* w, size_t o) {
+    return (w->frac_bits != NULL) ? w->frac_bits[o] : w->frac;
+}
+
+/**
+ * @brief Dense layer with quantized weights: out = act(in × Wᵀ + bias).
+ *
+ * @details out[i][j] = round(Σ_k in[i][k] · q[j][k] / 2^f_j) + bias[j],
+ * computed as one exact int64_t sum with the bias folded in, a single
+ * rounding and the activation applied before the store. With one input
+ * row this is a GEMV that streams each weight row exactly once.
+ *
+ * @param[in] in Input activations (N × K)
+ * @param[in] weights Quantized weights (P × K, row per output)
+ * @param[in] bias Bias row vector (1 × P), or NULL
+ * @param[in] act Activation, or NULL for identity
+ * @param[out] out Output activations (N × P)
+ *
+ * @pre weights->cols == in->cols, out is in->rows × weights->rows
+ * @pre every fraction-bit count <= FX_QW_MAX_FRAC
+ * @pre K <= FX_QW_MAX_DEPTH, so the int64_t sum cannot overflow
+ * @pre weights->l1_max is 0 or at least every row's Σ|q|
+ * @pre out does not overlap in
+ * @post out contains the layer output if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(N × K × P) time, O(1) space
+ * @determinism Bit-perfect; equal to fx_dense_forward() with weights
+ *              (q << (16 - f))ᵀ whenever f <= 16
+ *
+ * @traceability SRS-009.1, SRS-009.2
+ */
+void fx_qdense_forward(const fx_matrix_t* in, const fx_qweights_t* weights,
+                       const fx_matrix_t* bias, const fx_activation_t* act,
+                       fx_matrix_t* out);
+
+/**
+ * @brief Multi-channel convolution with quantized weights (valid padding, stride 1).
+ *
+ * @details Same sum as fx_conv2d_tensor(), with weights q · 2^-f_o. Each
+ * filter row holds C_in × KH × KW weights in the order of in->layout:
+ * OIHW, w[o][c][ky][kx], for NCHW and OHWI, w[o][ky][kx][c], for NHWC (as
+ * fx_filter_index()). For NHWC the KW × C_in weights of a kernel row and
+ * the matching input run are both contiguous.
+ *
+ * @param[in] in Input (C_in × H × W)
+ * @param[in] filter Quantized filter bank (C_out × (C_in · KH · KW))
+ * @param[in] k_h Kernel height
+ * @param[in] k_w Kernel width
+ * @param[in] bias Bias row vector (1 × C_out), or NULL
+ * @param[out] out Output (C_out × (H-KH+1) × (W-KW+1)), same layout as in
+ *
+ * @pre every fraction-bit count <= FX_QW_MAX_FRAC
+ * @pre C_in · KH · KW <= FX_QW_MAX_DEPTH, so the int64_t sum cannot overflow
+ * @pre filter->l1_max is 0 or at least every row's Σ|q|
+ * @pre out does not overlap in
+ * @post out contains the convolution if all shapes are valid, unchanged otherwise
+ *
+ * @complexity O(C_out × OH × OW × C_in × KH × KW) time, O(1) space
+ * @determinism Bit-perfect, identical across layouts; equal to
+ *              fx_conv2d_tensor() with weights q << (16 - f) whenever f <= 16
+ *
+ * @traceability SRS-009.1, SRS-009.3
+ */
+void fx_qconv2d_tensor(const fx_tensor_t* in, const fx_qweights_t* filter,
+                       uint32_t k_h, uint32_t k_w,
+                       const fx_matrix_t* bias, fx_tensor_t* out);
+
+#endif /* QWEIGHTS_H */
@@ -0,0 +1,141 @@
+/**
+ * @file streaming.h
+ * @project Certifiable Inference Engine
+ * @brief Row-at-a-time (line-buffer) convolution and max pooling.
+ *
+ * @details Sensors that deliver a frame one scanline at a time need not be
+ * buffered in full. A streaming convolution keeps only the last KH input
+ * rows in a ring buffer and emits output row y as soon as input row
+ * y + KH − 1 arrives; a streaming 2×2 max-pool keeps one half-width row of
+ * pairwise maxima and emits on every second row. Stages are chained by
+ * pushing one stage's output row into the next.
+ *
+ * Every output row is bit-identical to the corresponding row of the
+ * whole-frame fx_conv2d() / fx_maxpool_2x2().
+ *
+ * @traceability SRS-006.17, SRS-008.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef STREAMING_H
+#define STREAMING_H
+
+#include "matrix.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/** @brief Ring buffer elements for a streaming convolution (KH rows) */
+#define FX_STREAM_CONV_RING_LEN(kh, in_w) ((size_t)(kh) * (size_t)(in_w))
+
+/** @brief Row buffer elements for a streaming 2×2 max-pool */
+#define FX_STREAM_POOL_ROW_LEN(in_w) ((size_t)(in_w) / 2u)
+
+/**
+ * @brief Streaming valid convolution state.
+ *
+ * @note kernel and ring are caller-owned and must outlive the stream.
+ */
+typedef struct {
+    const fx_matrix_t* kernel;   /**< KH×KW kernel; NULL if init failed */
+    fixed_t* ring;               /**< KH rows of in_w elements */
+    uint32_t in_w;               /**< Input row width */
+    uint32_t rows_in;            /**< Rows pushed since init/reset */
+} fx_stream_conv_t;
+
+/**
+ * @brief Streaming 2×2 stride-2 max-pool state.
+ */
+typedef struct {
+    fixed_t* pending;            /**< Pairwise maxima of the last even row */
+    uint32_t in_w;               /**< Input row width (even); 0 if init failed */
+    uint32_t rows_in;            /**< Rows pushed since init/reset */
+} fx_stream_pool_t;
+
+/**
+ * @brief Initialize a streaming convolution.
+ *
+ * @param[out] s Stream state
+ * @param[in] kernel Convolution kernel (KH×KW, KW <= in_w)
+ * @param[in] in_w Width of every input row
+ * @param[in] ring Ring buffer
+ * @param[in] ring_len Elements in ring, >= FX_STREAM_CONV_RING_LEN(KH, in_w)
+ *
+ * @post s ready for fx_stream_conv_push(); s->kernel is NULL on invalid input
+ *
+ * @complexity O(1)
+ *
+ * @traceability SRS-006.17
+ */
+void fx_stream_conv_init(fx_stream_conv_t* s, const fx_matrix_t* kernel,
+                         uint32_t in_w, fixed_t* ring, size_t ring_len);
+
+/**
+ * @brief Start a new frame (forget all buffered rows).
+ *
+ * @traceability SRS-006.17
+ */
+void fx_stream_conv_reset(fx_stream_conv_t* s);
+
+/**
+ * @brief Push one input row; emit an output row once KH rows are buffered.
+ *
+ * @details Output row y (0-based) is emitted by the push of input row
+ * y + KH − 1 and equals row y of fx_conv2d() on the whole frame.
+ *
+ * @param[in,out] s Stream state
+ * @param[in] row Input row (in_w elements); copied into the ring
+ * @param[out] out_row Output row (in_w − KW + 1 elements)
+ *
+ * @return 1 if out_row was written, 0 otherwise (warm-up or invalid input)
+ *
+ * @complexity O(in_w × KH × KW) per emitted row
+ * @determinism Bit-identical to fx_conv2d()
+ *
+ * @traceability SRS-006.3, SRS-006.4, SRS-006.17
+ */
+int fx_stream_conv_push(fx_stream_conv_t* s, const fixed_t* row, fixed_t* out_row);
+
+/**
+ * @brief Initialize a streaming 2×2 max-pool.
+ *
+ * @param[out] s Stream state
+ * @param[in] in_w Width of every input row (even)
+ * @param[in] pending Row buffer
+ * @param[in] pending_len Elements in pending, >= FX_STREAM_POOL_ROW_LEN(in_w)
+ *
+ * @post s ready for fx_stream_pool_push(); s->in_w is 0 on invalid input
+ *
+ * @traceability SRS-008.11
+ */
+void fx_stream_pool_init(fx_stream_pool_t* s, uint32_t in_w,
+                         fixed_t* pending, size_t pending_len);
+
+/**
+ * @brief Start a new frame.
+ *
+ * @traceability SRS-008.11
+ */
+void fx_stream_pool_reset(fx_stream_pool_t* s);
+
+/**
+ * @brief Push one input row; emit an output row on every second row.
+ *
+ * @param[in,out] s Stream state
+ * @param[in] row Input row (in_w elements)
+ * @param[out] out_row Output row (in_w / 2 elements)
+ *
+ * @return 1 if out_row was written, 0 otherwise
+ *
+ * @complexity O(in_w)
+ * @determinism Bit-identical to fx_maxpool_2x2()
+ *
+ * @traceability SRS-008.2, SRS-008.11
+ */
+int fx_stream_pool_push(fx_stream_pool_t* s, const fixed_t* row, fixed_t* out_row);
+
+#endif /* STREAMING_H */
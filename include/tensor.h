@@ -0,0 +1,108 @@
+/**
+ * @file tensor.h
+ * @project Certifiable Inference Engine
+ * @brief Three-dimensional (C × H × W) fixed-point feature maps.
+ *
+ * @details A tensor is one image (batch size 1) with an explicit memory
+ * layout. Channel-first (NCHW) keeps each channel plane contiguous, like a
+ * stack of fx_matrix_t. Channel-last (NHWC) keeps all channels of a pixel
+ * contiguous, which turns the channel reduction of a convolution into a
+ * unit-stride dot product.
+ *
+ * @traceability SRS-006.8
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef TENSOR_H
+#define TENSOR_H
+
+#include "fixed_point.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Memory layout of a tensor (batch dimension N is always 1).
+ */
+typedef enum {
+    FX_LAYOUT_NCHW = 0,          /**< [c][y][x]: channel planes */
+    FX_LAYOUT_NHWC               /**< [y][x][c]: interleaved channels */
+} fx_layout_t;
+
+/**
+ * @brief Feature map tensor.
+ *
+ * @note Memory managed by caller - no dynamic allocation.
+ */
+typedef struct {
+    fixed_t* data;               /**< Pointer to pre-allocated buffer */
+    uint32_t channels;           /**< Number of channels (C) */
+    uint32_t rows;               /**< Height (H) */
+    uint32_t cols;               /**< Width (W) */
+    fx_layout_t layout;          /**< Element order in data */
+} fx_tensor_t;
+
+/**
+ * @brief Initialize a tensor using a provided buffer (zeros buffer).
+ *
+ * @param[out] t Tensor structure to initialize
+ * @param[in] buffer Pre-allocated buffer of channels * rows * cols elements
+ * @param[in] channels Number of channels
+ * @param[in] rows Height
+ * @param[in] cols Width
+ * @param[in] layout Memory layout
+ *
+ * @pre t and buffer are valid pointers
+ * @post Tensor initialized and zeroed
+ *
+ * @complexity O(channels * rows * cols)
+ * @determinism Always produces same initial state
+ *
+ * @traceability SRS-003.1, SRS-006.8
+ */
+void fx_tensor_init(fx_tensor_t* t, fixed_t* buffer, uint32_t channels,
+                    uint32_t rows, uint32_t cols, fx_layout_t layout);
+
+/**
+ * @brief Attach a pre-populated buffer to a tensor (no zeroing).
+ *
+ * @traceability SRS-003.1, SRS-006.8
+ */
+static inline void fx_tensor_attach(fx_tensor_t* t, fixed_t* buffer,
+                                    uint32_t channels, uint32_t rows,
+                                    uint32_t cols, fx_layout_t layout) {
+    if (!t || !buffer) {
+        return;
+    }
+    t->data = buffer;
+    t->channels = channels;
+    t->rows = rows;
+    t->cols = cols;
+    t->layout = layout;
+}
+
+/**
+ * @brief Total number of elements.
+ */
+static inline size_t fx_tensor_size(const fx_tensor_t* t) {
+    return (size_t)t->channels * t->rows * t->cols;
+}
+
+/**
+ * @brief Element offset of (c, y, x) for the tensor's layout.
+ *
+ * @complexity O(1)
+ */
+static inline size_t fx_tensor_index(const fx_tensor_t* t, size_t c,
+                                     size_t y, size_t x) {
+    if (t->layout == FX_LAYOUT_NHWC) {
+        return (y * t->cols + x) * t->channels + c;
+    }
+    return (c * t->rows + y) * t->cols + x;
+}
+
+#endif /* TENSOR_H */
@@ -16,6 +16,8 @@
  */
 
 #include "activations.h"
+#include "gemm_kernels.h"
+#include "fixed_lut.h"
 
 void fx_relu(fx_matrix_t* mat) {
     /* SRS-004.1: Operate in-place to minimize memory footprint */
@@ -23,17 +25,9 @@ void fx_relu(fx_matrix_t* mat) {
         return;
     }
 
-    size_t total_elements = (size_t)mat->rows * mat->cols;
-
-    /* SRS-004.2: Deterministic max(0, x) implementation
-     * Sequential iteration ensures consistent behavior across platforms */
-    for (size_t i = 0; i < total_elements; i++) {
-        /* Simple comparison - deterministic on all architectures */
-        if (mat->data[i] < 0) {
-            mat->data[i] = FIXED_ZERO;
-        }
-        /* Positive values remain unchanged */
-    }
+    /* SRS-004.2: max(0, x) as a clamp - branch-free, same result everywhere */
+    fx_gemm_kernels()->clamp(mat->data, (size_t)mat->rows * mat->cols,
+                             FIXED_ZERO, FIXED_MAX);
 }
 
 void fx_leaky_relu(fx_matrix_t* mat, fixed_t alpha) {
@@ -42,14 +36,200 @@ void fx_leaky_relu(fx_matrix_t* mat, fixed_t alpha) {
         return;
     }
 
-    size_t total_elements = (size_t)mat->rows * mat->cols;
+    /* SRS-004.2 & SRS-004.4: fixed_mul() arithmetic, selected by sign mask */
+    fx_gemm_kernels()->leaky(mat->data, (size_t)mat->rows * mat->cols, alpha);
+}
+
+void fx_relu6(fx_matrix_t* mat) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    fx_gemm_kernels()->clamp(mat->data, (size_t)mat->rows * mat->cols,
+                             FIXED_ZERO, FX_RELU6_MAX);
+}
+
+void fx_clamp(fx_matrix_t* mat, fixed_t lo, fixed_t hi) {
+    if (!mat || !mat->data || lo > hi) {
+        return;
+    }
+
+    fx_gemm_kernels()->clamp(mat->data, (size_t)mat->rows * mat->cols, lo, hi);
+}
+
+void fx_sigmoid(fx_matrix_t* mat) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    const size_t n = (size_t)mat->rows * mat->cols;
+
+    /* SRS-004.11: evaluator inlined into the loop, no per-element call */
+    for (size_t i = 0; i < n; i++) {
+        mat->data[i] = fx_lut_sigmoid_eval(mat->data[i]);
+    }
+}
 
-    /* SRS-004.2 & SRS-004.4: Deterministic leaky ReLU with fixed-point multiply */
-    for (size_t i = 0; i < total_elements; i++) {
-        if (mat->data[i] < 0) {
-            /* Use fixed_mul from SRS-002 for deterministic multiplication */
-            mat->data[i] = fixed_mul(mat->data[i], alpha);
+void fx_tanh(fx_matrix_t* mat) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    const size_t n = (size_t)mat->rows * mat->cols;
+
+    for (size_t i = 0; i < n; i++) {
+        mat->data[i] = fx_lut_tanh_eval(mat->data[i]);
+    }
+}
+
+void fx_exp(fx_matrix_t* mat) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    const size_t n = (size_t)mat->rows * mat->cols;
+
+    for (size_t i = 0; i < n; i++) {
+        mat->data[i] = fx_lut_exp_eval(mat->data[i]);
+    }
+}
+
+/** @brief Fraction bits of the exponentials summed by softmax (8 beyond Q16.16) */
+#define SOFTMAX_EXP_Q 24u
+
+/**
+ * @brief Exact row maximum, then e^(x - max) in Q.24 for each element.
+ *
+ * @details Writes the exponentials to e (may alias row) when e is non-NULL
+ * and returns their int64_t sum, which is >= 2^24 because the maximum
+ * contributes exactly e^0. The extra 8 fraction bits keep the rounding of
+ * many small terms out of the normalized result. The maximum is a separate
+ * read-only scan: each exponent needs the final m to be exact.
+ */
+static int64_t softmax_exp_sum(const fixed_t* row, fixed_t* e, size_t n, fixed_t* max_out) {
+    fixed_t m = row[0];
+
+    for (size_t i = 1; i < n; i++) {
+        m = (row[i] > m) ? row[i] : m;
+    }
+
+    int64_t sum = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        /* x − max in (−2^32, 0]: the Q.46 product stays within int64_t
+         * and e^(x − max) <= 2^24 always fits */
+        const int64_t d = (int64_t)row[i] - m;
+        const fixed_t v = (fixed_t)fx_lut_exp_q(d * FX_LUT_LOG2E_Q30, SOFTMAX_EXP_Q);
+
+        if (e) {
+            e[i] = v;
+        }
+        sum += v;
+    }
+
+    *max_out = m;
+    return sum;
+}
+
+void fx_softmax(fx_matrix_t* mat) {
+    if (!mat || !mat->data || mat->cols == 0u) {
+        return;
+    }
+
+    const size_t n = mat->cols;
+
+    for (uint32_t r = 0; r < mat->rows; r++) {
+        fixed_t* row = &mat->data[(size_t)r * n];
+        fixed_t m;
+        const int64_t sum = softmax_exp_sum(row, row, n, &m);
+
+        /* SRS-004.6: one reciprocal per row. sum >= 2^24, so
+         * recip = 2^56 / sum <= 2^32 and e · recip <= 2^56 */
+        const int64_t recip = (((int64_t)1 << 56) + sum / 2) / sum;
+
+        for (size_t i = 0; i < n; i++) {
+            row[i] = (fixed_t)(((int64_t)row[i] * recip + ((int64_t)1 << 39)) >> 40);
+        }
+    }
+}
+
+void fx_log_softmax(fx_matrix_t* mat) {
+    if (!mat || !mat->data || mat->cols == 0u) {
+        return;
+    }
+
+    const size_t n = mat->cols;
+
+    for (uint32_t r = 0; r < mat->rows; r++) {
+        fixed_t* row = &mat->data[(size_t)r * n];
+        fixed_t m;
+        const int64_t sum = softmax_exp_sum(row, NULL, n, &m);
+
+        /* sum < cols · 2^24 < 2^56 */
+        const int64_t lse = fx_lut_ln_eval((uint64_t)sum, SOFTMAX_EXP_Q);
+
+        for (size_t i = 0; i < n; i++) {
+            const int64_t y = (int64_t)row[i] - m - lse;
+            row[i] = (y < FIXED_MIN) ? FIXED_MIN : (fixed_t)y;
         }
-        /* Positive values remain unchanged */
     }
 }
+
+void fx_activation_apply(const fx_activation_t* act, fixed_t* data, size_t n) {
+    if (!act || !data) {
+        return;
+    }
+
+    const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+
+    switch (act->kind) {
+        case FX_ACT_RELU:
+            kern->clamp(data, n, FIXED_ZERO, FIXED_MAX);
+            break;
+
+        case FX_ACT_LEAKY_RELU:
+            kern->leaky(data, n, act->alpha);
+            break;
+
+        case FX_ACT_RELU6:
+            kern->clamp(data, n, FIXED_ZERO, FX_RELU6_MAX);
+            break;
+
+        case FX_ACT_CLAMP:
+            if (act->lo <= act->hi) {
+                kern->clamp(data, n, act->lo, act->hi);
+            }
+            break;
+
+        case FX_ACT_SIGMOID:
+            for (size_t i = 0; i < n; i++) {
+                data[i] = fx_lut_sigmoid_eval(data[i]);
+            }
+            break;
+
+        case FX_ACT_TANH:
+            for (size_t i = 0; i < n; i++) {
+                data[i] = fx_lut_tanh_eval(data[i]);
+            }
+            break;
+
+        case FX_ACT_EXP:
+            for (size_t i = 0; i < n; i++) {
+                data[i] = fx_lut_exp_eval(data[i]);
+            }
+            break;
+
+        case FX_ACT_IDENTITY:
+        default:
+            break;
+    }
+}
+
+void fx_matrix_apply_activation(fx_matrix_t* mat, const fx_activation_t* act) {
+    if (!mat || !mat->data) {
+        return;
+    }
+
+    /* SRS-004.12: one switch per matrix, not one indirect call per element */
+    fx_activation_apply(act, mat->data, (size_t)mat->rows * mat->cols);
+}
@@ -16,6 +16,7 @@
  */
 
 #include "convolution.h"
+#include "gemm_kernels.h"
 
 void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* out) {
     /* SRS-006.1: Dimension validation */
@@ -29,8 +30,8 @@ void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* ou
     }
 
     /* Calculate expected output dimensions (valid padding) */
-    uint16_t expected_out_rows = in->rows - kernel->rows + 1;
-    uint16_t expected_out_cols = in->cols - kernel->cols + 1;
+    uint32_t expected_out_rows = in->rows - kernel->rows + 1u;
+    uint32_t expected_out_cols = in->cols - kernel->cols + 1u;
 
     /* Verify output buffer has correct dimensions */
     if (out->rows != expected_out_rows || out->cols != expected_out_cols) {
@@ -41,19 +42,19 @@ void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* ou
      * SRS-006.5: Bounded execution time (depends only on dimensions) */
 
     /* Iterate over each output position */
-    for (uint16_t out_row = 0; out_row < out->rows; out_row++) {
-        for (uint16_t out_col = 0; out_col < out->cols; out_col++) {
+    for (size_t out_row = 0; out_row < out->rows; out_row++) {
+        for (size_t out_col = 0; out_col < out->cols; out_col++) {
 
             /* SRS-006.3: 64-bit accumulator to prevent overflow */
             int64_t accumulator = 0;
 
             /* Sliding window: compute dot product of kernel with input patch */
-            for (uint16_t ker_row = 0; ker_row < kernel->rows; ker_row++) {
-                for (uint16_t ker_col = 0; ker_col < kernel->cols; ker_col++) {
+            for (size_t ker_row = 0; ker_row < kernel->rows; ker_row++) {
+                for (size_t ker_col = 0; ker_col < kernel->cols; ker_col++) {
 
                     /* Input position for this kernel element */
-                    uint16_t in_row = out_row + ker_row;
-                    uint16_t in_col = out_col + ker_col;
+                    size_t in_row = out_row + ker_row;
+                    size_t in_col = out_col + ker_col;
 
                     /* Get values (row-major layout) */
                     fixed_t input_val = in->data[in_row * in->cols + in_col];
@@ -72,3 +73,1005 @@ void fx_conv2d(const fx_matrix_t* in, const fx_matrix_t* kernel, fx_matrix_t* ou
         }
     }
 }
+
+/* ========================================================================
+ * Multi-channel convolution (SRS-006.8)
+ * ======================================================================== */
+
+/** @brief Output columns accumulated per NCHW row tile */
+#define CONV_TILE 64u
+
+/**
+ * @brief Shared shape validation for tensor convolutions.
+ */
+static int conv_tensor_shapes_valid(const fx_tensor_t* in,
+                                    const fx_conv_filter_t* filter,
+                                    const fx_matrix_t* bias,
+                                    const fx_tensor_t* out) {
+    if (!in || !filter || !out || !in->data || !filter->data || !out->data) {
+        return 0;
+    }
+
+    if (in->layout != filter->layout || in->layout != out->layout) {
+        return 0;
+    }
+
+    if (filter->in_channels != in->channels ||
+        filter->out_channels != out->channels) {
+        return 0;
+    }
+
+    if (filter->rows == 0u || filter->cols == 0u ||
+        filter->rows > in->rows || filter->cols > in->cols) {
+        return 0;
+    }
+
+    if (out->rows != in->rows - filter->rows + 1u ||
+        out->cols != in->cols - filter->cols + 1u) {
+        return 0;
+    }
+
+    if (bias && (!bias->data || bias->rows != 1u || bias->cols != out->channels)) {
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief NCHW: exact accumulators of output channel o, row y, columns
+ * x0..x0+width−1, starting from acc0 (bias).
+ */
+static void conv_nchw_tile(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                           size_t o, size_t y, size_t x0, size_t width,
+                           int64_t acc0, int64_t* acc) {
+    const size_t in_h = in->rows;
+    const size_t in_w = in->cols;
+    const size_t c_in = in->channels;
+    const size_t k_h = filter->rows;
+    const size_t k_w = filter->cols;
+
+    for (size_t x = 0; x < width; x++) {
+        acc[x] = acc0;
+    }
+
+    /* SRS-006.3: one int64_t accumulator per output across all
+     * input channels and taps */
+    for (size_t i = 0; i < c_in; i++) {
+        for (size_t ky = 0; ky < k_h; ky++) {
+            const fixed_t* in_row = &in->data[(i * in_h + y + ky) * in_w + x0];
+            const fixed_t* w_row = &filter->data[((o * c_in + i) * k_h + ky) * k_w];
+
+            for (size_t kx = 0; kx < k_w; kx++) {
+                const int64_t w = w_row[kx];
+                for (size_t x = 0; x < width; x++) {
+                    acc[x] += w * in_row[x + kx];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief NHWC: exact accumulator of output channel o at (y, x).
+ */
+static int64_t conv_nhwc_point(const fx_gemm_kernels_t* kern, const fx_tensor_t* in,
+                               const fx_conv_filter_t* filter, size_t o,
+                               size_t y, size_t x, int64_t acc0) {
+    const size_t c_in = in->channels;
+    const size_t k_h = filter->rows;
+    const size_t span = filter->cols * c_in;   /* Contiguous inputs per kernel row */
+    int64_t acc = acc0;
+
+    for (size_t ky = 0; ky < k_h; ky++) {
+        acc += kern->dot(&in->data[((y + ky) * in->cols + x) * c_in],
+                         &filter->data[(o * k_h + ky) * span],
+                         span);
+    }
+    return acc;
+}
+
+static void conv_tensor_nchw(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                             const fx_matrix_t* bias, fx_tensor_t* out) {
+    const size_t out_h = out->rows;
+    const size_t out_w = out->cols;
+
+    for (size_t o = 0; o < out->channels; o++) {
+        const int64_t acc0 = bias ? (int64_t)bias->data[o] * FIXED_ONE : 0;
+
+        for (size_t y = 0; y < out_h; y++) {
+            fixed_t* out_row = &out->data[(o * out_h + y) * out_w];
+
+            for (size_t x0 = 0; x0 < out_w; x0 += CONV_TILE) {
+                const size_t width = (out_w - x0 < CONV_TILE) ? out_w - x0 : CONV_TILE;
+                int64_t acc[CONV_TILE];
+
+                conv_nchw_tile(in, filter, o, y, x0, width, acc0, acc);
+
+                /* SRS-006.4: single rounding step */
+                for (size_t x = 0; x < width; x++) {
+                    out_row[x0 + x] = (fixed_t)((acc[x] + FIXED_HALF) >> FIXED_SHIFT);
+                }
+            }
+        }
+    }
+}
+
+static void conv_tensor_nhwc(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                             const fx_matrix_t* bias, fx_tensor_t* out) {
+    const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+    const size_t c_out = out->channels;
+
+    for (size_t y = 0; y < out->rows; y++) {
+        for (size_t x = 0; x < out->cols; x++) {
+            fixed_t* out_px = &out->data[(y * out->cols + x) * c_out];
+
+            for (size_t o = 0; o < c_out; o++) {
+                const int64_t acc0 = bias ? (int64_t)bias->data[o] * FIXED_ONE : 0;
+                const int64_t acc = conv_nhwc_point(kern, in, filter, o, y, x, acc0);
+
+                out_px[o] = (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+            }
+        }
+    }
+}
+
+void fx_conv2d_tensor(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                      const fx_matrix_t* bias, fx_tensor_t* out) {
+    /* SRS-006.1: Dimension validation - safe failure mode */
+    if (!conv_tensor_shapes_valid(in, filter, bias, out)) {
+        return;
+    }
+
+    if (in->layout == FX_LAYOUT_NHWC) {
+        conv_tensor_nhwc(in, filter, bias, out);
+    } else {
+        conv_tensor_nchw(in, filter, bias, out);
+    }
+}
+
+/* ========================================================================
+ * Fused convolution + activation + 2×2 max-pool (SRS-006.18)
+ * ======================================================================== */
+
+/** @brief Max of two exact accumulators */
+static int64_t acc_max(int64_t a, int64_t b) {
+    return (a > b) ? a : b;
+}
+
+void fx_conv2d_act_maxpool(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                           const fx_matrix_t* bias, const fx_activation_t* act,
+                           fx_tensor_t* out) {
+    /* SRS-006.1: Validation - safe failure mode */
+    if (!out || out->rows > UINT32_MAX / 2u || out->cols > UINT32_MAX / 2u) {
+        return;
+    }
+
+    /* Full-resolution shape the unfused sequence would use */
+    const fx_tensor_t conv = {out->data, out->channels, out->rows * 2u,
+                              out->cols * 2u, out->layout};
+    if (!conv_tensor_shapes_valid(in, filter, bias, &conv)) {
+        return;
+    }
+
+    /* Only monotone activations commute with max; alpha <= 1 also keeps
+     * fixed_mul() from wrapping */
+    if (act && act->kind == FX_ACT_LEAKY_RELU &&
+        (act->alpha < 0 || act->alpha > FIXED_ONE)) {
+        return;
+    }
+
+    const size_t c_out = out->channels;
+    const size_t pool_h = out->rows;
+    const size_t pool_w = out->cols;
+
+    if (in->layout == FX_LAYOUT_NHWC) {
+        const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+
+        for (size_t py = 0; py < pool_h; py++) {
+            for (size_t px = 0; px < pool_w; px++) {
+                fixed_t* out_px = &out->data[(py * pool_w + px) * c_out];
+
+                for (size_t o = 0; o < c_out; o++) {
+                    const int64_t acc0 = bias ? (int64_t)bias->data[o] * FIXED_ONE : 0;
+                    const size_t y = 2u * py;
+                    const size_t x = 2u * px;
+                    const int64_t m =
+                        acc_max(acc_max(conv_nhwc_point(kern, in, filter, o, y, x, acc0),
+                                        conv_nhwc_point(kern, in, filter, o, y, x + 1u, acc0)),
+                                acc_max(conv_nhwc_point(kern, in, filter, o, y + 1u, x, acc0),
+                                        conv_nhwc_point(kern, in, filter, o, y + 1u, x + 1u, acc0)));
+
+                    out_px[o] = (fixed_t)((m + FIXED_HALF) >> FIXED_SHIFT);
+                }
+                fx_activation_apply(act, out_px, c_out);
+            }
+        }
+        return;
+    }
+
+    for (size_t o = 0; o < c_out; o++) {
+        const int64_t acc0 = bias ? (int64_t)bias->data[o] * FIXED_ONE : 0;
+
+        for (size_t py = 0; py < pool_h; py++) {
+            fixed_t* out_row = &out->data[(o * pool_h + py) * pool_w];
+
+            /* CONV_TILE is even, so no 2×2 window straddles two tiles */
+            for (size_t x0 = 0; x0 < 2u * pool_w; x0 += CONV_TILE) {
+                const size_t width = (2u * pool_w - x0 < CONV_TILE) ? 2u * pool_w - x0 : CONV_TILE;
+                int64_t top[CONV_TILE];
+                int64_t bottom[CONV_TILE];
+
+                conv_nchw_tile(in, filter, o, 2u * py, x0, width, acc0, top);
+                conv_nchw_tile(in, filter, o, 2u * py + 1u, x0, width, acc0, bottom);
+
+                for (size_t x = 0; x < width; x += 2u) {
+                    const int64_t m = acc_max(acc_max(top[x], top[x + 1u]),
+                                              acc_max(bottom[x], bottom[x + 1u]));
+
+                    /* SRS-006.4: rounding is monotone, so round(max) = max(round) */
+                    out_row[(x0 + x) / 2u] = (fixed_t)((m + FIXED_HALF) >> FIXED_SHIFT);
+                }
+                fx_activation_apply(act, &out_row[x0 / 2u], width / 2u);
+            }
+        }
+    }
+}
+
+/* ========================================================================
+ * im2col + GEMM (SRS-006.11)
+ * ======================================================================== */
+
+/**
+ * @brief NCHW lowering: col[(i, ky, kx)][(y, x)] = in[i][y+ky][x+kx]
+ */
+static void im2col_nchw(const fx_tensor_t* in, size_t k_h, size_t k_w,
+                        size_t out_h, size_t out_w, fixed_t* col) {
+    const size_t positions = out_h * out_w;
+    size_t row = 0;
+
+    for (size_t i = 0; i < in->channels; i++) {
+        for (size_t ky = 0; ky < k_h; ky++) {
+            for (size_t kx = 0; kx < k_w; kx++) {
+                fixed_t* dst = &col[row * positions];
+
+                for (size_t y = 0; y < out_h; y++) {
+                    const fixed_t* src = &in->data[(i * in->rows + y + ky) * in->cols + kx];
+                    for (size_t x = 0; x < out_w; x++) {
+                        dst[y * out_w + x] = src[x];
+                    }
+                }
+                row++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief NHWC lowering: row (y, x) = in[y+ky][x..x+KW][0..C_in] for each ky
+ */
+static void im2col_nhwc(const fx_tensor_t* in, size_t k_h, size_t k_w,
+                        size_t out_h, size_t out_w, fixed_t* col) {
+    const size_t span = k_w * in->channels;
+    fixed_t* dst = col;
+
+    for (size_t y = 0; y < out_h; y++) {
+        for (size_t x = 0; x < out_w; x++) {
+            for (size_t ky = 0; ky < k_h; ky++) {
+                const fixed_t* src = &in->data[((y + ky) * in->cols + x) * in->channels];
+                for (size_t e = 0; e < span; e++) {
+                    dst[e] = src[e];
+                }
+                dst += span;
+            }
+        }
+    }
+}
+
+void fx_conv2d_im2col(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                      const fx_matrix_t* bias, fx_tensor_t* out,
+                      fixed_t* scratch, size_t scratch_len) {
+    /* SRS-006.1: Dimension validation - safe failure mode */
+    if (!conv_tensor_shapes_valid(in, filter, bias, out) || !scratch) {
+        return;
+    }
+
+    const size_t k_h = filter->rows;
+    const size_t k_w = filter->cols;
+    const size_t out_h = out->rows;
+    const size_t out_w = out->cols;
+    const size_t positions = out_h * out_w;
+    const size_t patch = (size_t)in->channels * k_h * k_w;
+    const size_t c_out = out->channels;
+
+    if (scratch_len < patch * positions) {
+        return;
+    }
+
+    if (in->layout == FX_LAYOUT_NHWC) {
+        const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+
+        im2col_nhwc(in, k_h, k_w, out_h, out_w, scratch);
+
+        for (size_t p = 0; p < positions; p++) {
+            const fixed_t* col_row = &scratch[p * patch];
+            fixed_t* out_px = &out->data[p * c_out];
+
+            for (size_t o = 0; o < c_out; o++) {
+                int64_t acc = bias ? (int64_t)bias->data[o] * FIXED_ONE : 0;
+
+                acc += kern->dot(col_row, &filter->data[o * patch], patch);
+                out_px[o] = (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+            }
+        }
+    } else {
+        fx_matrix_t w_mat, col_mat, out_mat;
+
+        im2col_nchw(in, k_h, k_w, out_h, out_w, scratch);
+
+        /* Views only: OIHW weights and NCHW output are already row-major */
+        fx_matrix_attach(&w_mat, filter->data, filter->out_channels, (uint32_t)patch);
+        fx_matrix_attach(&col_mat, scratch, (uint32_t)patch, (uint32_t)positions);
+        fx_matrix_attach(&out_mat, out->data, out->channels, (uint32_t)positions);
+
+        fx_matrix_mul(&w_mat, &col_mat, &out_mat);
+
+        /* Per-channel bias after the single rounding (exact, see header) */
+        if (bias) {
+            for (size_t o = 0; o < c_out; o++) {
+                fixed_t* plane = &out->data[o * positions];
+                for (size_t p = 0; p < positions; p++) {
+                    plane[p] = fixed_add(plane[p], bias->data[o]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief NCHW lowering by rows: row (y, x) = in[0..C_in][y+ky][x+kx] in OIHW order
+ */
+static void im2row_nchw(const fx_tensor_t* in, size_t k_h, size_t k_w,
+                        size_t out_h, size_t out_w, fixed_t* rows) {
+    fixed_t* dst = rows;
+
+    for (size_t y = 0; y < out_h; y++) {
+        for (size_t x = 0; x < out_w; x++) {
+            for (size_t i = 0; i < in->channels; i++) {
+                for (size_t ky = 0; ky < k_h; ky++) {
+                    const fixed_t* src = &in->data[(i * in->rows + y + ky) * in->cols + x];
+                    for (size_t kx = 0; kx < k_w; kx++) {
+                        dst[kx] = src[kx];
+                    }
+                    dst += k_w;
+                }
+            }
+        }
+    }
+}
+
+void fx_conv2d_im2col_packed(const fx_tensor_t* in, const fx_packed_weights_t* filter,
+                             uint32_t k_h, uint32_t k_w, const fx_matrix_t* bias,
+                             fx_tensor_t* out, fixed_t* scratch, size_t scratch_len) {
+    /* SRS-006.1: Dimension validation - safe failure mode */
+    if (!in || !filter || !out || !scratch || !in->data || !filter->data || !out->data) {
+        return;
+    }
+
+    if (in->layout != out->layout || k_h == 0u || k_w == 0u ||
+        k_h > in->rows || k_w > in->cols) {
+        return;
+    }
+
+    const size_t patch = (size_t)in->channels * k_h * k_w;
+
+    if ((size_t)filter->rows != patch || filter->cols != out->channels) {
+        return;
+    }
+
+    if (out->rows != in->rows - k_h + 1u || out->cols != in->cols - k_w + 1u) {
+        return;
+    }
+
+    if (bias && (!bias->data || bias->rows != 1u || bias->cols != out->channels)) {
+        return;
+    }
+
+    const size_t out_h = out->rows;
+    const size_t out_w = out->cols;
+    const size_t positions = out_h * out_w;
+
+    if (scratch_len < patch * positions) {
+        return;
+    }
+
+    fx_matrix_t row_mat;
+    fx_matrix_attach(&row_mat, scratch, (uint32_t)positions, (uint32_t)patch);
+
+    if (in->layout == FX_LAYOUT_NHWC) {
+        /* positions × C_out is the NHWC output itself */
+        im2col_nhwc(in, k_h, k_w, out_h, out_w, scratch);
+        fx_gemm_packed(&row_mat, filter, bias ? bias->data : NULL, NULL,
+                       out->data, out->channels, 1u);
+    } else {
+        /* Output channel o of position p lands in plane o */
+        im2row_nchw(in, k_h, k_w, out_h, out_w, scratch);
+        fx_gemm_packed(&row_mat, filter, bias ? bias->data : NULL, NULL,
+                       out->data, 1u, positions);
+    }
+}
+
+/* ========================================================================
+ * Stride, dilation and implicit padding (SRS-006.7, .9, .10)
+ * ======================================================================== */
+
+uint32_t fx_conv_output_dim(uint32_t in, uint32_t k, uint32_t stride,
+                            uint32_t dilation, uint32_t pad_before,
+                            uint32_t pad_after) {
+    if (k == 0u || stride == 0u || dilation == 0u) {
+        return 0;
+    }
+
+    const uint64_t padded = (uint64_t)in + pad_before + pad_after;
+    const uint64_t window = (uint64_t)dilation * (k - 1u) + 1u;
+
+    if (padded < window) {
+        return 0;
+    }
+
+    return (uint32_t)((padded - window) / stride + 1u);
+}
+
+/**
+ * @brief Per-call state shared by the strided convolution helpers.
+ */
+typedef struct {
+    const fx_tensor_t* in;
+    const fx_conv_filter_t* filter;
+    const fx_matrix_t* bias;
+    const fx_conv_params_t* params;
+    fx_tensor_t* out;
+    const fx_gemm_kernels_t* kern;
+} conv_ex_ctx_t;
+
+/**
+ * @brief Taps k in [*begin, *end) with 0 <= origin + k·dil < extent.
+ */
+static void conv_tap_range(int64_t origin, size_t k, size_t dil, size_t extent,
+                           size_t* begin, size_t* end) {
+    const int64_t last = (int64_t)extent - 1 - origin;
+    size_t b = 0;
+    size_t e = k;
+
+    if (origin < 0) {
+        b = (size_t)((-origin + (int64_t)dil - 1) / (int64_t)dil);
+    }
+    if (last < 0) {
+        e = 0;
+    } else if ((size_t)last / dil + 1u < e) {
+        e = (size_t)last / dil + 1u;
+    }
+
+    *begin = (b < e) ? b : e;
+    *end = e;
+}
+
+/**
+ * @brief Outputs [*lo, *hi) along one axis whose whole window is in bounds.
+ */
+static void conv_interior(size_t out_n, size_t in_n, size_t k, size_t stride,
+                          size_t dil, size_t pad, size_t* lo, size_t* hi) {
+    const size_t span = dil * (k - 1u);
+    size_t l = (pad + stride - 1u) / stride;
+    size_t h = 0;
+
+    if (in_n + pad >= span + 1u) {
+        h = (in_n + pad - span - 1u) / stride + 1u;
+    }
+
+    if (l > out_n) {
+        l = out_n;
+    }
+    if (h > out_n) {
+        h = out_n;
+    }
+    *lo = l;
+    *hi = (h > l) ? h : l;
+}
+
+/**
+ * @brief Exact Σ over channels and taps [ky_b, ky_e) × [kx_b, kx_e) for
+ * output channel o whose window starts at input (iy0, ix0).
+ */
+static int64_t conv_ex_point(const conv_ex_ctx_t* c, size_t o,
+                             int64_t iy0, int64_t ix0,
+                             size_t ky_b, size_t ky_e,
+                             size_t kx_b, size_t kx_e) {
+    const fx_tensor_t* in = c->in;
+    const fx_conv_filter_t* f = c->filter;
+    const size_t dh = c->params->dilation_h;
+    const size_t dw = c->params->dilation_w;
+    const size_t c_in = in->channels;
+    const size_t k_h = f->rows;
+    const size_t k_w = f->cols;
+    int64_t acc = 0;
+
+    if (kx_b >= kx_e) {
+        return 0;
+    }
+
+    if (in->layout == FX_LAYOUT_NHWC) {
+        for (size_t ky = ky_b; ky < ky_e; ky++) {
+            const size_t iy = (size_t)(iy0 + (int64_t)(ky * dh));
+            const fixed_t* w_row = &f->data[(o * k_h + ky) * k_w * c_in];
+
+            if (dw == 1u) {
+                /* Adjacent taps are contiguous: one dot over the run */
+                const size_t ix = (size_t)(ix0 + (int64_t)kx_b);
+                acc += c->kern->dot(&in->data[(iy * in->cols + ix) * c_in],
+                                    &w_row[kx_b * c_in], (kx_e - kx_b) * c_in);
+            } else {
+                for (size_t kx = kx_b; kx < kx_e; kx++) {
+                    const size_t ix = (size_t)(ix0 + (int64_t)(kx * dw));
+                    acc += c->kern->dot(&in->data[(iy * in->cols + ix) * c_in],
+                                        &w_row[kx * c_in], c_in);
+                }
+            }
+        }
+    } else {
+        for (size_t i = 0; i < c_in; i++) {
+            for (size_t ky = ky_b; ky < ky_e; ky++) {
+                const size_t iy = (size_t)(iy0 + (int64_t)(ky * dh));
+                const fixed_t* in_row = &in->data[(i * in->rows + iy) * in->cols];
+                const fixed_t* w_row = &f->data[((o * c_in + i) * k_h + ky) * k_w];
+
+                for (size_t kx = kx_b; kx < kx_e; kx++) {
+                    const size_t ix = (size_t)(ix0 + (int64_t)(kx * dw));
+                    acc += (int64_t)in_row[ix] * w_row[kx];
+                }
+            }
+        }
+    }
+
+    return acc;
+}
+
+/**
+ * @brief Outputs (y, x) for x in [x_b, x_e); clip selects border handling.
+ */
+static void conv_ex_span(const conv_ex_ctx_t* c, size_t y, size_t ky_b, size_t ky_e,
+                         size_t x_b, size_t x_e, int clip) {
+    const fx_conv_params_t* p = c->params;
+    fx_tensor_t* out = c->out;
+    const int64_t iy0 = (int64_t)(y * p->stride_h) - (int64_t)p->pad_top;
+
+    for (size_t x = x_b; x < x_e; x++) {
+        const int64_t ix0 = (int64_t)(x * p->stride_w) - (int64_t)p->pad_left;
+        size_t kx_b = 0;
+        size_t kx_e = c->filter->cols;
+
+        if (clip) {
+            conv_tap_range(ix0, c->filter->cols, p->dilation_w, c->in->cols, &kx_b, &kx_e);
+        }
+
+        for (size_t o = 0; o < out->channels; o++) {
+            int64_t acc = c->bias ? (int64_t)c->bias->data[o] * FIXED_ONE : 0;
+
+            acc += conv_ex_point(c, o, iy0, ix0, ky_b, ky_e, kx_b, kx_e);
+
+            /* SRS-006.4: single rounding step */
+            out->data[fx_tensor_index(out, o, y, x)] =
+                (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+        }
+    }
+}
+
+void fx_conv2d_tensor_ex(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                         const fx_matrix_t* bias, const fx_conv_params_t* params,
+                         fx_tensor_t* out) {
+    /* SRS-006.1: Validation - safe failure mode */
+    if (!in || !filter || !params || !out || !in->data || !filter->data || !out->data) {
+        return;
+    }
+
+    if (in->layout != filter->layout || in->layout != out->layout ||
+        filter->in_channels != in->channels || filter->out_channels != out->channels) {
+        return;
+    }
+
+    const uint32_t out_h = fx_conv_output_dim(in->rows, filter->rows, params->stride_h,
+                                              params->dilation_h, params->pad_top,
+                                              params->pad_bottom);
+    const uint32_t out_w = fx_conv_output_dim(in->cols, filter->cols, params->stride_w,
+                                              params->dilation_w, params->pad_left,
+                                              params->pad_right);
+
+    if (out_h == 0u || out_w == 0u || out->rows != out_h || out->cols != out_w) {
+        return;
+    }
+
+    if (bias && (!bias->data || bias->rows != 1u || bias->cols != out->channels)) {
+        return;
+    }
+
+    const conv_ex_ctx_t c = {in, filter, bias, params, out, fx_gemm_kernels()};
+    size_t x_lo, x_hi;
+
+    conv_interior(out_w, in->cols, filter->cols, params->stride_w,
+                  params->dilation_w, params->pad_left, &x_lo, &x_hi);
+
+    /* SRS-006.5: Bounded execution - iteration counts depend on shapes only */
+    for (size_t y = 0; y < out_h; y++) {
+        const int64_t iy0 = (int64_t)(y * params->stride_h) - (int64_t)params->pad_top;
+        size_t ky_b, ky_e;
+
+        conv_tap_range(iy0, filter->rows, params->dilation_h, in->rows, &ky_b, &ky_e);
+
+        /* Left border, unchecked interior, right border */
+        conv_ex_span(&c, y, ky_b, ky_e, 0, x_lo, 1);
+        conv_ex_span(&c, y, ky_b, ky_e, x_lo, x_hi, 0);
+        conv_ex_span(&c, y, ky_b, ky_e, x_hi, out_w, 1);
+    }
+}
+
+void fx_conv2d_ex(const fx_matrix_t* in, const fx_matrix_t* kernel,
+                  const fx_conv_params_t* params, fx_matrix_t* out) {
+    if (!in || !kernel || !out || !in->data || !kernel->data || !out->data) {
+        return;
+    }
+
+    fx_tensor_t in_t, out_t;
+    const fx_conv_filter_t f = {kernel->data, 1u, 1u, kernel->rows, kernel->cols,
+                                FX_LAYOUT_NCHW};
+
+    fx_tensor_attach(&in_t, in->data, 1u, in->rows, in->cols, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&out_t, out->data, 1u, out->rows, out->cols, FX_LAYOUT_NCHW);
+
+    fx_conv2d_tensor_ex(&in_t, &f, NULL, params, &out_t);
+}
+
+/* ========================================================================
+ * Depthwise and depthwise-separable convolution (SRS-006.12, .13)
+ * ======================================================================== */
+
+/**
+ * @brief Per-call state for depthwise rows.
+ */
+typedef struct {
+    const fx_tensor_t* in;
+    const fx_conv_filter_t* filter;
+    const fx_matrix_t* bias;
+    const fx_conv_params_t* params;
+    size_t in_cs;                /**< Input element stride between channels */
+    size_t in_ys;                /**< Input element stride between rows */
+    size_t in_xs;                /**< Input element stride between columns */
+    size_t x_lo;                 /**< First interior output column */
+    size_t x_hi;                 /**< One past the last interior column */
+    size_t out_w;
+} dw_ctx_t;
+
+/**
+ * @brief Validate the depthwise part of a layer and compute its output size.
+ */
+static int dw_shapes_valid(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                           const fx_matrix_t* bias, const fx_conv_params_t* params,
+                           uint32_t* out_h, uint32_t* out_w) {
+    if (!in || !filter || !params || !in->data || !filter->data) {
+        return 0;
+    }
+
+    if (filter->layout != in->layout || filter->in_channels != 1u ||
+        filter->out_channels != in->channels) {
+        return 0;
+    }
+
+    if (bias && (!bias->data || bias->rows != 1u || bias->cols != in->channels)) {
+        return 0;
+    }
+
+    *out_h = fx_conv_output_dim(in->rows, filter->rows, params->stride_h,
+                                params->dilation_h, params->pad_top, params->pad_bottom);
+    *out_w = fx_conv_output_dim(in->cols, filter->cols, params->stride_w,
+                                params->dilation_w, params->pad_left, params->pad_right);
+
+    return (*out_h != 0u && *out_w != 0u);
+}
+
+static void dw_ctx_init(dw_ctx_t* c, const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                        const fx_matrix_t* bias, const fx_conv_params_t* params,
+                        size_t out_w) {
+    c->in = in;
+    c->filter = filter;
+    c->bias = bias;
+    c->params = params;
+    c->out_w = out_w;
+
+    if (in->layout == FX_LAYOUT_NHWC) {
+        c->in_cs = 1u;
+        c->in_xs = in->channels;
+        c->in_ys = (size_t)in->cols * in->channels;
+    } else {
+        c->in_cs = (size_t)in->rows * in->cols;
+        c->in_xs = 1u;
+        c->in_ys = in->cols;
+    }
+
+    conv_interior(out_w, in->cols, filter->cols, params->stride_w,
+                  params->dilation_w, params->pad_left, &c->x_lo, &c->x_hi);
+}
+
+/**
+ * @brief Depthwise outputs x in [x_b, x_e) of one row into dst[c·cs + x·xs].
+ */
+static void dw_span(const dw_ctx_t* c, int64_t iy0, size_t ky_b, size_t ky_e,
+                    size_t x_b, size_t x_e, int clip,
+                    fixed_t* dst, size_t cs, size_t xs) {
+    const fx_conv_params_t* p = c->params;
+    const size_t k_h = c->filter->rows;
+    const size_t k_w = c->filter->cols;
+    const size_t channels = c->in->channels;
+
+    for (size_t x = x_b; x < x_e; x++) {
+        const int64_t ix0 = (int64_t)(x * p->stride_w) - (int64_t)p->pad_left;
+        size_t kx_b = 0;
+        size_t kx_e = k_w;
+
+        if (clip) {
+            conv_tap_range(ix0, k_w, p->dilation_w, c->in->cols, &kx_b, &kx_e);
+        }
+
+        for (size_t ch = 0; ch < channels; ch++) {
+            const fixed_t* in_c = &c->in->data[ch * c->in_cs];
+            const fixed_t* w_c = &c->filter->data[ch * k_h * k_w];
+            int64_t acc = c->bias ? (int64_t)c->bias->data[ch] * FIXED_ONE : 0;
+
+            for (size_t ky = ky_b; ky < ky_e; ky++) {
+                const size_t iy = (size_t)(iy0 + (int64_t)(ky * p->dilation_h));
+                const fixed_t* in_row = &in_c[iy * c->in_ys];
+
+                for (size_t kx = kx_b; kx < kx_e; kx++) {
+                    const size_t ix = (size_t)(ix0 + (int64_t)(kx * p->dilation_w));
+                    acc += (int64_t)in_row[ix * c->in_xs] * w_c[ky * k_w + kx];
+                }
+            }
+
+            dst[ch * cs + x * xs] = (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+        }
+    }
+}
+
+/**
+ * @brief One full depthwise output row y into dst[c·cs + x·xs].
+ */
+static void dw_row(const dw_ctx_t* c, size_t y, fixed_t* dst, size_t cs, size_t xs) {
+    const fx_conv_params_t* p = c->params;
+    const int64_t iy0 = (int64_t)(y * p->stride_h) - (int64_t)p->pad_top;
+    size_t ky_b, ky_e;
+
+    conv_tap_range(iy0, c->filter->rows, p->dilation_h, c->in->rows, &ky_b, &ky_e);
+
+    dw_span(c, iy0, ky_b, ky_e, 0, c->x_lo, 1, dst, cs, xs);
+    dw_span(c, iy0, ky_b, ky_e, c->x_lo, c->x_hi, 0, dst, cs, xs);
+    dw_span(c, iy0, ky_b, ky_e, c->x_hi, c->out_w, 1, dst, cs, xs);
+}
+
+void fx_conv2d_depthwise(const fx_tensor_t* in, const fx_conv_filter_t* filter,
+                         const fx_matrix_t* bias, const fx_conv_params_t* params,
+                         fx_tensor_t* out) {
+    uint32_t out_h, out_w;
+
+    /* SRS-006.1: Validation - safe failure mode */
+    if (!dw_shapes_valid(in, filter, bias, params, &out_h, &out_w)) {
+        return;
+    }
+
+    if (!out || !out->data || out->layout != in->layout ||
+        out->channels != in->channels || out->rows != out_h || out->cols != out_w) {
+        return;
+    }
+
+    dw_ctx_t c;
+    dw_ctx_init(&c, in, filter, bias, params, out_w);
+
+    for (size_t y = 0; y < out_h; y++) {
+        if (out->layout == FX_LAYOUT_NHWC) {
+            dw_row(&c, y, &out->data[y * out_w * out->channels], 1u, out->channels);
+        } else {
+            dw_row(&c, y, &out->data[y * out_w], (size_t)out_h * out_w, 1u);
+        }
+    }
+}
+
+void fx_conv2d_dwsep(const fx_tensor_t* in, const fx_dwsep_layer_t* layer,
+                     const fx_conv_params_t* params, fx_tensor_t* out,
+                     fixed_t* scratch, size_t scratch_len) {
+    uint32_t out_h, out_w;
+
+    /* SRS-006.1: Validation - safe failure mode */
+    if (!layer || !out || !out->data || !scratch) {
+        return;
+    }
+
+    if (!dw_shapes_valid(in, layer->dw_filter, layer->dw_bias, params, &out_h, &out_w)) {
+        return;
+    }
+
+    const fx_conv_filter_t* pw = layer->pw_filter;
+    const fx_matrix_t* pw_bias = layer->pw_bias;
+    const size_t channels = in->channels;
+
+    if (!pw || !pw->data || pw->layout != in->layout || out->layout != in->layout ||
+        pw->rows != 1u || pw->cols != 1u || pw->in_channels != in->channels ||
+        pw->out_channels != out->channels || out->rows != out_h || out->cols != out_w) {
+        return;
+    }
+
+    if (pw_bias && (!pw_bias->data || pw_bias->rows != 1u || pw_bias->cols != out->channels)) {
+        return;
+    }
+
+    if (scratch_len < FX_DWSEP_SCRATCH_LEN(channels, out_w)) {
+        return;
+    }
+
+    const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+    const size_t c_out = out->channels;
+    const size_t row_len = channels * out_w;
+    dw_ctx_t c;
+
+    dw_ctx_init(&c, in, layer->dw_filter, layer->dw_bias, params, out_w);
+
+    for (size_t y = 0; y < out_h; y++) {
+        if (in->layout == FX_LAYOUT_NHWC) {
+            /* Depthwise row as [x][c], stored and activated like a layer */
+            dw_row(&c, y, scratch, 1u, channels);
+            fx_activation_apply(layer->dw_act, scratch, row_len);
+
+            fixed_t* out_row = &out->data[y * out_w * c_out];
+            for (size_t x = 0; x < out_w; x++) {
+                for (size_t o = 0; o < c_out; o++) {
+                    int64_t acc = pw_bias ? (int64_t)pw_bias->data[o] * FIXED_ONE : 0;
+
+                    acc += kern->dot(&scratch[x * channels], &pw->data[o * channels], channels);
+                    out_row[x * c_out + o] = (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+                }
+            }
+            fx_activation_apply(layer->pw_act, out_row, out_w * c_out);
+        } else {
+            /* Depthwise row as [c][x] */
+            dw_row(&c, y, scratch, out_w, 1u);
+            fx_activation_apply(layer->dw_act, scratch, row_len);
+
+            for (size_t o = 0; o < c_out; o++) {
+                const int64_t acc0 = pw_bias ? (int64_t)pw_bias->data[o] * FIXED_ONE : 0;
+                const fixed_t* w_o = &pw->data[o * channels];
+                fixed_t* out_row = &out->data[((size_t)o * out_h + y) * out_w];
+
+                for (size_t x0 = 0; x0 < out_w; x0 += CONV_TILE) {
+                    const size_t width = (out_w - x0 < CONV_TILE) ? out_w - x0 : CONV_TILE;
+                    int64_t acc[CONV_TILE];
+
+                    for (size_t x = 0; x < width; x++) {
+                        acc[x] = acc0;
+                    }
+                    for (size_t ch = 0; ch < channels; ch++) {
+                        const int64_t w = w_o[ch];
+                        const fixed_t* src = &scratch[ch * out_w + x0];
+                        for (size_t x = 0; x < width; x++) {
+                            acc[x] += w * src[x];
+                        }
+                    }
+                    for (size_t x = 0; x < width; x++) {
+                        out_row[x0 + x] = (fixed_t)((acc[x] + FIXED_HALF) >> FIXED_SHIFT);
+                    }
+                }
+                fx_activation_apply(layer->pw_act, out_row, out_w);
+            }
+        }
+    }
+}
+
+/* ========================================================================
+ * Separable convolution (SRS-006.14)
+ * ======================================================================== */
+
+/** @brief Σ |data[i]| over n raw values (n < 2^32, so no wrap) */
+static uint64_t sep_abs_sum(const fixed_t* data, size_t n) {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        sum += (data[i] < 0) ? (uint64_t)(-(int64_t)data[i]) : (uint64_t)data[i];
+    }
+
+    return sum;
+}
+
+/** @brief a · b <= limit, without forming the product */
+static int sep_fits(uint64_t a, uint64_t b, uint64_t limit) {
+    return a == 0u || b <= limit / a;
+}
+
+void fx_conv2d_separable(const fx_matrix_t* in, const fx_matrix_t* col_kernel,
+                         const fx_matrix_t* row_kernel, uint32_t inter_frac_bits,
+                         fx_matrix_t* out, int64_t* scratch, size_t scratch_len) {
+    /* SRS-006.1: Validation - safe failure mode */
+    if (!in || !col_kernel || !row_kernel || !out || !scratch ||
+        !in->data || !col_kernel->data || !row_kernel->data || !out->data) {
+        return;
+    }
+
+    if (col_kernel->cols != 1u || row_kernel->rows != 1u ||
+        col_kernel->rows == 0u || row_kernel->cols == 0u ||
+        col_kernel->rows > in->rows || row_kernel->cols > in->cols) {
+        return;
+    }
+
+    if (out->rows != in->rows - col_kernel->rows + 1u ||
+        out->cols != in->cols - row_kernel->cols + 1u) {
+        return;
+    }
+
+    if (inter_frac_bits > FX_SEPARABLE_MAX_INTER_BITS ||
+        scratch_len < FX_SEPARABLE_SCRATCH_LEN(in->cols)) {
+        return;
+    }
+
+    const size_t in_w = in->cols;
+    const size_t k_h = col_kernel->rows;
+    const size_t k_w = row_kernel->cols;
+    const unsigned v_shift = FIXED_SHIFT - inter_frac_bits;
+    const unsigned h_shift = FIXED_SHIFT + inter_frac_bits;
+    const int64_t v_half = (v_shift > 0u) ? ((int64_t)1 << (v_shift - 1u)) : 0;
+    const int64_t h_half = (int64_t)1 << (h_shift - 1u);
+
+    /* SRS-006.14: Both int64_t passes must be provably exact for this data.
+     * |column sum| <= Σ|v| · max|in|, |row sum| <= (rounded column bound) · Σ|h|. */
+    uint64_t in_max = 0;
+    for (size_t i = 0; i < (size_t)in->rows * in_w; i++) {
+        const int64_t a = in->data[i];
+        const uint64_t m = (uint64_t)((a < 0) ? -a : a);
+        in_max = (m > in_max) ? m : in_max;
+    }
+
+    const uint64_t v_sum = sep_abs_sum(col_kernel->data, k_h);
+    const uint64_t h_sum = sep_abs_sum(row_kernel->data, k_w);
+
+    if (!sep_fits(v_sum, in_max, (uint64_t)(INT64_MAX - v_half))) {
+        return; /* Vertical sum could overflow */
+    }
+
+    const uint64_t t_max = ((v_sum * in_max) >> v_shift) + 1u;
+
+    if (!sep_fits(t_max, h_sum, (uint64_t)(INT64_MAX - h_half))) {
+        return; /* Horizontal sum could overflow */
+    }
+
+    for (size_t y = 0; y < out->rows; y++) {
+        /* Vertical pass: exact Q32.32 column sums, one rounding to Q(16+G) */
+        for (size_t x = 0; x < in_w; x++) {
+            scratch[x] = 0;
+        }
+        for (size_t ky = 0; ky < k_h; ky++) {
+            const int64_t v = col_kernel->data[ky];
+            const fixed_t* in_row = &in->data[(y + ky) * in_w];
+
+            for (size_t x = 0; x < in_w; x++) {
+                scratch[x] += v * in_row[x];
+            }
+        }
+        for (size_t x = 0; x < in_w; x++) {
+            scratch[x] = (scratch[x] + v_half) >> v_shift;
+        }
+
+        /* Horizontal pass: exact int64_t sum, single rounding to Q16.16 */
+        fixed_t* out_row = &out->data[y * out->cols];
+        for (size_t x = 0; x < out->cols; x++) {
+            int64_t acc = 0;
+
+            for (size_t kx = 0; kx < k_w; kx++) {
+                acc += scratch[x + kx] * row_kernel->data[kx];
+            }
+            out_row[x] = (fixed_t)((acc + h_half) >> h_shift);
+        }
+    }
+}
@@ -0,0 +1,296 @@
+/**
+ * @file cpu_dispatch.c
+ * @project Certifiable Inference Engine
+ * @brief CPU feature detection and self-checked kernel selection.
+ *
+ * @details Detects SSE4.1/AVX2 via cpuid (and OS YMM state support via
+ * xgetbv), then verifies each candidate kernel set bit-for-bit against the
+ * scalar reference before making it active.
+ *
+ * @traceability SRS-003.10
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "cpu_dispatch.h"
+#include "gemm_kernels.h"
+#include <string.h>
+
+#if FX_HAVE_X86_KERNELS
+#include <cpuid.h>
+#endif
+
+/** @brief Self-check vector length (covers SIMD bodies and scalar tails) */
+#define SELF_CHECK_LEN 160
+
+/** @brief Leading dimension of A used by the micro-kernel check */
+#define SELF_CHECK_LDA 37
+
+/** @brief Leading dimension of B used by the row-strip check */
+#define SELF_CHECK_LDB 11
+
+/** @brief Accumulator row stride used by the micro-kernel check */
+#define SELF_CHECK_LDACC 13
+
+static const fx_gemm_kernels_t* active_kernels = NULL;
+static fx_isa_t active_isa = FX_ISA_SCALAR;
+
+/**
+ * @brief Query whether the CPU and OS support an instruction-set level.
+ */
+static int isa_supported(fx_isa_t isa) {
+    if (isa == FX_ISA_SCALAR) {
+        return 1;
+    }
+
+#if FX_HAVE_X86_KERNELS
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return 0;
+    }
+
+    const int has_sse41 = (ecx & bit_SSE4_1) != 0;
+    if (isa == FX_ISA_SSE41) {
+        return has_sse41;
+    }
+
+    if (isa == FX_ISA_AVX2) {
+        /* AVX needs OSXSAVE and the OS must save XMM/YMM state (XCR0[2:1]) */
+        if ((ecx & bit_OSXSAVE) == 0 || (ecx & bit_AVX) == 0) {
+            return 0;
+        }
+
+        unsigned int xcr0_lo = 0, xcr0_hi = 0;
+        __asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        (void)xcr0_hi;
+        if ((xcr0_lo & 0x6u) != 0x6u) {
+            return 0;
+        }
+
+        if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+            return 0;
+        }
+        return (ebx & bit_AVX2) != 0;
+    }
+#endif
+
+    return 0;
+}
+
+/**
+ * @brief Kernel set for a level, or NULL if not compiled in.
+ */
+static const fx_gemm_kernels_t* kernels_for(fx_isa_t isa) {
+    switch (isa) {
+        case FX_ISA_SCALAR:
+            return &fx_gemm_kernels_scalar;
+#if FX_HAVE_X86_KERNELS
+        case FX_ISA_SSE41:
+            return &fx_gemm_kernels_sse41;
+        case FX_ISA_AVX2:
+            return &fx_gemm_kernels_avx2;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+/**
+ * @brief Fill self-check vectors with fixed pseudo-random data.
+ *
+ * @details Values span ±2^23 with one INT32_MIN × INT32_MIN and one
+ * INT32_MAX operand per vector, exercising sign extension in every lane
+ * position without overflowing the int64_t reference sum.
+ */
+static void fill_check_vector(fixed_t* v, size_t len, uint32_t seed) {
+    uint32_t state = seed;
+
+    for (size_t i = 0; i < len; i++) {
+        state = state * 1664525u + 1013904223u;
+        v[i] = (fixed_t)((int32_t)state >> 8);
+    }
+
+    v[0] = FIXED_MIN;
+    v[len / 2 + 3] = FIXED_MAX;
+}
+
+/**
+ * @brief Compare a candidate kernel set against the scalar reference.
+ *
+ * @return 1 if every check is bit-identical, 0 otherwise
+ */
+static int self_check(const fx_gemm_kernels_t* cand) {
+    static fixed_t a[SELF_CHECK_LEN];
+    static fixed_t b[SELF_CHECK_LEN];
+    const fx_gemm_kernels_t* ref = &fx_gemm_kernels_scalar;
+
+    fill_check_vector(a, SELF_CHECK_LEN, 0x2545F491u);
+    fill_check_vector(b, SELF_CHECK_LEN, 0x9E3779B9u);
+    b[0] = FIXED_MIN;
+
+    /* Dot product: every length through a full SIMD body plus tail */
+    for (size_t len = 0; len <= 40; len++) {
+        if (cand->dot(a, b, len) != ref->dot(a, b, len)) {
+            return 0;
+        }
+    }
+
+    /* Row strip over a strided, row-major B */
+    static const size_t kcs[] = {0, 1, 7, 13};
+    for (size_t t = 0; t < sizeof(kcs) / sizeof(kcs[0]); t++) {
+        int64_t acc_ref[FX_GEMM_NR];
+        int64_t acc_cand[FX_GEMM_NR];
+
+        for (size_t j = 0; j < FX_GEMM_NR; j++) {
+            acc_ref[j] = (int64_t)(j + 1) * -123456789;
+            acc_cand[j] = acc_ref[j];
+        }
+
+        ref->row_strip(kcs[t], &a[1], b, SELF_CHECK_LDB, acc_ref);
+        cand->row_strip(kcs[t], &a[1], b, SELF_CHECK_LDB, acc_cand);
+
+        if (memcmp(acc_ref, acc_cand, sizeof(acc_ref)) != 0) {
+            return 0;
+        }
+    }
+
+    /* Micro-kernel over a packed panel, full and partial row counts */
+    for (size_t mr = 1; mr <= FX_GEMM_MR; mr++) {
+        int64_t acc_ref[FX_GEMM_MR * SELF_CHECK_LDACC];
+        int64_t acc_cand[FX_GEMM_MR * SELF_CHECK_LDACC];
+
+        for (size_t j = 0; j < FX_GEMM_MR * SELF_CHECK_LDACC; j++) {
+            acc_ref[j] = (int64_t)j * 987654321;
+            acc_cand[j] = acc_ref[j];
+        }
+
+        ref->micro(mr, 17, a, SELF_CHECK_LDA, b, acc_ref, SELF_CHECK_LDACC);
+        cand->micro(mr, 17, a, SELF_CHECK_LDA, b, acc_cand, SELF_CHECK_LDACC);
+
+        if (memcmp(acc_ref, acc_cand, sizeof(acc_ref)) != 0) {
+            return 0;
+        }
+    }
+
+    /* Activations: every length through a full SIMD body plus tail, with
+     * a negative slope and a large one to exercise the fixed_mul() wrap */
+    static const fixed_t alphas[] = {FIXED_ONE / 100, -3 * FIXED_ONE, 1 << 24};
+    for (size_t len = 0; len <= 20; len++) {
+        fixed_t v_ref[20];
+        fixed_t v_cand[20];
+
+        memcpy(v_ref, a, len * sizeof(fixed_t));
+        memcpy(v_cand, a, len * sizeof(fixed_t));
+        ref->clamp(v_ref, len, -FIXED_ONE, 6 * FIXED_ONE);
+        cand->clamp(v_cand, len, -FIXED_ONE, 6 * FIXED_ONE);
+        if (memcmp(v_ref, v_cand, len * sizeof(fixed_t)) != 0) {
+            return 0;
+        }
+
+        for (size_t t = 0; t < sizeof(alphas) / sizeof(alphas[0]); t++) {
+            memcpy(v_ref, b, len * sizeof(fixed_t));
+            memcpy(v_cand, b, len * sizeof(fixed_t));
+            ref->leaky(v_ref, len, alphas[t]);
+            cand->leaky(v_cand, len, alphas[t]);
+            if (memcmp(v_ref, v_cand, len * sizeof(fixed_t)) != 0) {
+                return 0;
+            }
+        }
+    }
+
+    /* GEMV row block: strided rows, every length through body, prefetch and tail */
+    for (size_t len = 0; len <= 40; len += 3) {
+        int64_t out_ref[4];
+        int64_t out_cand[4];
+
+        ref->dot4(b, a, 29, len, out_ref);
+        cand->dot4(b, a, 29, len, out_cand);
+        if (memcmp(out_ref, out_cand, sizeof(out_ref)) != 0) {
+            return 0;
+        }
+    }
+
+    /* int32_t dot products: inputs scaled so Σ |x| · |q| stays in int32_t */
+    {
+        fixed_t x[40];
+        int8_t q8[40];
+        int16_t q16[40];
+
+        for (size_t k = 0; k < 40; k++) {
+            x[k] = a[k] >> 17;              /* |x| <= 2^14 */
+            q8[k] = (int8_t)(b[k] >> 24);
+            q16[k] = (int16_t)(b[k] >> 20);   /* |q| <= 2^11 */
+        }
+        x[1] = -(1 << 14);
+        q8[1] = INT8_MIN;
+
+        for (size_t len = 0; len <= 40; len++) {
+            if (cand->qdot32_i8(x, q8, len) != ref->qdot32_i8(x, q8, len) ||
+                cand->qdot32_i16(x, q16, len) != ref->qdot32_i16(x, q16, len)) {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+fx_isa_t fx_dispatch_force(fx_isa_t isa) {
+    int level = (int)isa;
+
+    if (level > (int)FX_ISA_AVX2) {
+        level = (int)FX_ISA_AVX2;
+    }
+
+    /* Walk down from the request until a level is supported and verified */
+    for (; level > (int)FX_ISA_SCALAR; level--) {
+        const fx_gemm_kernels_t* cand = kernels_for((fx_isa_t)level);
+
+        if (cand != NULL && isa_supported((fx_isa_t)level) && self_check(cand)) {
+            active_kernels = cand;
+            active_isa = (fx_isa_t)level;
+            return active_isa;
+        }
+    }
+
+    active_kernels = &fx_gemm_kernels_scalar;
+    active_isa = FX_ISA_SCALAR;
+    return active_isa;
+}
+
+fx_isa_t fx_dispatch_init(void) {
+    if (active_kernels != NULL) {
+        return active_isa;
+    }
+
+    return fx_dispatch_force(FX_ISA_AVX2);
+}
+
+fx_isa_t fx_dispatch_active(void) {
+    return fx_dispatch_init();
+}
+
+const char* fx_isa_name(fx_isa_t isa) {
+    switch (isa) {
+        case FX_ISA_SSE41:
+            return "sse4.1";
+        case FX_ISA_AVX2:
+            return "avx2";
+        case FX_ISA_SCALAR:
+        default:
+            return "scalar";
+    }
+}
+
+const fx_gemm_kernels_t* fx_gemm_kernels(void) {
+    if (active_kernels == NULL) {
+        (void)fx_dispatch_init();
+    }
+
+    return active_kernels;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file dense.c
+ * @project Certifiable Inference Engine
+ * @brief Implementation of the fused dense layer forward pass.
+ *
+ * @details One pass over the output: multiply-accumulate through the active
+ * GEMM kernel, fold the bias into the int64_t accumulator, round once, apply
+ * the activation and store.
+ *
+ * @traceability SRS-004-ACTIVATIONS
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "dense.h"
+#include "gemm_kernels.h"
+
+/**
+ * @brief Round a Q32.32 accumulator (bias already folded in) to Q16.16.
+ */
+static inline fixed_t dense_round(int64_t acc) {
+    return (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+}
+
+void fx_dense_forward(const fx_matrix_t* in, const fx_matrix_t* weights,
+                      const fx_matrix_t* bias, const fx_activation_t* act,
+                      fx_matrix_t* out) {
+    /* SRS-003.4: Dimensional validation - safe failure mode */
+    if (!in || !weights || !out || !in->data || !weights->data || !out->data) {
+        return;
+    }
+
+    if (in->cols != weights->rows) {
+        return;
+    }
+
+    if (out->rows != in->rows || out->cols != weights->cols) {
+        return;
+    }
+
+    if (bias && (!bias->data || bias->rows != 1 || bias->cols != weights->cols)) {
+        return;
+    }
+
+    const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+    const size_t k_len = in->cols;
+    const size_t p_cols = weights->cols;
+    const size_t p_strips = p_cols - (p_cols % FX_GEMM_NR);
+
+    for (size_t i = 0; i < in->rows; i++) {
+        const fixed_t* x_row = &in->data[i * k_len];
+        fixed_t* y_row = &out->data[i * p_cols];
+
+        for (size_t j = 0; j < p_strips; j += FX_GEMM_NR) {
+            int64_t acc[FX_GEMM_NR];
+            fixed_t v[FX_GEMM_NR];
+
+            /* SRS-004.9: Bias enters the accumulator at Q32.32 scale */
+            for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+                acc[jj] = bias ? (int64_t)bias->data[j + jj] * FIXED_ONE : 0;
+            }
+
+            kern->row_strip(k_len, x_row, &weights->data[j], p_cols, acc);
+
+            for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+                v[jj] = dense_round(acc[jj]);
+            }
+
+            fx_activation_apply(act, v, FX_GEMM_NR);
+
+            /* Single store per output element */
+            for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+                y_row[j + jj] = v[jj];
+            }
+        }
+
+        /* Remaining columns */
+        for (size_t j = p_strips; j < p_cols; j++) {
+            int64_t acc = bias ? (int64_t)bias->data[j] * FIXED_ONE : 0;
+
+            for (size_t k = 0; k < k_len; k++) {
+                acc += (int64_t)x_row[k] * weights->data[k * p_cols + j];
+            }
+
+            fixed_t v = dense_round(acc);
+            fx_activation_apply(act, &v, 1);
+            y_row[j] = v;
+        }
+    }
+}
+
+void fx_dense_forward_packed(const fx_matrix_t* in, const fx_packed_weights_t* weights,
+                             const fx_matrix_t* bias, const fx_activation_t* act,
+                             fx_matrix_t* out) {
+    /* SRS-003.4: Dimensional validation - safe failure mode */
+    if (!in || !weights || !out || !in->data || !weights->data || !out->data) {
+        return;
+    }
+
+    if (in->cols != weights->rows) {
+        return;
+    }
+
+    if (out->rows != in->rows || out->cols != weights->cols) {
+        return;
+    }
+
+    if (bias && (!bias->data || bias->rows != 1 || bias->cols != weights->cols)) {
+        return;
+    }
+
+    /* SRS-004.9: Bias enters the accumulator at Q32.32 scale; the activation
+     * runs on each register tile before its single store */
+    fx_gemm_packed(in, weights, bias ? bias->data : NULL, act, out->data, out->cols, 1u);
+}
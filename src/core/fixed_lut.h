@@ -0,0 +1,174 @@
+/**
+ * @file fixed_lut.h
+ * @project Certifiable Inference Engine
+ * @brief Internal table-driven sigmoid, tanh, exp and log evaluators.
+ *
+ * @details Private to the library. Each function is a 1025-entry Q.30 table
+ * (generated by tools/gen_lut.py) and one linear interpolation carried out
+ * exactly in int64_t, followed by a single round-half-up to Q16.16. Only
+ * integer operations are used, so results are identical on every platform.
+ *
+ * @traceability SRS-004.6, SRS-004.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef FIXED_LUT_H
+#define FIXED_LUT_H
+
+#include "fixed_point.h"
+#include <stdint.h>
+
+/** @brief log2 of the number of table segments */
+#define FX_LUT_BITS 10
+
+/** @brief Entries per table (segments + 1 so interpolation never reads past the end) */
+#define FX_LUT_LEN ((1 << FX_LUT_BITS) + 1)
+
+/** @brief sigmoid(x) tabulated on [0, 16): step 2^-6 */
+#define FX_LUT_SIGMOID_FRAC_BITS 6
+/** @brief tanh(x) tabulated on [0, 8): step 2^-7 */
+#define FX_LUT_TANH_FRAC_BITS    7
+
+/** @brief round(log2(e) * 2^30) */
+#define FX_LUT_LOG2E_Q30 1549082005
+
+/** @brief round(ln(2) * 2^26) */
+#define FX_LUT_LN2_Q26 46516320
+
+/** @brief sigmoid(i / 64), Q.30 */
+extern const uint32_t fx_lut_sigmoid[FX_LUT_LEN];
+/** @brief tanh(i / 128), Q.30 */
+extern const uint32_t fx_lut_tanh[FX_LUT_LEN];
+/** @brief 2^(i / 1024), Q.30 */
+extern const uint32_t fx_lut_exp2[FX_LUT_LEN];
+/** @brief log2(1 + i / 1024), Q.30 */
+extern const uint32_t fx_lut_log2[FX_LUT_LEN];
+
+/**
+ * @brief Interpolate a table at a non-negative Q16.16 input.
+ *
+ * @details idx = a >> g, frac = a mod 2^g with g = 16 − frac_bits. The
+ * interpolant T[idx]·2^g + (T[idx+1] − T[idx])·frac is exact in Q(30+g) and
+ * is rounded once to Q16.16. Inputs beyond the table are clamped to its last
+ * point, where the function already rounds to 1.0.
+ */
+static inline fixed_t fx_lut_interp_pos(const uint32_t* table, uint32_t a,
+                                        uint32_t frac_bits) {
+    const uint32_t g = (uint32_t)FIXED_SHIFT - frac_bits;
+    const uint32_t last = ((uint32_t)1 << (FX_LUT_BITS + g)) - 1u;
+    const uint32_t c = (a < last) ? a : last;
+    const uint32_t idx = c >> g;
+    const int64_t frac = (int64_t)(c & (((uint32_t)1 << g) - 1u));
+    const int64_t base = (int64_t)table[idx];
+    const int64_t v = (base << g) + ((int64_t)table[idx + 1u] - base) * frac;
+    const uint32_t s = 30u + g - (uint32_t)FIXED_SHIFT;
+
+    return (fixed_t)((v + ((int64_t)1 << (s - 1u))) >> s);
+}
+
+/**
+ * @brief sigmoid(x) = 1 / (1 + e^−x), |error| <= 1 LSB.
+ *
+ * @details Uses sigmoid(−x) = 1 − sigmoid(x), so the result is exactly
+ * symmetric. The sign is applied with a mask instead of a branch.
+ */
+static inline fixed_t fx_lut_sigmoid_eval(fixed_t x) {
+    const uint32_t m = (uint32_t)(x >> 31);                  /* 0 or all ones */
+    const uint32_t a = ((uint32_t)x ^ m) - m;                 /* |x|, also for FIXED_MIN */
+    const uint32_t r = (uint32_t)fx_lut_interp_pos(fx_lut_sigmoid, a,
+                                                   FX_LUT_SIGMOID_FRAC_BITS);
+
+    return (fixed_t)(((r ^ m) - m) + (m & (uint32_t)FIXED_ONE));
+}
+
+/**
+ * @brief tanh(x), |error| <= 1 LSB, exactly odd.
+ */
+static inline fixed_t fx_lut_tanh_eval(fixed_t x) {
+    const uint32_t m = (uint32_t)(x >> 31);
+    const uint32_t a = ((uint32_t)x ^ m) - m;
+    const uint32_t r = (uint32_t)fx_lut_interp_pos(fx_lut_tanh, a,
+                                                   FX_LUT_TANH_FRAC_BITS);
+
+    return (fixed_t)((r ^ m) - m);
+}
+
+/**
+ * @brief e^x in Q.q from t = x·log2(e) in Q.46.
+ *
+ * @details The integer part n of t is the binary exponent and its fraction
+ * indexes the 2^f table (10 index bits, 16 interpolation bits). The Q.46
+ * mantissa is shifted by 46 − q − n with a single rounding. Relative error
+ * <= 2^-23, plus 1/2 LSB of final rounding.
+ *
+ * @pre floor(t / 2^46) < 46 − q (result fits in 47 bits)
+ */
+static inline int64_t fx_lut_exp_q(int64_t t, uint32_t q) {
+    const int64_t n = t >> 46;
+
+    if (n < -(int64_t)q - 1) {
+        return 0;                 /* e^x < 2^-(q+1) rounds to 0 */
+    }
+
+    const uint64_t f = (uint64_t)t & (((uint64_t)1 << 46) - 1u);
+    const uint32_t idx = (uint32_t)(f >> 36);
+    const int64_t frac = (int64_t)((f >> 20) & 0xFFFFu);
+    const int64_t base = (int64_t)fx_lut_exp2[idx];
+    const int64_t v = (base << 16) + ((int64_t)fx_lut_exp2[idx + 1u] - base) * frac;
+    const uint32_t s = (uint32_t)(46 - (int64_t)q - n);
+
+    return (v + ((int64_t)1 << (s - 1u))) >> s;
+}
+
+/**
+ * @brief e^x via 2^(x·log2 e) in Q16.16, saturating to FIXED_MAX.
+ *
+ * @details t = x·log2(e) is formed exactly in Q.46 (|t| < 2^62).
+ */
+static inline fixed_t fx_lut_exp_eval(fixed_t x) {
+    const int64_t t = (int64_t)x * FX_LUT_LOG2E_Q30;
+
+    if ((t >> 46) >= 15) {
+        return FIXED_MAX;
+    }
+
+    const int64_t r = fx_lut_exp_q(t, FIXED_SHIFT);
+
+    return (r > FIXED_MAX) ? FIXED_MAX : (fixed_t)r;
+}
+
+/**
+ * @brief ln(s / 2^q) in Q16.16 for a positive Q.q value held in 64 bits.
+ *
+ * @details s = 2^p · (1 + f) with p the top set bit; log2(1 + f) comes from
+ * the table (10 index bits, 16 interpolation bits), p − q is added in Q.30
+ * and the sum is scaled by ln 2 with a single rounding. Used for the
+ * log-sum-exp of fx_log_softmax(), whose sums exceed the fixed_t range.
+ * |error| < 1/2 LSB + 2^-20.
+ *
+ * @pre s > 0, s < 2^63 and q <= 62
+ */
+static inline int64_t fx_lut_ln_eval(uint64_t s, uint32_t q) {
+    uint32_t p = 62u;
+
+    while (p > 0u && (s >> p) == 0u) {
+        p--;
+    }
+
+    const uint64_t u = (p >= 46u) ? (s >> (p - 46u)) : (s << (46u - p));
+    const uint64_t f = u - ((uint64_t)1 << 46);
+    const uint32_t idx = (uint32_t)(f >> 36);
+    const int64_t frac = (int64_t)((f >> 20) & 0xFFFFu);
+    const int64_t base = (int64_t)fx_lut_log2[idx];
+    const int64_t v = (base << 16) + ((int64_t)fx_lut_log2[idx + 1u] - base) * frac;
+    const int64_t w = (((int64_t)p - (int64_t)q) * ((int64_t)1 << 30)) + ((v + FIXED_HALF) >> 16);
+
+    return (w * FX_LUT_LN2_Q26 + ((int64_t)1 << 39)) >> 40;
+}
+
+#endif /* FIXED_LUT_H */
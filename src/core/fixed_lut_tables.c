@@ -0,0 +1,718 @@
+/**
+ * @file fixed_lut_tables.c
+ * @project Certifiable Inference Engine
+ * @brief Generated Q.30 tables for sigmoid, tanh, exp and log.
+ *
+ * @details GENERATED by tools/gen_lut.py - do not edit by hand. Each entry
+ * is round(f(x) * 2^30) computed in 50-digit decimal arithmetic.
+ *
+ * @traceability SRS-004.6, SRS-004.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "fixed_lut.h"
+
+/* sigmoid(x), x = 16 * i / 1024 */
+const uint32_t fx_lut_sigmoid[FX_LUT_LEN] = {
+     536870912u,  541065131u,  545258837u,  549451521u,  553642669u,  557831772u,
+     562018320u,  566201806u,  570381721u,  574557563u,  578728826u,  582895012u,
+     587055621u,  591210157u,  595358128u,  599499045u,  603632421u,  607757774u,
+     611874625u,  615982500u,  620080927u,  624169441u,  628247581u,  632314889u,
+     636370916u,  640415214u,  644447344u,  648466869u,  652473360u,  656466395u,
+     660445556u,  664410432u,  668360618u,  672295716u,  676215336u,  680119092u,
+     684006607u,  687877511u,  691731441u,  695568040u,  699386960u,  703187861u,
+     706970408u,  710734276u,  714479147u,  718204711u,  721910665u,  725596715u,
+     729262575u,  732907967u,  736532619u,  740136270u,  743718666u,  747279561u,
+     750818718u,  754335905u,  757830903u,  761303498u,  764753485u,  768180666u,
+     771584854u,  774965867u,  778323533u,  781657686u,  784968172u,  788254840u,
+     791517550u,  794756170u,  797970573u,  801160643u,  804326271u,  807467353u,
+     810583795u,  813675510u,  816742419u,  819784449u,  822801534u,  825793617u,
+     828760645u,  831702576u,  834619371u,  837510999u,  840377438u,  843218668u,
+     846034679u,  848825466u,  851591031u,  854331380u,  857046527u,  859736491u,
+     862401297u,  865040976u,  867655564u,  870245102u,  872809637u,  875349220u,
+     877863909u,  880353766u,  882818857u,  885259253u,  887675030u,  890066268u,
+     892433052u,  894775471u,  897093617u,  899387587u,  901657482u,  903903406u,
+     906125467u,  908323776u,  910498448u,  912649600u,  914777356u,  916881837u,
+     918963172u,  921021490u,  923056923u,  925069608u,  927059682u,  929027285u,
+     930972558u,  932895647u,  934796699u,  936675861u,  938533285u,  940369122u,
+     942183526u,  943976654u,  945748661u,  947499707u,  949229951u,  950939554u,
+     952628679u,  954297488u,  955946146u,  957574819u,  959183671u,  960772870u,
+     962342584u,  963892980u,  965424228u,  966936495u,  968429952u,  969904769u,
+     971361116u,  972799162u,  974219080u,  975621038u,  977005208u,  978371761u,
+     979720867u,  981052697u,  982367420u,  983665207u,  984946228u,  986210653u,
+     987458649u,  988690386u,  989906033u,  991105756u,  992289723u,  993458102u,
+     994611057u,  995748754u,  996871359u,  997979034u,  999071944u, 1000150251u,
+    1001214117u, 1002263702u, 1003299166u, 1004320669u, 1005328370u, 1006322425u,
+    1007302990u, 1008270222u, 1009224275u, 1010165301u, 1011093455u, 1012008886u,
+    1012911746u, 1013802183u, 1014680345u, 1015546381u, 1016400435u, 1017242653u,
+    1018073178u, 1018892153u, 1019699719u, 1020496016u, 1021281184u, 1022055360u,
+    1022818680u, 1023571282u, 1024313298u, 1025044861u, 1025766105u, 1026477159u,
+    1027178152u, 1027869214u, 1028550470u, 1029222048u, 1029884070u, 1030536662u,
+    1031179945u, 1031814039u, 1032439065u, 1033055141u, 1033662384u, 1034260910u,
+    1034850835u, 1035432272u, 1036005333u, 1036570129u, 1037126771u, 1037675367u,
+    1038216025u, 1038748852u, 1039273953u, 1039791431u, 1040301391u, 1040803933u,
+    1041299158u, 1041787166u, 1042268056u, 1042741924u, 1043208866u, 1043668978u,
+    1044122353u, 1044569084u, 1045009262u, 1045442979u, 1045870324u, 1046291385u,
+    1046706249u, 1047115002u, 1047517731u, 1047914518u, 1048305448u, 1048690602u,
+    1049070061u, 1049443905u, 1049812214u, 1050175066u, 1050532537u, 1050884704u,
+    1051231642u, 1051573425u, 1051910126u, 1052241818u, 1052568571u, 1052890458u,
+    1053207546u, 1053519905u, 1053827602u, 1054130704u, 1054429278u, 1054723388u,
+    1055013099u, 1055298473u, 1055579574u, 1055856463u, 1056129202u, 1056397850u,
+    1056662466u, 1056923109u, 1057179837u, 1057432707u, 1057681775u, 1057927095u,
+    1058168724u, 1058406714u, 1058641119u, 1058871992u, 1059099384u, 1059323345u,
+    1059543927u, 1059761179u, 1059975150u, 1060185888u, 1060393441u, 1060597855u,
+    1060799177u, 1060997452u, 1061192726u, 1061385043u, 1061574446u, 1061760979u,
+    1061944684u, 1062125603u, 1062303778u, 1062479248u, 1062652055u, 1062822237u,
+    1062989834u, 1063154885u, 1063317427u, 1063477497u, 1063635133u, 1063790370u,
+    1063943245u, 1064093793u, 1064242049u, 1064388046u, 1064531819u, 1064673401u,
+    1064812825u, 1064950123u, 1065085327u, 1065218468u, 1065349577u, 1065478686u,
+    1065605823u, 1065731019u, 1065854303u, 1065975703u, 1066095248u, 1066212966u,
+    1066328884u, 1066443030u, 1066555430u, 1066666111u, 1066775098u, 1066882417u,
+    1066988093u, 1067092151u, 1067194616u, 1067295512u, 1067394862u, 1067492690u,
+    1067589019u, 1067683871u, 1067777269u, 1067869235u, 1067959791u, 1068048958u,
+    1068136757u, 1068223209u, 1068308334u, 1068392153u, 1068474685u, 1068555950u,
+    1068635967u, 1068714755u, 1068792334u, 1068868720u, 1068943933u, 1069017990u,
+    1069090909u, 1069162707u, 1069233402u, 1069303010u, 1069371547u, 1069439030u,
+    1069505476u, 1069570899u, 1069635316u, 1069698742u, 1069761192u, 1069822680u,
+    1069883223u, 1069942833u, 1070001526u, 1070059315u, 1070116214u, 1070172237u,
+    1070227397u, 1070281708u, 1070335182u, 1070387832u, 1070439671u, 1070490711u,
+    1070540964u, 1070590444u, 1070639160u, 1070687126u, 1070734352u, 1070780850u,
+    1070826631u, 1070871706u, 1070916086u, 1070959781u, 1071002803u, 1071045161u,
+    1071086865u, 1071127926u, 1071168354u, 1071208158u, 1071247347u, 1071285932u,
+    1071323921u, 1071361324u, 1071398150u, 1071434407u, 1071470105u, 1071505251u,
+    1071539855u, 1071573924u, 1071607468u, 1071640493u, 1071673008u, 1071705022u,
+    1071736540u, 1071767572u, 1071798125u, 1071828205u, 1071857821u, 1071886979u,
+    1071915687u, 1071943951u, 1071971779u, 1071999176u, 1072026150u, 1072052708u,
+    1072078854u, 1072104597u, 1072129942u, 1072154895u, 1072179462u, 1072203650u,
+    1072227463u, 1072250908u, 1072273991u, 1072296717u, 1072319092u, 1072341121u,
+    1072362809u, 1072384161u, 1072405184u, 1072425881u, 1072446258u, 1072466320u,
+    1072486072u, 1072505518u, 1072524664u, 1072543513u, 1072562070u, 1072580341u,
+    1072598329u, 1072616039u, 1072633474u, 1072650640u, 1072667541u, 1072684179u,
+    1072700561u, 1072716689u, 1072732567u, 1072748200u, 1072763590u, 1072778743u,
+    1072793661u, 1072808348u, 1072822808u, 1072837044u, 1072851059u, 1072864858u,
+    1072878443u, 1072891818u, 1072904986u, 1072917950u, 1072930713u, 1072943279u,
+    1072955650u, 1072967830u, 1072979821u, 1072991627u, 1073003249u, 1073014692u,
+    1073025958u, 1073037049u, 1073047968u, 1073058719u, 1073069303u, 1073079723u,
+    1073089982u, 1073100081u, 1073110025u, 1073119814u, 1073129452u, 1073138941u,
+    1073148282u, 1073157479u, 1073166534u, 1073175448u, 1073184225u, 1073192865u,
+    1073201372u, 1073209746u, 1073217991u, 1073226109u, 1073234100u, 1073241968u,
+    1073249714u, 1073257340u, 1073264848u, 1073272240u, 1073279517u, 1073286681u,
+    1073293735u, 1073300679u, 1073307515u, 1073314246u, 1073320872u, 1073327396u,
+    1073333819u, 1073340142u, 1073346367u, 1073352496u, 1073358530u, 1073364470u,
+    1073370318u, 1073376076u, 1073381745u, 1073387325u, 1073392819u, 1073398229u,
+    1073403554u, 1073408797u, 1073413958u, 1073419040u, 1073424042u, 1073428968u,
+    1073433817u, 1073438591u, 1073443291u, 1073447918u, 1073452473u, 1073456958u,
+    1073461373u, 1073465720u, 1073469999u, 1073474213u, 1073478361u, 1073482444u,
+    1073486465u, 1073490423u, 1073494319u, 1073498156u, 1073501933u, 1073505651u,
+    1073509312u, 1073512916u, 1073516464u, 1073519957u, 1073523396u, 1073526782u,
+    1073530115u, 1073533397u, 1073536627u, 1073539808u, 1073542939u, 1073546022u,
+    1073549057u, 1073552045u, 1073554987u, 1073557883u, 1073560734u, 1073563542u,
+    1073566305u, 1073569026u, 1073571704u, 1073574341u, 1073576938u, 1073579494u,
+    1073582010u, 1073584487u, 1073586926u, 1073589327u, 1073591691u, 1073594018u,
+    1073596310u, 1073598565u, 1073600786u, 1073602972u, 1073605125u, 1073607244u,
+    1073609330u, 1073611384u, 1073613406u, 1073615397u, 1073617357u, 1073619286u,
+    1073621186u, 1073623056u, 1073624897u, 1073626709u, 1073628494u, 1073630251u,
+    1073631980u, 1073633683u, 1073635360u, 1073637010u, 1073638635u, 1073640234u,
+    1073641809u, 1073643360u, 1073644886u, 1073646389u, 1073647868u, 1073649325u,
+    1073650759u, 1073652171u, 1073653560u, 1073654929u, 1073656276u, 1073657602u,
+    1073658908u, 1073660193u, 1073661458u, 1073662704u, 1073663931u, 1073665138u,
+    1073666327u, 1073667498u, 1073668650u, 1073669784u, 1073670901u, 1073672001u,
+    1073673083u, 1073674149u, 1073675198u, 1073676231u, 1073677248u, 1073678249u,
+    1073679234u, 1073680205u, 1073681160u, 1073682100u, 1073683026u, 1073683938u,
+    1073684835u, 1073685719u, 1073686588u, 1073687445u, 1073688288u, 1073689118u,
+    1073689935u, 1073690739u, 1073691531u, 1073692311u, 1073693078u, 1073693834u,
+    1073694578u, 1073695311u, 1073696032u, 1073696742u, 1073697440u, 1073698129u,
+    1073698806u, 1073699473u, 1073700129u, 1073700776u, 1073701412u, 1073702039u,
+    1073702655u, 1073703263u, 1073703861u, 1073704449u, 1073705028u, 1073705599u,
+    1073706161u, 1073706713u, 1073707258u, 1073707794u, 1073708321u, 1073708841u,
+    1073709352u, 1073709855u, 1073710351u, 1073710839u, 1073711319u, 1073711792u,
+    1073712258u, 1073712716u, 1073713167u, 1073713612u, 1073714049u, 1073714480u,
+    1073714904u, 1073715321u, 1073715732u, 1073716136u, 1073716535u, 1073716927u,
+    1073717313u, 1073717693u, 1073718067u, 1073718435u, 1073718798u, 1073719155u,
+    1073719506u, 1073719852u, 1073720193u, 1073720528u, 1073720858u, 1073721183u,
+    1073721503u, 1073721818u, 1073722128u, 1073722434u, 1073722734u, 1073723030u,
+    1073723322u, 1073723609u, 1073723891u, 1073724169u, 1073724443u, 1073724712u,
+    1073724977u, 1073725239u, 1073725496u, 1073725749u, 1073725998u, 1073726243u,
+    1073726485u, 1073726723u, 1073726957u, 1073727187u, 1073727414u, 1073727638u,
+    1073727858u, 1073728074u, 1073728287u, 1073728497u, 1073728704u, 1073728907u,
+    1073729108u, 1073729305u, 1073729499u, 1073729690u, 1073729878u, 1073730063u,
+    1073730246u, 1073730425u, 1073730602u, 1073730776u, 1073730947u, 1073731116u,
+    1073731282u, 1073731445u, 1073731606u, 1073731764u, 1073731920u, 1073732074u,
+    1073732225u, 1073732374u, 1073732520u, 1073732665u, 1073732807u, 1073732946u,
+    1073733084u, 1073733220u, 1073733353u, 1073733484u, 1073733614u, 1073733741u,
+    1073733866u, 1073733990u, 1073734111u, 1073734231u, 1073734348u, 1073734464u,
+    1073734578u, 1073734691u, 1073734801u, 1073734910u, 1073735017u, 1073735123u,
+    1073735227u, 1073735329u, 1073735430u, 1073735529u, 1073735626u, 1073735723u,
+    1073735817u, 1073735910u, 1073736002u, 1073736092u, 1073736181u, 1073736269u,
+    1073736355u, 1073736439u, 1073736523u, 1073736605u, 1073736686u, 1073736766u,
+    1073736844u, 1073736921u, 1073736997u, 1073737072u, 1073737146u, 1073737218u,
+    1073737290u, 1073737360u, 1073737429u, 1073737497u, 1073737564u, 1073737631u,
+    1073737696u, 1073737760u, 1073737823u, 1073737885u, 1073737946u, 1073738006u,
+    1073738065u, 1073738123u, 1073738181u, 1073738237u, 1073738293u, 1073738347u,
+    1073738401u, 1073738454u, 1073738507u, 1073738558u, 1073738609u, 1073738659u,
+    1073738708u, 1073738756u, 1073738804u, 1073738850u, 1073738896u, 1073738942u,
+    1073738987u, 1073739031u, 1073739074u, 1073739116u, 1073739158u, 1073739200u,
+    1073739240u, 1073739281u, 1073739320u, 1073739359u, 1073739397u, 1073739435u,
+    1073739472u, 1073739508u, 1073739544u, 1073739579u, 1073739614u, 1073739648u,
+    1073739682u, 1073739715u, 1073739748u, 1073739780u, 1073739812u, 1073739843u,
+    1073739874u, 1073739904u, 1073739934u, 1073739963u, 1073739992u, 1073740020u,
+    1073740048u, 1073740076u, 1073740103u, 1073740130u, 1073740156u, 1073740182u,
+    1073740207u, 1073740232u, 1073740257u, 1073740281u, 1073740305u, 1073740329u,
+    1073740352u, 1073740375u, 1073740397u, 1073740419u, 1073740441u, 1073740463u,
+    1073740484u, 1073740504u, 1073740525u, 1073740545u, 1073740565u, 1073740584u,
+    1073740604u, 1073740623u, 1073740641u, 1073740660u, 1073740678u, 1073740695u,
+    1073740713u, 1073740730u, 1073740747u, 1073740764u, 1073740780u, 1073740796u,
+    1073740812u, 1073740828u, 1073740843u, 1073740859u, 1073740874u, 1073740888u,
+    1073740903u, 1073740917u, 1073740931u, 1073740945u, 1073740959u, 1073740972u,
+    1073740985u, 1073740998u, 1073741011u, 1073741024u, 1073741036u, 1073741048u,
+    1073741060u, 1073741072u, 1073741084u, 1073741095u, 1073741107u, 1073741118u,
+    1073741129u, 1073741139u, 1073741150u, 1073741160u, 1073741171u, 1073741181u,
+    1073741191u, 1073741201u, 1073741210u, 1073741220u, 1073741229u, 1073741238u,
+    1073741248u, 1073741256u, 1073741265u, 1073741274u, 1073741282u, 1073741291u,
+    1073741299u, 1073741307u, 1073741315u, 1073741323u, 1073741331u, 1073741339u,
+    1073741346u, 1073741354u, 1073741361u, 1073741368u, 1073741375u, 1073741382u,
+    1073741389u, 1073741396u, 1073741402u, 1073741409u, 1073741415u, 1073741422u,
+    1073741428u, 1073741434u, 1073741440u, 1073741446u, 1073741452u, 1073741458u,
+    1073741463u, 1073741469u, 1073741474u, 1073741480u, 1073741485u, 1073741490u,
+    1073741496u, 1073741501u, 1073741506u, 1073741511u, 1073741515u, 1073741520u,
+    1073741525u, 1073741530u, 1073741534u, 1073741539u, 1073741543u, 1073741547u,
+    1073741552u, 1073741556u, 1073741560u, 1073741564u, 1073741568u, 1073741572u,
+    1073741576u, 1073741580u, 1073741584u, 1073741587u, 1073741591u, 1073741595u,
+    1073741598u, 1073741602u, 1073741605u, 1073741609u, 1073741612u, 1073741615u,
+    1073741618u, 1073741622u, 1073741625u, 1073741628u, 1073741631u, 1073741634u,
+    1073741637u, 1073741640u, 1073741643u, 1073741645u, 1073741648u, 1073741651u,
+    1073741654u, 1073741656u, 1073741659u, 1073741661u, 1073741664u, 1073741666u,
+    1073741669u, 1073741671u, 1073741674u, 1073741676u, 1073741678u, 1073741681u,
+    1073741683u, 1073741685u, 1073741687u, 1073741689u, 1073741691u, 1073741693u,
+    1073741695u, 1073741697u, 1073741699u, 1073741701u, 1073741703u
+};
+
+/* tanh(x), x = 8 * i / 1024 */
+const uint32_t fx_lut_tanh[FX_LUT_LEN] = {
+             0u,    8388437u,   16775851u,   25161217u,   33543514u,   41921720u,
+      50294816u,   58661787u,   67021619u,   75373302u,   83715829u,   92048200u,
+     100369417u,  108678490u,  116974433u,  125256267u,  133523019u,  141773725u,
+     150007427u,  158223175u,  166420030u,  174597058u,  182753337u,  190887955u,
+     199000008u,  207088605u,  215152863u,  223191913u,  231204897u,  239190966u,
+     247149288u,  255079039u,  262979411u,  270849608u,  278688847u,  286496360u,
+     294271390u,  302013199u,  309721058u,  317394256u,  325032097u,  332633898u,
+     340198992u,  347726728u,  355216470u,  362667598u,  370079506u,  377451607u,
+     384783327u,  392074109u,  399323414u,  406530717u,  413695509u,  420817299u,
+     427895611u,  434929986u,  441919982u,  448865172u,  455765145u,  462619508u,
+     469427884u,  476189910u,  482905241u,  489573549u,  496194519u,  502767856u,
+     509293276u,  515770515u,  522199322u,  528579463u,  534910717u,  541192881u,
+     547425766u,  553609197u,  559743014u,  565827074u,  571861244u,  577845409u,
+     583779466u,  589663328u,  595496917u,  601280175u,  607013051u,  612695512u,
+     618327534u,  623909109u,  629440237u,  634920935u,  640351229u,  645731158u,
+     651060770u,  656340128u,  661569304u,  666748379u,  671877449u,  676956616u,
+     681985995u,  686965708u,  691895889u,  696776681u,  701608235u,  706390712u,
+     711124280u,  715809118u,  720445410u,  725033350u,  729573140u,  734064988u,
+     738509109u,  742905727u,  747255071u,  751557377u,  755812887u,  760021850u,
+     764184519u,  768301155u,  772372023u,  776397393u,  780377540u,  784312745u,
+     788203292u,  792049471u,  795851574u,  799609898u,  803324746u,  806996420u,
+     810625229u,  814211483u,  817755498u,  821257590u,  824718078u,  828137284u,
+     831515533u,  834853152u,  838150469u,  841407813u,  844625518u,  847803917u,
+     850943344u,  854044137u,  857106631u,  860131166u,  863118081u,  866067714u,
+     868980407u,  871856501u,  874696335u,  877500252u,  880268593u,  883001698u,
+     885699910u,  888363570u,  890993016u,  893588591u,  896150633u,  898679481u,
+     901175474u,  903638948u,  906070241u,  908469688u,  910837623u,  913174379u,
+     915480290u,  917755685u,  920000894u,  922216245u,  924402065u,  926558678u,
+     928686409u,  930785579u,  932856508u,  934899515u,  936914916u,  938903025u,
+     940864156u,  942798620u,  944706725u,  946588779u,  948445085u,  950275948u,
+     952081667u,  953862541u,  955618867u,  957350938u,  959059047u,  960743482u,
+     962404532u,  964042482u,  965657614u,  967250208u,  968820543u,  970368895u,
+     971895537u,  973400739u,  974884771u,  976347899u,  977790386u,  979212493u,
+     980614480u,  981996603u,  983359117u,  984702271u,  986026317u,  987331500u,
+     988618065u,  989886254u,  991136306u,  992368457u,  993582944u,  994779997u,
+     995959846u,  997122719u,  998268841u,  999398434u, 1000511717u, 1001608910u,
+    1002690226u, 1003755880u, 1004806081u, 1005841038u, 1006860957u, 1007866041u,
+    1008856492u, 1009832509u, 1010794288u, 1011742023u, 1012675908u, 1013596131u,
+    1014502881u, 1015396344u, 1016276701u, 1017144135u, 1017998824u, 1018840945u,
+    1019670673u, 1020488180u, 1021293637u, 1022087212u, 1022869072u, 1023639379u,
+    1024398298u, 1025145987u, 1025882605u, 1026608308u, 1027323250u, 1028027584u,
+    1028721460u, 1029405025u, 1030078428u, 1030741811u, 1031395319u, 1032039091u,
+    1032673268u, 1033297986u, 1033913380u, 1034519585u, 1035116732u, 1035704952u,
+    1036284373u, 1036855122u, 1037417324u, 1037971103u, 1038516580u, 1039053875u,
+    1039583108u, 1040104395u, 1040617851u, 1041123590u, 1041621725u, 1042112367u,
+    1042595624u, 1043071604u, 1043540415u, 1044002160u, 1044456943u, 1044904867u,
+    1045346031u, 1045780534u, 1046208476u, 1046629952u, 1047045057u, 1047453885u,
+    1047856530u, 1048253081u, 1048643629u, 1049028262u, 1049407069u, 1049780134u,
+    1050147544u, 1050509382u, 1050865731u, 1051216672u, 1051562285u, 1051902650u,
+    1052237845u, 1052567946u, 1052893030u, 1053213170u, 1053528442u, 1053838917u,
+    1054144667u, 1054445763u, 1054742274u, 1055034268u, 1055321814u, 1055604978u,
+    1055883826u, 1056158421u, 1056428829u, 1056695111u, 1056957331u, 1057215548u,
+    1057469822u, 1057720214u, 1057966782u, 1058209582u, 1058448672u, 1058684108u,
+    1058915945u, 1059144236u, 1059369036u, 1059590397u, 1059808371u, 1060023009u,
+    1060234362u, 1060442479u, 1060647409u, 1060849200u, 1061047900u, 1061243556u,
+    1061436213u, 1061625918u, 1061812714u, 1061996646u, 1062177758u, 1062356091u,
+    1062531689u, 1062704593u, 1062874844u, 1063042481u, 1063207545u, 1063370076u,
+    1063530110u, 1063687687u, 1063842843u, 1063995616u, 1064146042u, 1064294156u,
+    1064439994u, 1064583591u, 1064724980u, 1064864195u, 1065001270u, 1065136237u,
+    1065269127u, 1065399974u, 1065528808u, 1065655659u, 1065780559u, 1065903537u,
+    1066024621u, 1066143842u, 1066261228u, 1066376806u, 1066490604u, 1066602650u,
+    1066712970u, 1066821592u, 1066928539u, 1067033840u, 1067137518u, 1067239598u,
+    1067340105u, 1067439063u, 1067536496u, 1067632427u, 1067726879u, 1067819875u,
+    1067911437u, 1068001587u, 1068090347u, 1068177738u, 1068263781u, 1068348497u,
+    1068431906u, 1068514028u, 1068594884u, 1068674491u, 1068752870u, 1068830040u,
+    1068906019u, 1068980825u, 1069054476u, 1069126991u, 1069198386u, 1069268678u,
+    1069337886u, 1069406025u, 1069473111u, 1069539162u, 1069604193u, 1069668219u,
+    1069731257u, 1069793320u, 1069854425u, 1069914587u, 1069973818u, 1070032135u,
+    1070089550u, 1070146079u, 1070201734u, 1070256529u, 1070310477u, 1070363591u,
+    1070415885u, 1070467370u, 1070518060u, 1070567966u, 1070617100u, 1070665475u,
+    1070713102u, 1070759993u, 1070806159u, 1070851611u, 1070896360u, 1070940417u,
+    1070983793u, 1071026499u, 1071068543u, 1071109938u, 1071150692u, 1071190816u,
+    1071230320u, 1071269212u, 1071307503u, 1071345202u, 1071382317u, 1071418858u,
+    1071454834u, 1071490253u, 1071525125u, 1071559457u, 1071593257u, 1071626535u,
+    1071659298u, 1071691553u, 1071723310u, 1071754575u, 1071785356u, 1071815661u,
+    1071845497u, 1071874872u, 1071903791u, 1071932263u, 1071960295u, 1071987892u,
+    1072015063u, 1072041812u, 1072068148u, 1072094076u, 1072119603u, 1072144734u,
+    1072169477u, 1072193836u, 1072217818u, 1072241429u, 1072264675u, 1072287560u,
+    1072310092u, 1072332274u, 1072354113u, 1072375614u, 1072396782u, 1072417622u,
+    1072438139u, 1072458339u, 1072478226u, 1072497805u, 1072517080u, 1072536058u,
+    1072554741u, 1072573135u, 1072591244u, 1072609073u, 1072626625u, 1072643906u,
+    1072660919u, 1072677669u, 1072694159u, 1072710394u, 1072726377u, 1072742113u,
+    1072757605u, 1072772857u, 1072787872u, 1072802656u, 1072817210u, 1072831538u,
+    1072845645u, 1072859533u, 1072873207u, 1072886668u, 1072899921u, 1072912968u,
+    1072925813u, 1072938460u, 1072950910u, 1072963168u, 1072975235u, 1072987116u,
+    1072998813u, 1073010328u, 1073021665u, 1073032826u, 1073043815u, 1073054633u,
+    1073065284u, 1073075769u, 1073086092u, 1073096255u, 1073106261u, 1073116112u,
+    1073125810u, 1073135357u, 1073144757u, 1073154011u, 1073163122u, 1073172091u,
+    1073180922u, 1073189616u, 1073198175u, 1073206601u, 1073214897u, 1073223064u,
+    1073231105u, 1073239021u, 1073246815u, 1073254487u, 1073262041u, 1073269478u,
+    1073276799u, 1073284007u, 1073291104u, 1073298090u, 1073304968u, 1073311739u,
+    1073318406u, 1073324969u, 1073331431u, 1073337792u, 1073344055u, 1073350220u,
+    1073356291u, 1073362267u, 1073368150u, 1073373942u, 1073379645u, 1073385259u,
+    1073390786u, 1073396228u, 1073401585u, 1073406859u, 1073412051u, 1073417163u,
+    1073422196u, 1073427150u, 1073432028u, 1073436831u, 1073441558u, 1073446213u,
+    1073450795u, 1073455307u, 1073459748u, 1073464121u, 1073468426u, 1073472664u,
+    1073476836u, 1073480944u, 1073484988u, 1073488969u, 1073492889u, 1073496748u,
+    1073500547u, 1073504287u, 1073507970u, 1073511595u, 1073515164u, 1073518678u,
+    1073522137u, 1073525542u, 1073528895u, 1073532196u, 1073535446u, 1073538645u,
+    1073541795u, 1073544896u, 1073547948u, 1073550954u, 1073553913u, 1073556826u,
+    1073559694u, 1073562517u, 1073565297u, 1073568033u, 1073570728u, 1073573380u,
+    1073575991u, 1073578562u, 1073581093u, 1073583585u, 1073586038u, 1073588453u,
+    1073590830u, 1073593171u, 1073595476u, 1073597745u, 1073599978u, 1073602177u,
+    1073604342u, 1073606473u, 1073608572u, 1073610637u, 1073612671u, 1073614673u,
+    1073616644u, 1073618585u, 1073620496u, 1073622377u, 1073624228u, 1073626051u,
+    1073627846u, 1073629613u, 1073631353u, 1073633065u, 1073634751u, 1073636411u,
+    1073638045u, 1073639654u, 1073641238u, 1073642798u, 1073644333u, 1073645844u,
+    1073647332u, 1073648797u, 1073650239u, 1073651659u, 1073653057u, 1073654433u,
+    1073655788u, 1073657122u, 1073658435u, 1073659728u, 1073661000u, 1073662253u,
+    1073663487u, 1073664701u, 1073665897u, 1073667074u, 1073668233u, 1073669374u,
+    1073670497u, 1073671603u, 1073672691u, 1073673763u, 1073674818u, 1073675857u,
+    1073676880u, 1073677887u, 1073678878u, 1073679854u, 1073680815u, 1073681760u,
+    1073682692u, 1073683608u, 1073684511u, 1073685399u, 1073686274u, 1073687135u,
+    1073687983u, 1073688818u, 1073689640u, 1073690449u, 1073691245u, 1073692029u,
+    1073692801u, 1073693561u, 1073694309u, 1073695046u, 1073695771u, 1073696485u,
+    1073697188u, 1073697880u, 1073698561u, 1073699232u, 1073699892u, 1073700543u,
+    1073701183u, 1073701813u, 1073702433u, 1073703044u, 1073703645u, 1073704237u,
+    1073704819u, 1073705393u, 1073705958u, 1073706514u, 1073707061u, 1073707600u,
+    1073708131u, 1073708653u, 1073709168u, 1073709674u, 1073710172u, 1073710663u,
+    1073711146u, 1073711622u, 1073712090u, 1073712551u, 1073713005u, 1073713452u,
+    1073713891u, 1073714324u, 1073714751u, 1073715171u, 1073715584u, 1073715991u,
+    1073716391u, 1073716785u, 1073717174u, 1073717556u, 1073717932u, 1073718302u,
+    1073718667u, 1073719026u, 1073719379u, 1073719727u, 1073720070u, 1073720407u,
+    1073720739u, 1073721066u, 1073721388u, 1073721705u, 1073722017u, 1073722324u,
+    1073722626u, 1073722924u, 1073723217u, 1073723505u, 1073723789u, 1073724069u,
+    1073724344u, 1073724615u, 1073724882u, 1073725145u, 1073725403u, 1073725658u,
+    1073725908u, 1073726155u, 1073726398u, 1073726637u, 1073726873u, 1073727104u,
+    1073727333u, 1073727557u, 1073727779u, 1073727996u, 1073728211u, 1073728422u,
+    1073728629u, 1073728834u, 1073729035u, 1073729234u, 1073729429u, 1073729621u,
+    1073729810u, 1073729997u, 1073730180u, 1073730360u, 1073730538u, 1073730713u,
+    1073730885u, 1073731055u, 1073731222u, 1073731386u, 1073731548u, 1073731707u,
+    1073731864u, 1073732019u, 1073732171u, 1073732320u, 1073732468u, 1073732613u,
+    1073732756u, 1073732896u, 1073733035u, 1073733171u, 1073733305u, 1073733437u,
+    1073733567u, 1073733695u, 1073733821u, 1073733945u, 1073734067u, 1073734188u,
+    1073734306u, 1073734423u, 1073734537u, 1073734650u, 1073734761u, 1073734871u,
+    1073734979u, 1073735085u, 1073735189u, 1073735292u, 1073735393u, 1073735493u,
+    1073735591u, 1073735688u, 1073735783u, 1073735877u, 1073735969u, 1073736060u,
+    1073736149u, 1073736237u, 1073736324u, 1073736409u, 1073736493u, 1073736576u,
+    1073736657u, 1073736737u, 1073736816u, 1073736894u, 1073736970u, 1073737045u,
+    1073737119u, 1073737192u, 1073737264u, 1073737335u, 1073737404u, 1073737473u,
+    1073737540u, 1073737607u, 1073737672u, 1073737737u, 1073737800u, 1073737862u,
+    1073737924u, 1073737984u, 1073738044u, 1073738102u, 1073738160u, 1073738217u,
+    1073738273u, 1073738328u, 1073738382u, 1073738435u, 1073738488u, 1073738540u,
+    1073738591u, 1073738641u, 1073738690u, 1073738739u, 1073738786u, 1073738834u,
+    1073738880u, 1073738926u, 1073738970u, 1073739015u, 1073739058u, 1073739101u,
+    1073739143u, 1073739185u, 1073739226u, 1073739266u, 1073739306u, 1073739345u,
+    1073739383u, 1073739421u, 1073739458u, 1073739495u, 1073739531u, 1073739567u,
+    1073739602u, 1073739636u, 1073739670u, 1073739703u, 1073739736u, 1073739769u,
+    1073739801u, 1073739832u, 1073739863u, 1073739893u, 1073739923u, 1073739953u,
+    1073739982u, 1073740010u, 1073740038u, 1073740066u, 1073740093u, 1073740120u,
+    1073740146u, 1073740173u, 1073740198u, 1073740223u, 1073740248u, 1073740273u,
+    1073740297u, 1073740320u, 1073740344u, 1073740367u, 1073740389u, 1073740411u,
+    1073740433u, 1073740455u, 1073740476u, 1073740497u, 1073740518u, 1073740538u,
+    1073740558u, 1073740577u, 1073740597u, 1073740616u, 1073740634u, 1073740653u,
+    1073740671u, 1073740689u, 1073740707u, 1073740724u, 1073740741u, 1073740758u,
+    1073740774u, 1073740791u, 1073740807u, 1073740822u, 1073740838u, 1073740853u,
+    1073740868u, 1073740883u, 1073740898u, 1073740912u, 1073740926u, 1073740940u,
+    1073740954u, 1073740967u, 1073740980u, 1073740994u, 1073741006u, 1073741019u,
+    1073741032u, 1073741044u, 1073741056u, 1073741068u, 1073741080u, 1073741091u,
+    1073741103u, 1073741114u, 1073741125u, 1073741136u, 1073741146u, 1073741157u,
+    1073741167u, 1073741177u, 1073741187u, 1073741197u, 1073741207u, 1073741216u,
+    1073741226u, 1073741235u, 1073741244u, 1073741253u, 1073741262u, 1073741271u,
+    1073741279u, 1073741288u, 1073741296u, 1073741304u, 1073741312u, 1073741320u,
+    1073741328u, 1073741336u, 1073741343u, 1073741351u, 1073741358u, 1073741365u,
+    1073741373u, 1073741380u, 1073741386u, 1073741393u, 1073741400u, 1073741406u,
+    1073741413u, 1073741419u, 1073741426u, 1073741432u, 1073741438u, 1073741444u,
+    1073741450u, 1073741456u, 1073741461u, 1073741467u, 1073741472u, 1073741478u,
+    1073741483u, 1073741488u, 1073741494u, 1073741499u, 1073741504u, 1073741509u,
+    1073741514u, 1073741519u, 1073741523u, 1073741528u, 1073741532u, 1073741537u,
+    1073741541u, 1073741546u, 1073741550u, 1073741554u, 1073741559u, 1073741563u,
+    1073741567u, 1073741571u, 1073741575u, 1073741579u, 1073741582u
+};
+
+/* 2^x, x = i / 1024 */
+const uint32_t fx_lut_exp2[FX_LUT_LEN] = {
+    1073741824u, 1074468888u, 1075196443u, 1075924492u, 1076653033u, 1077382068u,
+    1078111597u, 1078841619u, 1079572136u, 1080303147u, 1081034654u, 1081766656u,
+    1082499153u, 1083232146u, 1083965636u, 1084699622u, 1085434106u, 1086169087u,
+    1086904565u, 1087640541u, 1088377016u, 1089113990u, 1089851462u, 1090589434u,
+    1091327906u, 1092066877u, 1092806349u, 1093546322u, 1094286796u, 1095027771u,
+    1095769248u, 1096511227u, 1097253708u, 1097996693u, 1098740180u, 1099484170u,
+    1100228665u, 1100973664u, 1101719167u, 1102465174u, 1103211687u, 1103958706u,
+    1104706230u, 1105454261u, 1106202798u, 1106951842u, 1107701393u, 1108451451u,
+    1109202018u, 1109953093u, 1110704676u, 1111456768u, 1112209370u, 1112962481u,
+    1113716102u, 1114470233u, 1115224875u, 1115980028u, 1116735692u, 1117491868u,
+    1118248556u, 1119005757u, 1119763470u, 1120521696u, 1121280436u, 1122039689u,
+    1122799457u, 1123559739u, 1124320536u, 1125081848u, 1125843675u, 1126606018u,
+    1127368878u, 1128132254u, 1128896147u, 1129660557u, 1130425485u, 1131190931u,
+    1131956895u, 1132723378u, 1133490379u, 1134257900u, 1135025941u, 1135794502u,
+    1136563583u, 1137333186u, 1138103309u, 1138873953u, 1139645120u, 1140416809u,
+    1141189020u, 1141961754u, 1142735011u, 1143508792u, 1144283097u, 1145057926u,
+    1145833280u, 1146609159u, 1147385563u, 1148162493u, 1148939949u, 1149717932u,
+    1150496441u, 1151275478u, 1152055042u, 1152835134u, 1153615754u, 1154396902u,
+    1155178580u, 1155960787u, 1156743523u, 1157526790u, 1158310587u, 1159094914u,
+    1159879773u, 1160665163u, 1161451085u, 1162237539u, 1163024526u, 1163812046u,
+    1164600099u, 1165388685u, 1166177806u, 1166967460u, 1167757650u, 1168548374u,
+    1169339634u, 1170131430u, 1170923762u, 1171716630u, 1172510036u, 1173303978u,
+    1174098458u, 1174893476u, 1175689033u, 1176485128u, 1177281762u, 1178078936u,
+    1178876649u, 1179674903u, 1180473697u, 1181273032u, 1182072908u, 1182873326u,
+    1183674286u, 1184475788u, 1185277833u, 1186080421u, 1186883552u, 1187687228u,
+    1188491447u, 1189296211u, 1190101520u, 1190907374u, 1191713774u, 1192520720u,
+    1193328213u, 1194136252u, 1194944838u, 1195753972u, 1196563654u, 1197373884u,
+    1198184662u, 1198995990u, 1199807867u, 1200620294u, 1201433270u, 1202246798u,
+    1203060876u, 1203875505u, 1204690686u, 1205506419u, 1206322705u, 1207139543u,
+    1207956934u, 1208774879u, 1209593378u, 1210412430u, 1211232038u, 1212052200u,
+    1212872918u, 1213694191u, 1214516021u, 1215338407u, 1216161350u, 1216984850u,
+    1217808908u, 1218633524u, 1219458698u, 1220284431u, 1221110723u, 1221937574u,
+    1222764986u, 1223592958u, 1224421490u, 1225250583u, 1226080238u, 1226910455u,
+    1227741233u, 1228572575u, 1229404479u, 1230236946u, 1231069977u, 1231903573u,
+    1232737732u, 1233572457u, 1234407747u, 1235243602u, 1236080024u, 1236917011u,
+    1237754566u, 1238592687u, 1239431376u, 1240270633u, 1241110459u, 1241950853u,
+    1242791816u, 1243633348u, 1244475451u, 1245318123u, 1246161366u, 1247005180u,
+    1247849566u, 1248694523u, 1249540052u, 1250386154u, 1251232829u, 1252080077u,
+    1252927899u, 1253776295u, 1254625266u, 1255474811u, 1256324931u, 1257175628u,
+    1258026900u, 1258878748u, 1259731174u, 1260584177u, 1261437757u, 1262291915u,
+    1263146652u, 1264001967u, 1264857861u, 1265714336u, 1266571390u, 1267429024u,
+    1268287239u, 1269146035u, 1270005413u, 1270865373u, 1271725915u, 1272587039u,
+    1273448747u, 1274311038u, 1275173913u, 1276037373u, 1276901417u, 1277766046u,
+    1278631261u, 1279497061u, 1280363448u, 1281230421u, 1282097982u, 1282966129u,
+    1283834865u, 1284704189u, 1285574102u, 1286444604u, 1287315695u, 1288187376u,
+    1289059647u, 1289932509u, 1290805962u, 1291680006u, 1292554642u, 1293429870u,
+    1294305692u, 1295182106u, 1296059113u, 1296936715u, 1297814910u, 1298693701u,
+    1299573086u, 1300453067u, 1301333643u, 1302214816u, 1303096586u, 1303978953u,
+    1304861917u, 1305745479u, 1306629639u, 1307514398u, 1308399756u, 1309285714u,
+    1310172272u, 1311059430u, 1311947188u, 1312835548u, 1313724509u, 1314614072u,
+    1315504238u, 1316395006u, 1317286378u, 1318178353u, 1319070932u, 1319964115u,
+    1320857903u, 1321752297u, 1322647296u, 1323542901u, 1324439112u, 1325335931u,
+    1326233356u, 1327131390u, 1328030031u, 1328929281u, 1329829140u, 1330729608u,
+    1331630686u, 1332532374u, 1333434672u, 1334337582u, 1335241103u, 1336145235u,
+    1337049980u, 1337955338u, 1338861309u, 1339767893u, 1340675091u, 1341582903u,
+    1342491330u, 1343400372u, 1344310030u, 1345220303u, 1346131193u, 1347042700u,
+    1347954824u, 1348867565u, 1349780925u, 1350694903u, 1351609500u, 1352524716u,
+    1353440552u, 1354357009u, 1355274085u, 1356191783u, 1357110102u, 1358029043u,
+    1358948606u, 1359868792u, 1360789601u, 1361711033u, 1362633090u, 1363555770u,
+    1364479076u, 1365403006u, 1366327563u, 1367252745u, 1368178554u, 1369104989u,
+    1370032052u, 1370959743u, 1371888062u, 1372817010u, 1373746586u, 1374676792u,
+    1375607628u, 1376539094u, 1377471191u, 1378403919u, 1379337279u, 1380271270u,
+    1381205894u, 1382141151u, 1383077041u, 1384013565u, 1384950723u, 1385888516u,
+    1386826944u, 1387766007u, 1388705706u, 1389646041u, 1390587013u, 1391528622u,
+    1392470869u, 1393413754u, 1394357277u, 1395301439u, 1396246240u, 1397191682u,
+    1398137763u, 1399084485u, 1400031848u, 1400979853u, 1401928499u, 1402877788u,
+    1403827719u, 1404778294u, 1405729513u, 1406681375u, 1407633882u, 1408587035u,
+    1409540832u, 1410495275u, 1411450365u, 1412406101u, 1413362485u, 1414319516u,
+    1415277195u, 1416235523u, 1417194499u, 1418154125u, 1419114401u, 1420075327u,
+    1421036903u, 1421999131u, 1422962010u, 1423925542u, 1424889725u, 1425854562u,
+    1426820052u, 1427786196u, 1428752993u, 1429720446u, 1430688553u, 1431657317u,
+    1432626736u, 1433596811u, 1434567544u, 1435538933u, 1436510981u, 1437483687u,
+    1438457051u, 1439431074u, 1440405757u, 1441381100u, 1442357104u, 1443333768u,
+    1444311093u, 1445289081u, 1446267730u, 1447247043u, 1448227018u, 1449207657u,
+    1450188960u, 1451170927u, 1452153560u, 1453136858u, 1454120821u, 1455105451u,
+    1456090748u, 1457076711u, 1458063343u, 1459050642u, 1460038610u, 1461027247u,
+    1462016553u, 1463006530u, 1463997176u, 1464988494u, 1465980482u, 1466973143u,
+    1467966475u, 1468960480u, 1469955159u, 1470950510u, 1471946536u, 1472943236u,
+    1473940611u, 1474938662u, 1475937388u, 1476936791u, 1477936870u, 1478937626u,
+    1479939060u, 1480941172u, 1481943963u, 1482947433u, 1483951582u, 1484956411u,
+    1485961921u, 1486968111u, 1487974983u, 1488982537u, 1489990772u, 1490999691u,
+    1492009293u, 1493019578u, 1494030547u, 1495042201u, 1496054540u, 1497067565u,
+    1498081275u, 1499095672u, 1500110755u, 1501126526u, 1502142985u, 1503160132u,
+    1504177968u, 1505196493u, 1506215708u, 1507235613u, 1508256209u, 1509277495u,
+    1510299473u, 1511322143u, 1512345506u, 1513369561u, 1514394310u, 1515419753u,
+    1516445891u, 1517472723u, 1518500250u, 1519528473u, 1520557392u, 1521587009u,
+    1522617322u, 1523648333u, 1524680042u, 1525712449u, 1526745556u, 1527779362u,
+    1528813869u, 1529849076u, 1530884983u, 1531921593u, 1532958904u, 1533996917u,
+    1535035634u, 1536075053u, 1537115177u, 1538156005u, 1539197537u, 1540239775u,
+    1541282719u, 1542326369u, 1543370725u, 1544415789u, 1545461560u, 1546508040u,
+    1547555228u, 1548603125u, 1549651732u, 1550701048u, 1551751076u, 1552801814u,
+    1553853264u, 1554905425u, 1555958300u, 1557011887u, 1558066187u, 1559121202u,
+    1560176931u, 1561233374u, 1562290533u, 1563348408u, 1564406999u, 1565466307u,
+    1566526333u, 1567587076u, 1568648537u, 1569710717u, 1570773616u, 1571837235u,
+    1572901575u, 1573966635u, 1575032416u, 1576098919u, 1577166143u, 1578234091u,
+    1579302762u, 1580372156u, 1581442275u, 1582513118u, 1583584686u, 1584656980u,
+    1585730000u, 1586803746u, 1587878220u, 1588953421u, 1590029350u, 1591106008u,
+    1592183394u, 1593261510u, 1594340357u, 1595419934u, 1596500241u, 1597581281u,
+    1598663052u, 1599745556u, 1600828793u, 1601912763u, 1602997467u, 1604082906u,
+    1605169080u, 1606255989u, 1607343634u, 1608432016u, 1609521135u, 1610610991u,
+    1611701585u, 1612792918u, 1613884989u, 1614977800u, 1616071351u, 1617165643u,
+    1618260675u, 1619356449u, 1620452965u, 1621550224u, 1622648225u, 1623746970u,
+    1624846459u, 1625946692u, 1627047671u, 1628149395u, 1629251865u, 1630355081u,
+    1631459044u, 1632563755u, 1633669214u, 1634775422u, 1635882379u, 1636990085u,
+    1638098541u, 1639207748u, 1640317706u, 1641428415u, 1642539877u, 1643652091u,
+    1644765058u, 1645878779u, 1646993254u, 1648108484u, 1649224469u, 1650341209u,
+    1651458706u, 1652576959u, 1653695970u, 1654815738u, 1655936265u, 1657057550u,
+    1658179594u, 1659302399u, 1660425963u, 1661550289u, 1662675375u, 1663801224u,
+    1664927835u, 1666055209u, 1667183346u, 1668312247u, 1669441912u, 1670572342u,
+    1671703538u, 1672835500u, 1673968228u, 1675101724u, 1676235986u, 1677371017u,
+    1678506817u, 1679643385u, 1680780723u, 1681918831u, 1683057710u, 1684197360u,
+    1685337782u, 1686478976u, 1687620943u, 1688763683u, 1689907196u, 1691051484u,
+    1692196547u, 1693342385u, 1694489000u, 1695636390u, 1696784557u, 1697933502u,
+    1699083225u, 1700233727u, 1701385007u, 1702537067u, 1703689907u, 1704843528u,
+    1705997930u, 1707153113u, 1708309079u, 1709465828u, 1710623359u, 1711781675u,
+    1712940775u, 1714100660u, 1715261330u, 1716422786u, 1717585029u, 1718748058u,
+    1719911875u, 1721076480u, 1722241874u, 1723408057u, 1724575029u, 1725742792u,
+    1726911345u, 1728080690u, 1729250827u, 1730421755u, 1731593477u, 1732765992u,
+    1733939301u, 1735113405u, 1736288303u, 1737463997u, 1738640488u, 1739817774u,
+    1740995858u, 1742174740u, 1743354420u, 1744534899u, 1745716177u, 1746898255u,
+    1748081133u, 1749264813u, 1750449294u, 1751634577u, 1752820662u, 1754007551u,
+    1755195243u, 1756383740u, 1757573041u, 1758763148u, 1759954060u, 1761145779u,
+    1762338305u, 1763531638u, 1764725780u, 1765920730u, 1767116489u, 1768313058u,
+    1769510437u, 1770708627u, 1771907628u, 1773107441u, 1774308066u, 1775509505u,
+    1776711757u, 1777914823u, 1779118704u, 1780323399u, 1781528911u, 1782735239u,
+    1783942384u, 1785150346u, 1786359126u, 1787568724u, 1788779142u, 1789990379u,
+    1791202437u, 1792415315u, 1793629014u, 1794843536u, 1796058879u, 1797275046u,
+    1798492036u, 1799709850u, 1800928489u, 1802147953u, 1803368243u, 1804589359u,
+    1805811301u, 1807034072u, 1808257670u, 1809482097u, 1810707353u, 1811933438u,
+    1813160354u, 1814388100u, 1815616678u, 1816846088u, 1818076330u, 1819307406u,
+    1820539314u, 1821772057u, 1823005635u, 1824240048u, 1825475297u, 1826711383u,
+    1827948305u, 1829186065u, 1830424663u, 1831664100u, 1832904376u, 1834145491u,
+    1835387448u, 1836630245u, 1837873883u, 1839118364u, 1840363688u, 1841609855u,
+    1842856865u, 1844104720u, 1845353420u, 1846602965u, 1847853357u, 1849104595u,
+    1850356681u, 1851609614u, 1852863396u, 1854118026u, 1855373507u, 1856629837u,
+    1857887018u, 1859145050u, 1860403934u, 1861663671u, 1862924261u, 1864185704u,
+    1865448001u, 1866711153u, 1867975161u, 1869240024u, 1870505744u, 1871772321u,
+    1873039755u, 1874308048u, 1875577199u, 1876847210u, 1878118081u, 1879389813u,
+    1880662405u, 1881935859u, 1883210176u, 1884485355u, 1885761398u, 1887038305u,
+    1888316077u, 1889594713u, 1890874216u, 1892154585u, 1893435821u, 1894717924u,
+    1896000896u, 1897284736u, 1898569446u, 1899855026u, 1901141476u, 1902428797u,
+    1903716990u, 1905006055u, 1906295993u, 1907586805u, 1908878490u, 1910171051u,
+    1911464486u, 1912758797u, 1914053985u, 1915350050u, 1916646992u, 1917944813u,
+    1919243512u, 1920543091u, 1921843549u, 1923144889u, 1924447109u, 1925750211u,
+    1927054196u, 1928359063u, 1929664814u, 1930971450u, 1932278970u, 1933587375u,
+    1934896666u, 1936206844u, 1937517909u, 1938829862u, 1940142704u, 1941456434u,
+    1942771053u, 1944086563u, 1945402964u, 1946720256u, 1948038440u, 1949357517u,
+    1950677487u, 1951998350u, 1953320108u, 1954642761u, 1955966310u, 1957290755u,
+    1958616096u, 1959942335u, 1961269472u, 1962597508u, 1963926443u, 1965256278u,
+    1966587013u, 1967918650u, 1969251188u, 1970584628u, 1971918972u, 1973254219u,
+    1974590370u, 1975927425u, 1977265386u, 1978604253u, 1979944027u, 1981284708u,
+    1982626297u, 1983968794u, 1985312200u, 1986656516u, 1988001742u, 1989347879u,
+    1990694927u, 1992042888u, 1993391761u, 1994741548u, 1996092249u, 1997443864u,
+    1998796395u, 2000149841u, 2001504204u, 2002859484u, 2004215682u, 2005572798u,
+    2006930832u, 2008289787u, 2009649662u, 2011010457u, 2012372174u, 2013734813u,
+    2015098375u, 2016462860u, 2017828268u, 2019194602u, 2020561860u, 2021930045u,
+    2023299156u, 2024669194u, 2026040159u, 2027412053u, 2028784876u, 2030158629u,
+    2031533312u, 2032908925u, 2034285470u, 2035662947u, 2037041357u, 2038420700u,
+    2039800978u, 2041182189u, 2042564337u, 2043947420u, 2045331439u, 2046716396u,
+    2048102290u, 2049489123u, 2050876895u, 2052265607u, 2053655259u, 2055045852u,
+    2056437387u, 2057829863u, 2059223283u, 2060617646u, 2062012954u, 2063409206u,
+    2064806404u, 2066204548u, 2067603638u, 2069003676u, 2070404662u, 2071806597u,
+    2073209480u, 2074613314u, 2076018099u, 2077423834u, 2078830522u, 2080238161u,
+    2081646755u, 2083056301u, 2084466803u, 2085878259u, 2087290671u, 2088704040u,
+    2090118366u, 2091533649u, 2092949891u, 2094367091u, 2095785251u, 2097204372u,
+    2098624453u, 2100045496u, 2101467502u, 2102890470u, 2104314402u, 2105739297u,
+    2107165158u, 2108591984u, 2110019777u, 2111448536u, 2112878262u, 2114308957u,
+    2115740621u, 2117173254u, 2118606857u, 2120041430u, 2121476975u, 2122913493u,
+    2124350982u, 2125789446u, 2127228883u, 2128669295u, 2130110682u, 2131553046u,
+    2132996386u, 2134440703u, 2135885998u, 2137332272u, 2138779525u, 2140227759u,
+    2141676973u, 2143127168u, 2144578345u, 2146030505u, 2147483648u
+};
+
+/* log2(1 + x), x = i / 1024 */
+const uint32_t fx_lut_log2[FX_LUT_LEN] = {
+             0u,    1512037u,    3022600u,    4531691u,    6039314u,    7545470u,
+       9050164u,   10553398u,   12055174u,   13555495u,   15054365u,   16551786u,
+      18047761u,   19542293u,   21035384u,   22527038u,   24017256u,   25506043u,
+      26993399u,   28479330u,   29963836u,   31446921u,   32928587u,   34408837u,
+      35887675u,   37365102u,   38841121u,   40315735u,   41788947u,   43260759u,
+      44731173u,   46200194u,   47667823u,   49134062u,   50598915u,   52062385u,
+      53524472u,   54985182u,   56444515u,   57902474u,   59359063u,   60814284u,
+      62268138u,   63720630u,   65171760u,   66621533u,   68069950u,   69517014u,
+      70962728u,   72407094u,   73850114u,   75291791u,   76732128u,   78171126u,
+      79608789u,   81045120u,   82480119u,   83913791u,   85346137u,   86777160u,
+      88206862u,   89635245u,   91062313u,   92488067u,   93912511u,   95335645u,
+      96757474u,   98177998u,   99597222u,  101015146u,  102431773u,  103847106u,
+     105261148u,  106673899u,  108085363u,  109495543u,  110904440u,  112312056u,
+     113718395u,  115123458u,  116527248u,  117929767u,  119331017u,  120731001u,
+     122129721u,  123527179u,  124923377u,  126318318u,  127712004u,  129104438u,
+     130495621u,  131885555u,  133274244u,  134661689u,  136047892u,  137432856u,
+     138816582u,  140199074u,  141580333u,  142960362u,  144339162u,  145716736u,
+     147093087u,  148468215u,  149842124u,  151214815u,  152586291u,  153956554u,
+     155325606u,  156693448u,  158060085u,  159425516u,  160789745u,  162152774u,
+     163514604u,  164875239u,  166234679u,  167592927u,  168949985u,  170305856u,
+     171660541u,  173014042u,  174366362u,  175717502u,  177067464u,  178416251u,
+     179763865u,  181110308u,  182455581u,  183799687u,  185142628u,  186484405u,
+     187825021u,  189164478u,  190502778u,  191839923u,  193175914u,  194510755u,
+     195844446u,  197176989u,  198508388u,  199838643u,  201167757u,  202495731u,
+     203822568u,  205148270u,  206472837u,  207796274u,  209118580u,  210439759u,
+     211759812u,  213078741u,  214396548u,  215713235u,  217028803u,  218343256u,
+     219656594u,  220968819u,  222279934u,  223589940u,  224898839u,  226206633u,
+     227513324u,  228818914u,  230123404u,  231426796u,  232729093u,  234030296u,
+     235330407u,  236629428u,  237927360u,  239224205u,  240519966u,  241814644u,
+     243108241u,  244400758u,  245692198u,  246982562u,  248271852u,  249560070u,
+     250847218u,  252133297u,  253418309u,  254702256u,  255985140u,  257266962u,
+     258547724u,  259827429u,  261106077u,  262383670u,  263660211u,  264935700u,
+     266210141u,  267483533u,  268755880u,  270027182u,  271297442u,  272566662u,
+     273834842u,  275101985u,  276368092u,  277633165u,  278897206u,  280160216u,
+     281422197u,  282683151u,  283943080u,  285201984u,  286459867u,  287716729u,
+     288972571u,  290227397u,  291481207u,  292734003u,  293985786u,  295236559u,
+     296486323u,  297735079u,  298982829u,  300229575u,  301475319u,  302720061u,
+     303963805u,  305206550u,  306448299u,  307689054u,  308928815u,  310167585u,
+     311405366u,  312642158u,  313877963u,  315112784u,  316346620u,  317579475u,
+     318811350u,  320042245u,  321272163u,  322501106u,  323729074u,  324956070u,
+     326182095u,  327407150u,  328631237u,  329854357u,  331076513u,  332297705u,
+     333517935u,  334737204u,  335955515u,  337172868u,  338389266u,  339604709u,
+     340819199u,  342032738u,  343245326u,  344456966u,  345667660u,  346877408u,
+     348086211u,  349294073u,  350500993u,  351706974u,  352912016u,  354116122u,
+     355319292u,  356521529u,  357722834u,  358923207u,  360122651u,  361321167u,
+     362518757u,  363715421u,  364911162u,  366105980u,  367299878u,  368492856u,
+     369684916u,  370876060u,  372066288u,  373255602u,  374444004u,  375631495u,
+     376818077u,  378003750u,  379188517u,  380372378u,  381555334u,  382737389u,
+     383918542u,  385098795u,  386278149u,  387456606u,  388634168u,  389810835u,
+     390986609u,  392161491u,  393335482u,  394508585u,  395680800u,  396852129u,
+     398022572u,  399192132u,  400360810u,  401528606u,  402695523u,  403861562u,
+     405026723u,  406191009u,  407354420u,  408516958u,  409678624u,  410839420u,
+     411999347u,  413158406u,  414316598u,  415473925u,  416630388u,  417785988u,
+     418940727u,  420094605u,  421247625u,  422399787u,  423551093u,  424701544u,
+     425851141u,  426999886u,  428147779u,  429294822u,  430441017u,  431586364u,
+     432730865u,  433874521u,  435017334u,  436159303u,  437300432u,  438440721u,
+     439580170u,  440718783u,  441856559u,  442993500u,  444129607u,  445264881u,
+     446399325u,  447532938u,  448665721u,  449797678u,  450928807u,  452059112u,
+     453188592u,  454317249u,  455445085u,  456572100u,  457698295u,  458823673u,
+     459948233u,  461071978u,  462194908u,  463317025u,  464438329u,  465558822u,
+     466678506u,  467797381u,  468915448u,  470032709u,  471149164u,  472264816u,
+     473379664u,  474493711u,  475606957u,  476719404u,  477831052u,  478941904u,
+     480051959u,  481161219u,  482269686u,  483377360u,  484484242u,  485590334u,
+     486695637u,  487800152u,  488903880u,  490006822u,  491108979u,  492210353u,
+     493310944u,  494410754u,  495509783u,  496608034u,  497705506u,  498802201u,
+     499898121u,  500993265u,  502087636u,  503181235u,  504274061u,  505366118u,
+     506457405u,  507547924u,  508637676u,  509726661u,  510814882u,  511902339u,
+     512989032u,  514074964u,  515160136u,  516244547u,  517328201u,  518411096u,
+     519493235u,  520574619u,  521655248u,  522735124u,  523814248u,  524892620u,
+     525970243u,  527047116u,  528123241u,  529198619u,  530273251u,  531347138u,
+     532420281u,  533492681u,  534564339u,  535635257u,  536705435u,  537774873u,
+     538843574u,  539911538u,  540978767u,  542045261u,  543111021u,  544176048u,
+     545240343u,  546303908u,  547366743u,  548428849u,  549490228u,  550550880u,
+     551610806u,  552670007u,  553728485u,  554786240u,  555843273u,  556899585u,
+     557955178u,  559010052u,  560064208u,  561117647u,  562170370u,  563222378u,
+     564273672u,  565324253u,  566374123u,  567423281u,  568471729u,  569519468u,
+     570566499u,  571612822u,  572658440u,  573703352u,  574747559u,  575791063u,
+     576833865u,  577875966u,  578917365u,  579958065u,  580998067u,  582037370u,
+     583075977u,  584113888u,  585151104u,  586187626u,  587223455u,  588258592u,
+     589293037u,  590326792u,  591359858u,  592392235u,  593423925u,  594454928u,
+     595485245u,  596514878u,  597543826u,  598572092u,  599599675u,  600626577u,
+     601652799u,  602678342u,  603703206u,  604727393u,  605750902u,  606773736u,
+     607795895u,  608817380u,  609838192u,  610858332u,  611877800u,  612896598u,
+     613914726u,  614932186u,  615948977u,  616965102u,  617980561u,  618995354u,
+     620009483u,  621022949u,  622035751u,  623047893u,  624059373u,  625070193u,
+     626080354u,  627089857u,  628098702u,  629106891u,  630114424u,  631121302u,
+     632127527u,  633133098u,  634138016u,  635142283u,  636145900u,  637148867u,
+     638151184u,  639152854u,  640153876u,  641154252u,  642153982u,  643153068u,
+     644151509u,  645149308u,  646146464u,  647142979u,  648138853u,  649134087u,
+     650128682u,  651122639u,  652115959u,  653108642u,  654100689u,  655092102u,
+     656082880u,  657073026u,  658062538u,  659051419u,  660039669u,  661027289u,
+     662014280u,  663000642u,  663986377u,  664971485u,  665955967u,  666939823u,
+     667923055u,  668905664u,  669887649u,  670869012u,  671849754u,  672829876u,
+     673809378u,  674788261u,  675766525u,  676744172u,  677721203u,  678697618u,
+     679673418u,  680648603u,  681623175u,  682597134u,  683570481u,  684543217u,
+     685515343u,  686486859u,  687457766u,  688428064u,  689397756u,  690366841u,
+     691335320u,  692303193u,  693270463u,  694237129u,  695203192u,  696168653u,
+     697133512u,  698097771u,  699061430u,  700024490u,  700986952u,  701948816u,
+     702910083u,  703870754u,  704830830u,  705790311u,  706749198u,  707707492u,
+     708665193u,  709622303u,  710578822u,  711534750u,  712490089u,  713444839u,
+     714399001u,  715352576u,  716305564u,  717257966u,  718209783u,  719161016u,
+     720111664u,  721061730u,  722011213u,  722960115u,  723908436u,  724856176u,
+     725803337u,  726749920u,  727695924u,  728641351u,  729586201u,  730530476u,
+     731474175u,  732417299u,  733359850u,  734301828u,  735243233u,  736184066u,
+     737124328u,  738064020u,  739003142u,  739941695u,  740879680u,  741817098u,
+     742753948u,  743690232u,  744625951u,  745561104u,  746495694u,  747429720u,
+     748363183u,  749296084u,  750228423u,  751160202u,  752091421u,  753022080u,
+     753952180u,  754881722u,  755810707u,  756739135u,  757667007u,  758594323u,
+     759521085u,  760447292u,  761372946u,  762298048u,  763222597u,  764146594u,
+     765070041u,  765992938u,  766915285u,  767837083u,  768758333u,  769679036u,
+     770599192u,  771518801u,  772437865u,  773356384u,  774274358u,  775191789u,
+     776108677u,  777025022u,  777940826u,  778856089u,  779770811u,  780684993u,
+     781598637u,  782511741u,  783424308u,  784336337u,  785247830u,  786158787u,
+     787069209u,  787979095u,  788888448u,  789797267u,  790705553u,  791613307u,
+     792520529u,  793427220u,  794333381u,  795239012u,  796144114u,  797048688u,
+     797952733u,  798856252u,  799759243u,  800661709u,  801563649u,  802465064u,
+     803365955u,  804266322u,  805166167u,  806065489u,  806964289u,  807862568u,
+     808760326u,  809657565u,  810554283u,  811450484u,  812346166u,  813241330u,
+     814135978u,  815030109u,  815923724u,  816816824u,  817709409u,  818601481u,
+     819493039u,  820384084u,  821274617u,  822164638u,  823054148u,  823943148u,
+     824831638u,  825719619u,  826607090u,  827494054u,  828380510u,  829266459u,
+     830151902u,  831036839u,  831921271u,  832805198u,  833688620u,  834571540u,
+     835453956u,  836335870u,  837217283u,  838098194u,  838978604u,  839858514u,
+     840737925u,  841616837u,  842495250u,  843373166u,  844250584u,  845127506u,
+     846003931u,  846879861u,  847755296u,  848630236u,  849504683u,  850378636u,
+     851252097u,  852125065u,  852997541u,  853869527u,  854741022u,  855612026u,
+     856482542u,  857352568u,  858222106u,  859091156u,  859959719u,  860827796u,
+     861695386u,  862562490u,  863429109u,  864295244u,  865160895u,  866026062u,
+     866890747u,  867754949u,  868618669u,  869481908u,  870344666u,  871206943u,
+     872068741u,  872930060u,  873790901u,  874651263u,  875511147u,  876370555u,
+     877229486u,  878087941u,  878945920u,  879803425u,  880660455u,  881517011u,
+     882373094u,  883228704u,  884083842u,  884938508u,  885792703u,  886646427u,
+     887499680u,  888352464u,  889204779u,  890056625u,  890908003u,  891758913u,
+     892609356u,  893459333u,  894308843u,  895157888u,  896006467u,  896854582u,
+     897702233u,  898549421u,  899396145u,  900242406u,  901088206u,  901933544u,
+     902778421u,  903622838u,  904466794u,  905310291u,  906153329u,  906995908u,
+     907838029u,  908679693u,  909520900u,  910361650u,  911201944u,  912041782u,
+     912881166u,  913720095u,  914558569u,  915396590u,  916234158u,  917071274u,
+     917907937u,  918744149u,  919579909u,  920415219u,  921250079u,  922084489u,
+     922918449u,  923751961u,  924585025u,  925417641u,  926249810u,  927081532u,
+     927912807u,  928743637u,  929574021u,  930403961u,  931233456u,  932062507u,
+     932891115u,  933719279u,  934547002u,  935374282u,  936201120u,  937027518u,
+     937853475u,  938678991u,  939504068u,  940328706u,  941152905u,  941976666u,
+     942799989u,  943622874u,  944445323u,  945267335u,  946088911u,  946910052u,
+     947730758u,  948551029u,  949370866u,  950190269u,  951009239u,  951827777u,
+     952645882u,  953463555u,  954280797u,  955097608u,  955913989u,  956729939u,
+     957545460u,  958360552u,  959175215u,  959989450u,  960803257u,  961616637u,
+     962429590u,  963242117u,  964054218u,  964865893u,  965677143u,  966487968u,
+     967298370u,  968108347u,  968917901u,  969727033u,  970535742u,  971344029u,
+     972151894u,  972959339u,  973766362u,  974572966u,  975379150u,  976184914u,
+     976990259u,  977795186u,  978599695u,  979403787u,  980207461u,  981010718u,
+     981813560u,  982615985u,  983417995u,  984219590u,  985020770u,  985821536u,
+     986621888u,  987421827u,  988221354u,  989020467u,  989819169u,  990617459u,
+     991415338u,  992212807u,  993009864u,  993806512u,  994602751u,  995398580u,
+     996194001u,  996989014u,  997783619u,  998577816u,  999371606u, 1000164990u,
+    1000957968u, 1001750540u, 1002542707u, 1003334469u, 1004125826u, 1004916779u,
+    1005707329u, 1006497475u, 1007287219u, 1008076560u, 1008865499u, 1009654037u,
+    1010442173u, 1011229909u, 1012017244u, 1012804179u, 1013590715u, 1014376852u,
+    1015162589u, 1015947929u, 1016732870u, 1017517414u, 1018301561u, 1019085311u,
+    1019868665u, 1020651623u, 1021434185u, 1022216352u, 1022998125u, 1023779503u,
+    1024560487u, 1025341077u, 1026121275u, 1026901080u, 1027680492u, 1028459512u,
+    1029238141u, 1030016379u, 1030794226u, 1031571682u, 1032348749u, 1033125425u,
+    1033901713u, 1034677612u, 1035453122u, 1036228245u, 1037002979u, 1037777327u,
+    1038551287u, 1039324861u, 1040098049u, 1040870852u, 1041643268u, 1042415300u,
+    1043186948u, 1043958211u, 1044729090u, 1045499586u, 1046269699u, 1047039429u,
+    1047808777u, 1048577743u, 1049346328u, 1050114531u, 1050882354u, 1051649796u,
+    1052416858u, 1053183540u, 1053949844u, 1054715768u, 1055481314u, 1056246482u,
+    1057011272u, 1057775684u, 1058539720u, 1059303378u, 1060066661u, 1060829568u,
+    1061592099u, 1062354255u, 1063116036u, 1063877443u, 1064638476u, 1065399135u,
+    1066159420u, 1066919333u, 1067678873u, 1068438041u, 1069196837u, 1069955261u,
+    1070713315u, 1071470997u, 1072228309u, 1072985252u, 1073741824u
+};
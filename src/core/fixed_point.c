@@ -20,6 +20,7 @@
  */
 
 #include "fixed_point.h"
+#include "fixed_lut.h"
 
 fixed_t fixed_mul(fixed_t a, fixed_t b) {
     /* Cast to 64-bit to prevent overflow during the multiplication step.
@@ -62,3 +63,15 @@ fixed_t fixed_div(fixed_t a, fixed_t b) {
     /* Perform division and cast back to fixed_t */
     return (fixed_t)(numerator / b);
 }
+
+fixed_t fixed_sigmoid(fixed_t x) {
+    return fx_lut_sigmoid_eval(x);
+}
+
+fixed_t fixed_tanh(fixed_t x) {
+    return fx_lut_tanh_eval(x);
+}
+
+fixed_t fixed_exp(fixed_t x) {
+    return fx_lut_exp_eval(x);
+}
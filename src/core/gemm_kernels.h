@@ -0,0 +1,159 @@
+/**
+ * @file gemm_kernels.h
+ * @project Certifiable Inference Engine
+ * @brief Internal integer multiply-accumulate and activation kernel table.
+ *
+ * @details Private to the library. Each kernel set implements the same exact
+ * int64_t accumulation and the same element-wise activations; the active set
+ * is chosen by cpu_dispatch.c.
+ *
+ * @traceability SRS-003.5, SRS-003.10, SRS-003.12, SRS-003.13, SRS-004.10, SRS-009.7
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef GEMM_KERNELS_H
+#define GEMM_KERNELS_H
+
+#include "matrix.h"
+#include "activations.h"
+#include <stdint.h>
+#include <stddef.h>
+
+/** @brief x86 SIMD kernels are compiled (GCC/Clang on x86, not disabled) */
+#if !defined(FX_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FX_HAVE_X86_KERNELS 1
+#else
+#define FX_HAVE_X86_KERNELS 0
+#endif
+
+/**
+ * @brief GEMV software prefetch distance in elements, 0 = off (CI_GEMV_PREFETCH).
+ *
+ * Off by default: on x86 the hardware stream prefetcher already follows the
+ * four sequential weight rows and explicit prefetches measured slower. Cores
+ * without a stream prefetcher can set e.g. 64 (256 bytes ahead).
+ */
+#ifndef FX_GEMV_PREFETCH
+#define FX_GEMV_PREFETCH 0u
+#endif
+
+/** @brief Read prefetch with no temporal reuse; weights are streamed once */
+#if defined(__GNUC__)
+#define FX_PREFETCH(p) __builtin_prefetch((p), 0, 0)
+#else
+#define FX_PREFETCH(p) ((void)(p))
+#endif
+
+/**
+ * @brief Multiply-accumulate kernel set.
+ *
+ * All kernels add exact Q32.32 products into int64_t accumulators; none of
+ * them round. Rounding is done once by the caller. The exceptions are the
+ * qdot32 kernels, which sum Q16.16 × narrow-integer products in int32_t and
+ * are only called once the caller has proven that no partial sum leaves
+ * int32_t (qweights.c).
+ */
+typedef struct {
+    /** @brief Returns Σ a[k] * b[k] for k in [0, len) */
+    int64_t (*dot)(const fixed_t* a, const fixed_t* b, size_t len);
+
+    /**
+     * @brief acc[j] += Σ a[k] * b[k * ldb + j] for j in [0, FX_GEMM_NR)
+     *
+     * Row of A against an FX_GEMM_NR-wide strip of a row-major B.
+     */
+    void (*row_strip)(size_t kc, const fixed_t* a,
+                      const fixed_t* b, size_t ldb, int64_t* acc);
+
+    /**
+     * @brief acc[r][j] += Σ a[r * lda + k] * panel[k * NR + j]
+     *
+     * Register-blocked micro-kernel over a packed FX_GEMM_NR-wide panel, for
+     * r in [0, mr) with mr <= FX_GEMM_MR. Accumulator row stride is ldacc.
+     */
+    void (*micro)(size_t mr, size_t kc, const fixed_t* a, size_t lda,
+                  const fixed_t* panel, int64_t* acc, size_t ldacc);
+
+    /**
+     * @brief data[i] = min(max(data[i], lo), hi) in place, lo <= hi
+     *
+     * Branchless element-wise activation; ReLU is clamp(0, FIXED_MAX).
+     */
+    void (*clamp)(fixed_t* data, size_t n, fixed_t lo, fixed_t hi);
+
+    /**
+     * @brief data[i] = data[i] < 0 ? fixed_mul(data[i], alpha) : data[i]
+     *
+     * Branchless: every lane is multiplied and the result selected by the
+     * sign mask, bit-identical to fixed_mul() including its wrap.
+     */
+    void (*leaky)(fixed_t* data, size_t n, fixed_t alpha);
+
+    /**
+     * @brief Returns Σ x[k] * q[k] for k in [0, len), int8_t weights
+     *
+     * Requires Σ |x[k]| * |q[k]| <= INT32_MAX; the sum is then exact.
+     */
+    int32_t (*qdot32_i8)(const fixed_t* x, const int8_t* q, size_t len);
+
+    /** @brief As qdot32_i8, int16_t weights */
+    int32_t (*qdot32_i16)(const fixed_t* x, const int16_t* q, size_t len);
+
+    /**
+     * @brief out[r] = Σ x[k] * w[r * ldw + k] for r in [0, 4), k in [0, len)
+     *
+     * GEMV row block: four weight rows stream against one shared x load,
+     * each into its own accumulators, optionally prefetched
+     * FX_GEMV_PREFETCH elements ahead.
+     */
+    void (*dot4)(const fixed_t* x, const fixed_t* w, size_t ldw, size_t len, int64_t* out);
+} fx_gemm_kernels_t;
+
+/** @brief Portable reference kernels (always available) */
+extern const fx_gemm_kernels_t fx_gemm_kernels_scalar;
+
+#if FX_HAVE_X86_KERNELS
+/** @brief SSE4.1 kernels (only call after cpuid check) */
+extern const fx_gemm_kernels_t fx_gemm_kernels_sse41;
+
+/** @brief AVX2 kernels (only call after cpuid check) */
+extern const fx_gemm_kernels_t fx_gemm_kernels_avx2;
+#endif
+
+/**
+ * @brief Compute the region [i0, i1) × [j0, j1) of C = A × B.
+ *
+ * @details Shared by fx_matrix_mul() and the parallel GEMM so that every
+ * output element is always formed by the same sequential k-loop, however the
+ * output is partitioned. j0 should be a multiple of FX_GEMM_NR for full
+ * strip utilisation; results are exact either way. No validation.
+ */
+void fx_gemm_region(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C,
+                    size_t i0, size_t i1, size_t j0, size_t j1);
+
+/**
+ * @brief C = act(A × W + bias) over packed weights.
+ *
+ * @details Shared by fx_matrix_mul_packed(), fx_dense_forward_packed() and
+ * fx_conv2d_im2col_packed(). Element (i, j) is stored at
+ * c[i * ldc + j * c_step], so the result can be written row-major or
+ * transposed (NCHW planes). With bias, bias[j] << 16 starts the
+ * accumulator, and act (NULL for identity) is applied to each rounded tile
+ * row before its single store, as in fx_dense_forward(). No validation.
+ */
+void fx_gemm_packed(const fx_matrix_t* A, const fx_packed_weights_t* W, const fixed_t* bias,
+                    const fx_activation_t* act, fixed_t* c, size_t ldc, size_t c_step);
+
+/**
+ * @brief Active kernel set, selected by fx_dispatch_init().
+ *
+ * @return Never NULL; initializes dispatch on first call
+ */
+const fx_gemm_kernels_t* fx_gemm_kernels(void);
+
+#endif /* GEMM_KERNELS_H */
@@ -0,0 +1,172 @@
+/**
+ * @file gemm_kernels_scalar.c
+ * @project Certifiable Inference Engine
+ * @brief Portable reference multiply-accumulate and activation kernels.
+ *
+ * @details These are the reference against which every SIMD kernel set is
+ * self-checked. Plain C99, sequential k order, exact int64_t accumulation.
+ *
+ * @traceability SRS-003.5, SRS-003.6, SRS-003.10
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "gemm_kernels.h"
+
+static int64_t scalar_dot(const fixed_t* a, const fixed_t* b, size_t len) {
+    /* SRS-003.5: 64-bit accumulator for overflow protection */
+    int64_t sum = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        sum += (int64_t)a[i] * b[i];
+    }
+
+    return sum;
+}
+
+static void scalar_row_strip(size_t kc, const fixed_t* a,
+                             const fixed_t* b, size_t ldb, int64_t* acc) {
+    int64_t c[FX_GEMM_NR];
+
+    for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+        c[jj] = acc[jj];
+    }
+
+    for (size_t k = 0; k < kc; k++) {
+        const int64_t a_k = a[k];
+        const fixed_t* b_row = &b[k * ldb];
+        for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+            c[jj] += a_k * b_row[jj];
+        }
+    }
+
+    for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+        acc[jj] = c[jj];
+    }
+}
+
+static void scalar_micro(size_t mr, size_t kc, const fixed_t* a, size_t lda,
+                         const fixed_t* panel, int64_t* acc, size_t ldacc) {
+    if (mr == FX_GEMM_MR) {
+        int64_t c[FX_GEMM_MR][FX_GEMM_NR];
+
+        for (size_t r = 0; r < FX_GEMM_MR; r++) {
+            for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+                c[r][jj] = acc[r * ldacc + jj];
+            }
+        }
+
+        for (size_t k = 0; k < kc; k++) {
+            const fixed_t* b = &panel[k * FX_GEMM_NR];
+            for (size_t r = 0; r < FX_GEMM_MR; r++) {
+                const int64_t a_rk = a[r * lda + k];
+                for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+                    c[r][jj] += a_rk * b[jj];
+                }
+            }
+        }
+
+        for (size_t r = 0; r < FX_GEMM_MR; r++) {
+            for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+                acc[r * ldacc + jj] = c[r][jj];
+            }
+        }
+        return;
+    }
+
+    /* Edge tile: fewer than MR rows remain */
+    for (size_t r = 0; r < mr; r++) {
+        scalar_row_strip(kc, &a[r * lda], panel, FX_GEMM_NR, &acc[r * ldacc]);
+    }
+}
+
+static void scalar_clamp(fixed_t* data, size_t n, fixed_t lo, fixed_t hi) {
+    for (size_t i = 0; i < n; i++) {
+        /* All-ones / all-zeros masks from the comparisons: no branches */
+        const int32_t v = data[i];
+        const int32_t below = -(int32_t)(v < lo);
+        const int32_t w = (v & ~below) | (lo & below);
+        const int32_t above = -(int32_t)(w > hi);
+
+        data[i] = (w & ~above) | (hi & above);
+    }
+}
+
+static void scalar_leaky(fixed_t* data, size_t n, fixed_t alpha) {
+    for (size_t i = 0; i < n; i++) {
+        const int32_t v = data[i];
+        const int32_t neg = -(int32_t)(v < 0);
+        /* Same arithmetic as fixed_mul(), inlined */
+        const int32_t scaled = (int32_t)(((int64_t)v * alpha + FIXED_HALF) >> FIXED_SHIFT);
+
+        data[i] = (v & ~neg) | (scaled & neg);
+    }
+}
+
+static int32_t scalar_qdot32_i8(const fixed_t* x, const int8_t* q, size_t len) {
+    int32_t acc = 0;
+
+    for (size_t k = 0; k < len; k++) {
+        acc += x[k] * q[k];
+    }
+
+    return acc;
+}
+
+static int32_t scalar_qdot32_i16(const fixed_t* x, const int16_t* q, size_t len) {
+    int32_t acc = 0;
+
+    for (size_t k = 0; k < len; k++) {
+        acc += x[k] * q[k];
+    }
+
+    return acc;
+}
+
+static void scalar_dot4(const fixed_t* x, const fixed_t* w, size_t ldw, size_t len,
+                        int64_t* out) {
+    const fixed_t* w0 = w;
+    const fixed_t* w1 = &w[ldw];
+    const fixed_t* w2 = &w[2u * ldw];
+    const fixed_t* w3 = &w[3u * ldw];
+    int64_t a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+
+    for (size_t k = 0; k < len; k++) {
+        const int64_t xv = x[k];
+
+#if FX_GEMV_PREFETCH > 0
+        /* One prefetch per cache line of each row */
+        if ((k & 15u) == 0u && k + FX_GEMV_PREFETCH < len) {
+            FX_PREFETCH(&w0[k + FX_GEMV_PREFETCH]);
+            FX_PREFETCH(&w1[k + FX_GEMV_PREFETCH]);
+            FX_PREFETCH(&w2[k + FX_GEMV_PREFETCH]);
+            FX_PREFETCH(&w3[k + FX_GEMV_PREFETCH]);
+        }
+#endif
+
+        a0 += xv * w0[k];
+        a1 += xv * w1[k];
+        a2 += xv * w2[k];
+        a3 += xv * w3[k];
+    }
+
+    out[0] = a0;
+    out[1] = a1;
+    out[2] = a2;
+    out[3] = a3;
+}
+
+const fx_gemm_kernels_t fx_gemm_kernels_scalar = {
+    scalar_dot,
+    scalar_row_strip,
+    scalar_micro,
+    scalar_clamp,
+    scalar_leaky,
+    scalar_qdot32_i8,
+    scalar_qdot32_i16,
+    scalar_dot4
+};
@@ -0,0 +1,519 @@
+/**
+ * @file gemm_kernels_x86.c
+ * @project Certifiable Inference Engine
+ * @brief SSE4.1 and AVX2 multiply-accumulate and activation kernels.
+ *
+ * @details Widening signed multiplies (_mm_mul_epi32 / _mm256_mul_epi32)
+ * produce the exact 64-bit product of two Q16.16 values in each lane, and
+ * lanes are accumulated with 64-bit integer adds. Integer addition is
+ * associative, so the lane-parallel order yields exactly the same sum as the
+ * sequential scalar reference.
+ *
+ * Activations are branchless: clamp is a packed signed max/min, and leaky
+ * ReLU multiplies every lane with the same widening multiply, then selects
+ * the scaled value by the sign mask.
+ *
+ * The qdot32 kernels sign-extend narrow weights to 32 bits and use the
+ * low-half multiply (_mm_mullo_epi32), twice the lanes of the widening
+ * form; their callers guarantee the int32_t sums cannot overflow.
+ *
+ * The GEMV kernels (dot4) share each load of x across four weight rows,
+ * with separate even/odd accumulators per row.
+ *
+ * Functions carry per-function target attributes; the file is compiled with
+ * the project's baseline flags and only entered after a cpuid check in
+ * cpu_dispatch.c.
+ *
+ * @traceability SRS-003.5, SRS-003.10, SRS-003.12, SRS-009.7
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "gemm_kernels.h"
+
+#if FX_HAVE_X86_KERNELS
+
+#include <immintrin.h>
+#include <string.h>
+
+#define FX_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define FX_TARGET_AVX2  __attribute__((target("avx2")))
+
+/* ─────────────────────────────── SSE4.1 ─────────────────────────────── */
+
+FX_TARGET_SSE41
+static int64_t sse41_dot(const fixed_t* a, const fixed_t* b, size_t len) {
+    __m128i acc_even = _mm_setzero_si128();
+    __m128i acc_odd = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 4 <= len; i += 4) {
+        const __m128i va = _mm_loadu_si128((const __m128i*)(const void*)&a[i]);
+        const __m128i vb = _mm_loadu_si128((const __m128i*)(const void*)&b[i]);
+
+        /* Signed low dword of each qword: elements 0, 2 then 1, 3 */
+        acc_even = _mm_add_epi64(acc_even, _mm_mul_epi32(va, vb));
+        acc_odd = _mm_add_epi64(acc_odd, _mm_mul_epi32(_mm_srli_epi64(va, 32),
+                                                       _mm_srli_epi64(vb, 32)));
+    }
+
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)(void*)lanes, _mm_add_epi64(acc_even, acc_odd));
+    int64_t sum = lanes[0] + lanes[1];
+
+    for (; i < len; i++) {
+        sum += (int64_t)a[i] * b[i];
+    }
+
+    return sum;
+}
+
+FX_TARGET_SSE41
+static void sse41_row_strip(size_t kc, const fixed_t* a,
+                            const fixed_t* b, size_t ldb, int64_t* acc) {
+    __m128i c0 = _mm_loadu_si128((const __m128i*)(const void*)&acc[0]);
+    __m128i c1 = _mm_loadu_si128((const __m128i*)(const void*)&acc[2]);
+    __m128i c2 = _mm_loadu_si128((const __m128i*)(const void*)&acc[4]);
+    __m128i c3 = _mm_loadu_si128((const __m128i*)(const void*)&acc[6]);
+
+    for (size_t k = 0; k < kc; k++) {
+        const fixed_t* b_row = &b[k * ldb];
+        const __m128i va = _mm_set1_epi64x((int64_t)a[k]);
+        const __m128i b03 = _mm_loadu_si128((const __m128i*)(const void*)&b_row[0]);
+        const __m128i b47 = _mm_loadu_si128((const __m128i*)(const void*)&b_row[4]);
+
+        c0 = _mm_add_epi64(c0, _mm_mul_epi32(va, _mm_cvtepi32_epi64(b03)));
+        c1 = _mm_add_epi64(c1, _mm_mul_epi32(va, _mm_cvtepi32_epi64(_mm_srli_si128(b03, 8))));
+        c2 = _mm_add_epi64(c2, _mm_mul_epi32(va, _mm_cvtepi32_epi64(b47)));
+        c3 = _mm_add_epi64(c3, _mm_mul_epi32(va, _mm_cvtepi32_epi64(_mm_srli_si128(b47, 8))));
+    }
+
+    _mm_storeu_si128((__m128i*)(void*)&acc[0], c0);
+    _mm_storeu_si128((__m128i*)(void*)&acc[2], c1);
+    _mm_storeu_si128((__m128i*)(void*)&acc[4], c2);
+    _mm_storeu_si128((__m128i*)(void*)&acc[6], c3);
+}
+
+FX_TARGET_SSE41
+static void sse41_micro(size_t mr, size_t kc, const fixed_t* a, size_t lda,
+                        const fixed_t* panel, int64_t* acc, size_t ldacc) {
+    /* 16 XMM registers cannot hold a 4×8 int64 tile; stream rows instead.
+     * The panel is L1-resident, so re-reading it per row is cheap. */
+    for (size_t r = 0; r < mr; r++) {
+        sse41_row_strip(kc, &a[r * lda], panel, FX_GEMM_NR, &acc[r * ldacc]);
+    }
+}
+
+FX_TARGET_SSE41
+static void sse41_clamp(fixed_t* data, size_t n, fixed_t lo, fixed_t hi) {
+    const __m128i vlo = _mm_set1_epi32(lo);
+    const __m128i vhi = _mm_set1_epi32(hi);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(const void*)&data[i]);
+        v = _mm_min_epi32(_mm_max_epi32(v, vlo), vhi);
+        _mm_storeu_si128((__m128i*)(void*)&data[i], v);
+    }
+
+    fx_gemm_kernels_scalar.clamp(&data[i], n - i, lo, hi);
+}
+
+FX_TARGET_SSE41
+static void sse41_leaky(fixed_t* data, size_t n, fixed_t alpha) {
+    const __m128i va = _mm_set1_epi64x((int64_t)alpha);
+    const __m128i half = _mm_set1_epi64x(FIXED_HALF);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(const void*)&data[i]);
+
+        /* Widened products of lanes 0, 2 and 1, 3; bits [16, 48) of
+         * (p + ½) are the fixed_mul() result whatever the shift kind */
+        const __m128i even = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epi32(v, va), half), FIXED_SHIFT);
+        const __m128i odd = _mm_srli_epi64(_mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(v, 32), va),
+                                                         half), FIXED_SHIFT);
+        const __m128i scaled = _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+
+        /* Select by sign: mask bytes are all-ones in negative lanes */
+        const __m128i out = _mm_blendv_epi8(v, scaled, _mm_srai_epi32(v, 31));
+        _mm_storeu_si128((__m128i*)(void*)&data[i], out);
+    }
+
+    fx_gemm_kernels_scalar.leaky(&data[i], n - i, alpha);
+}
+
+FX_TARGET_SSE41
+static int32_t sse41_qdot32_i8(const fixed_t* x, const int8_t* q, size_t len) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 4 <= len; i += 4) {
+        int32_t packed;
+        memcpy(&packed, &q[i], sizeof(packed));
+        const __m128i vx = _mm_loadu_si128((const __m128i*)(const void*)&x[i]);
+        const __m128i vq = _mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed));
+
+        acc = _mm_add_epi32(acc, _mm_mullo_epi32(vx, vq));
+    }
+
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i*)(void*)lanes, acc);
+
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) +
+           fx_gemm_kernels_scalar.qdot32_i8(&x[i], &q[i], len - i);
+}
+
+FX_TARGET_SSE41
+static int32_t sse41_qdot32_i16(const fixed_t* x, const int16_t* q, size_t len) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 4 <= len; i += 4) {
+        const __m128i vx = _mm_loadu_si128((const __m128i*)(const void*)&x[i]);
+        const __m128i vq = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(const void*)&q[i]));
+
+        acc = _mm_add_epi32(acc, _mm_mullo_epi32(vx, vq));
+    }
+
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i*)(void*)lanes, acc);
+
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) +
+           fx_gemm_kernels_scalar.qdot32_i16(&x[i], &q[i], len - i);
+}
+
+/** @brief even += lanes 0, 2 and odd += lanes 1, 3 of the exact products x · row[k..k+3] */
+FX_TARGET_SSE41
+static inline void sse41_mac_row(__m128i vx, __m128i vx_odd, const fixed_t* row,
+                                 __m128i* even, __m128i* odd) {
+    const __m128i vw = _mm_loadu_si128((const __m128i*)(const void*)row);
+
+    *even = _mm_add_epi64(*even, _mm_mul_epi32(vx, vw));
+    *odd = _mm_add_epi64(*odd, _mm_mul_epi32(vx_odd, _mm_srli_epi64(vw, 32)));
+}
+
+FX_TARGET_SSE41
+static int64_t sse41_hsum_row(__m128i even, __m128i odd, const fixed_t* x,
+                              const fixed_t* row, size_t tail) {
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i*)(void*)lanes, _mm_add_epi64(even, odd));
+
+    return lanes[0] + lanes[1] + fx_gemm_kernels_scalar.dot(x, row, tail);
+}
+
+FX_TARGET_SSE41
+static void sse41_dot4(const fixed_t* x, const fixed_t* w, size_t ldw, size_t len,
+                       int64_t* out) {
+    const fixed_t* w0 = w;
+    const fixed_t* w1 = &w[ldw];
+    const fixed_t* w2 = &w[2u * ldw];
+    const fixed_t* w3 = &w[3u * ldw];
+    __m128i e0 = _mm_setzero_si128(), o0 = _mm_setzero_si128();
+    __m128i e1 = _mm_setzero_si128(), o1 = _mm_setzero_si128();
+    __m128i e2 = _mm_setzero_si128(), o2 = _mm_setzero_si128();
+    __m128i e3 = _mm_setzero_si128(), o3 = _mm_setzero_si128();
+    size_t k = 0;
+
+    for (; k + 4 <= len; k += 4) {
+        const __m128i vx = _mm_loadu_si128((const __m128i*)(const void*)&x[k]);
+        const __m128i vx_odd = _mm_srli_epi64(vx, 32);
+
+#if FX_GEMV_PREFETCH > 0
+        /* One prefetch per cache line of each row */
+        if ((k & 15u) == 0u && k + FX_GEMV_PREFETCH < len) {
+            FX_PREFETCH(&w0[k + FX_GEMV_PREFETCH]);
+            FX_PREFETCH(&w1[k + FX_GEMV_PREFETCH]);
+            FX_PREFETCH(&w2[k + FX_GEMV_PREFETCH]);
+            FX_PREFETCH(&w3[k + FX_GEMV_PREFETCH]);
+        }
+#endif
+
+        sse41_mac_row(vx, vx_odd, &w0[k], &e0, &o0);
+        sse41_mac_row(vx, vx_odd, &w1[k], &e1, &o1);
+        sse41_mac_row(vx, vx_odd, &w2[k], &e2, &o2);
+        sse41_mac_row(vx, vx_odd, &w3[k], &e3, &o3);
+    }
+
+    out[0] = sse41_hsum_row(e0, o0, &x[k], &w0[k], len - k);
+    out[1] = sse41_hsum_row(e1, o1, &x[k], &w1[k], len - k);
+    out[2] = sse41_hsum_row(e2, o2, &x[k], &w2[k], len - k);
+    out[3] = sse41_hsum_row(e3, o3, &x[k], &w3[k], len - k);
+}
+
+const fx_gemm_kernels_t fx_gemm_kernels_sse41 = {
+    sse41_dot,
+    sse41_row_strip,
+    sse41_micro,
+    sse41_clamp,
+    sse41_leaky,
+    sse41_qdot32_i8,
+    sse41_qdot32_i16,
+    sse41_dot4
+};
+
+/* ──────────────────────────────── AVX2 ──────────────────────────────── */
+
+FX_TARGET_AVX2
+static int64_t avx2_dot(const fixed_t* a, const fixed_t* b, size_t len) {
+    __m256i acc_even = _mm256_setzero_si256();
+    __m256i acc_odd = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        const __m256i va = _mm256_loadu_si256((const __m256i*)(const void*)&a[i]);
+        const __m256i vb = _mm256_loadu_si256((const __m256i*)(const void*)&b[i]);
+
+        acc_even = _mm256_add_epi64(acc_even, _mm256_mul_epi32(va, vb));
+        acc_odd = _mm256_add_epi64(acc_odd, _mm256_mul_epi32(_mm256_srli_epi64(va, 32),
+                                                             _mm256_srli_epi64(vb, 32)));
+    }
+
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)(void*)lanes, _mm256_add_epi64(acc_even, acc_odd));
+    int64_t sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+    for (; i < len; i++) {
+        sum += (int64_t)a[i] * b[i];
+    }
+
+    return sum;
+}
+
+/** @brief Sign-extend 4 consecutive fixed_t values into 4 int64 lanes */
+FX_TARGET_AVX2
+static inline __m256i avx2_load4_widen(const fixed_t* p) {
+    return _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(const void*)p));
+}
+
+FX_TARGET_AVX2
+static void avx2_row_strip(size_t kc, const fixed_t* a,
+                           const fixed_t* b, size_t ldb, int64_t* acc) {
+    __m256i c0 = _mm256_loadu_si256((const __m256i*)(const void*)&acc[0]);
+    __m256i c1 = _mm256_loadu_si256((const __m256i*)(const void*)&acc[4]);
+
+    for (size_t k = 0; k < kc; k++) {
+        const fixed_t* b_row = &b[k * ldb];
+        const __m256i va = _mm256_set1_epi64x((int64_t)a[k]);
+
+        c0 = _mm256_add_epi64(c0, _mm256_mul_epi32(va, avx2_load4_widen(&b_row[0])));
+        c1 = _mm256_add_epi64(c1, _mm256_mul_epi32(va, avx2_load4_widen(&b_row[4])));
+    }
+
+    _mm256_storeu_si256((__m256i*)(void*)&acc[0], c0);
+    _mm256_storeu_si256((__m256i*)(void*)&acc[4], c1);
+}
+
+FX_TARGET_AVX2
+static void avx2_micro(size_t mr, size_t kc, const fixed_t* a, size_t lda,
+                       const fixed_t* panel, int64_t* acc, size_t ldacc) {
+    if (mr != FX_GEMM_MR) {
+        for (size_t r = 0; r < mr; r++) {
+            avx2_row_strip(kc, &a[r * lda], panel, FX_GEMM_NR, &acc[r * ldacc]);
+        }
+        return;
+    }
+
+    /* 4×8 tile = 8 YMM accumulators + 2 panel registers + 1 broadcast */
+    int64_t* acc0 = &acc[0 * ldacc];
+    int64_t* acc1 = &acc[1 * ldacc];
+    int64_t* acc2 = &acc[2 * ldacc];
+    int64_t* acc3 = &acc[3 * ldacc];
+
+    __m256i c00 = _mm256_loadu_si256((const __m256i*)(const void*)&acc0[0]);
+    __m256i c01 = _mm256_loadu_si256((const __m256i*)(const void*)&acc0[4]);
+    __m256i c10 = _mm256_loadu_si256((const __m256i*)(const void*)&acc1[0]);
+    __m256i c11 = _mm256_loadu_si256((const __m256i*)(const void*)&acc1[4]);
+    __m256i c20 = _mm256_loadu_si256((const __m256i*)(const void*)&acc2[0]);
+    __m256i c21 = _mm256_loadu_si256((const __m256i*)(const void*)&acc2[4]);
+    __m256i c30 = _mm256_loadu_si256((const __m256i*)(const void*)&acc3[0]);
+    __m256i c31 = _mm256_loadu_si256((const __m256i*)(const void*)&acc3[4]);
+
+    for (size_t k = 0; k < kc; k++) {
+        const __m256i b0 = avx2_load4_widen(&panel[k * FX_GEMM_NR]);
+        const __m256i b1 = avx2_load4_widen(&panel[k * FX_GEMM_NR + 4]);
+        __m256i va;
+
+        va = _mm256_set1_epi64x((int64_t)a[0 * lda + k]);
+        c00 = _mm256_add_epi64(c00, _mm256_mul_epi32(va, b0));
+        c01 = _mm256_add_epi64(c01, _mm256_mul_epi32(va, b1));
+
+        va = _mm256_set1_epi64x((int64_t)a[1 * lda + k]);
+        c10 = _mm256_add_epi64(c10, _mm256_mul_epi32(va, b0));
+        c11 = _mm256_add_epi64(c11, _mm256_mul_epi32(va, b1));
+
+        va = _mm256_set1_epi64x((int64_t)a[2 * lda + k]);
+        c20 = _mm256_add_epi64(c20, _mm256_mul_epi32(va, b0));
+        c21 = _mm256_add_epi64(c21, _mm256_mul_epi32(va, b1));
+
+        va = _mm256_set1_epi64x((int64_t)a[3 * lda + k]);
+        c30 = _mm256_add_epi64(c30, _mm256_mul_epi32(va, b0));
+        c31 = _mm256_add_epi64(c31, _mm256_mul_epi32(va, b1));
+    }
+
+    _mm256_storeu_si256((__m256i*)(void*)&acc0[0], c00);
+    _mm256_storeu_si256((__m256i*)(void*)&acc0[4], c01);
+    _mm256_storeu_si256((__m256i*)(void*)&acc1[0], c10);
+    _mm256_storeu_si256((__m256i*)(void*)&acc1[4], c11);
+    _mm256_storeu_si256((__m256i*)(void*)&acc2[0], c20);
+    _mm256_storeu_si256((__m256i*)(void*)&acc2[4], c21);
+    _mm256_storeu_si256((__m256i*)(void*)&acc3[0], c30);
+    _mm256_storeu_si256((__m256i*)(void*)&acc3[4], c31);
+}
+
+FX_TARGET_AVX2
+static void avx2_clamp(fixed_t* data, size_t n, fixed_t lo, fixed_t hi) {
+    const __m256i vlo = _mm256_set1_epi32(lo);
+    const __m256i vhi = _mm256_set1_epi32(hi);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(const void*)&data[i]);
+        v = _mm256_min_epi32(_mm256_max_epi32(v, vlo), vhi);
+        _mm256_storeu_si256((__m256i*)(void*)&data[i], v);
+    }
+
+    fx_gemm_kernels_scalar.clamp(&data[i], n - i, lo, hi);
+}
+
+FX_TARGET_AVX2
+static void avx2_leaky(fixed_t* data, size_t n, fixed_t alpha) {
+    const __m256i va = _mm256_set1_epi64x((int64_t)alpha);
+    const __m256i half = _mm256_set1_epi64x(FIXED_HALF);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(const void*)&data[i]);
+
+        const __m256i even = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(v, va), half),
+                                               FIXED_SHIFT);
+        const __m256i odd = _mm256_srli_epi64(
+            _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(v, 32), va), half), FIXED_SHIFT);
+        const __m256i scaled = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+
+        const __m256i out = _mm256_blendv_epi8(v, scaled, _mm256_srai_epi32(v, 31));
+        _mm256_storeu_si256((__m256i*)(void*)&data[i], out);
+    }
+
+    fx_gemm_kernels_scalar.leaky(&data[i], n - i, alpha);
+}
+
+FX_TARGET_AVX2
+static int32_t avx2_hsum_epi32(__m256i v) {
+    int32_t lanes[8];
+    _mm256_storeu_si256((__m256i*)(void*)lanes, v);
+
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+           ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+FX_TARGET_AVX2
+static int32_t avx2_qdot32_i8(const fixed_t* x, const int8_t* q, size_t len) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        const __m256i vx = _mm256_loadu_si256((const __m256i*)(const void*)&x[i]);
+        const __m256i vq = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)(const void*)&q[i]));
+
+        acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(vx, vq));
+    }
+
+    return avx2_hsum_epi32(acc) + fx_gemm_kernels_scalar.qdot32_i8(&x[i], &q[i], len - i);
+}
+
+FX_TARGET_AVX2
+static int32_t avx2_qdot32_i16(const fixed_t* x, const int16_t* q, size_t len) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        const __m256i vx = _mm256_loadu_si256((const __m256i*)(const void*)&x[i]);
+        const __m256i vq = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(const void*)&q[i]));
+
+        acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(vx, vq));
+    }
+
+    return avx2_hsum_epi32(acc) + fx_gemm_kernels_scalar.qdot32_i16(&x[i], &q[i], len - i);
+}
+
+/** @brief even += lanes 0, 2, 4, 6 and odd += lanes 1, 3, 5, 7 of x · row[k..k+7] */
+FX_TARGET_AVX2
+static inline void avx2_mac_row(__m256i vx, __m256i vx_odd, const fixed_t* row,
+                                __m256i* even, __m256i* odd) {
+    const __m256i vw = _mm256_loadu_si256((const __m256i*)(const void*)row);
+
+    *even = _mm256_add_epi64(*even, _mm256_mul_epi32(vx, vw));
+    *odd = _mm256_add_epi64(*odd, _mm256_mul_epi32(vx_odd, _mm256_srli_epi64(vw, 32)));
+}
+
+FX_TARGET_AVX2
+static int64_t avx2_hsum_row(__m256i even, __m256i odd, const fixed_t* x,
+                             const fixed_t* row, size_t tail) {
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)(void*)lanes, _mm256_add_epi64(even, odd));
+
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) +
+           fx_gemm_kernels_scalar.dot(x, row, tail);
+}
+
+FX_TARGET_AVX2
+static void avx2_dot4(const fixed_t* x, const fixed_t* w, size_t ldw, size_t len,
+                      int64_t* out) {
+    const fixed_t* w0 = w;
+    const fixed_t* w1 = &w[ldw];
+    const fixed_t* w2 = &w[2u * ldw];
+    const fixed_t* w3 = &w[3u * ldw];
+    __m256i e0 = _mm256_setzero_si256(), o0 = _mm256_setzero_si256();
+    __m256i e1 = _mm256_setzero_si256(), o1 = _mm256_setzero_si256();
+    __m256i e2 = _mm256_setzero_si256(), o2 = _mm256_setzero_si256();
+    __m256i e3 = _mm256_setzero_si256(), o3 = _mm256_setzero_si256();
+    size_t k = 0;
+
+    for (; k + 8 <= len; k += 8) {
+        const __m256i vx = _mm256_loadu_si256((const __m256i*)(const void*)&x[k]);
+        const __m256i vx_odd = _mm256_srli_epi64(vx, 32);
+
+#if FX_GEMV_PREFETCH > 0
+        /* One prefetch per cache line of each row */
+        if ((k & 15u) == 0u && k + FX_GEMV_PREFETCH < len) {
+            FX_PREFETCH(&w0[k + FX_GEMV_PREFETCH]);
+            FX_PREFETCH(&w1[k + FX_GEMV_PREFETCH]);
+            FX_PREFETCH(&w2[k + FX_GEMV_PREFETCH]);
+            FX_PREFETCH(&w3[k + FX_GEMV_PREFETCH]);
+        }
+#endif
+
+        avx2_mac_row(vx, vx_odd, &w0[k], &e0, &o0);
+        avx2_mac_row(vx, vx_odd, &w1[k], &e1, &o1);
+        avx2_mac_row(vx, vx_odd, &w2[k], &e2, &o2);
+        avx2_mac_row(vx, vx_odd, &w3[k], &e3, &o3);
+    }
+
+    out[0] = avx2_hsum_row(e0, o0, &x[k], &w0[k], len - k);
+    out[1] = avx2_hsum_row(e1, o1, &x[k], &w1[k], len - k);
+    out[2] = avx2_hsum_row(e2, o2, &x[k], &w2[k], len - k);
+    out[3] = avx2_hsum_row(e3, o3, &x[k], &w3[k], len - k);
+}
+
+const fx_gemm_kernels_t fx_gemm_kernels_avx2 = {
+    avx2_dot,
+    avx2_row_strip,
+    avx2_micro,
+    avx2_clamp,
+    avx2_leaky,
+    avx2_qdot32_i8,
+    avx2_qdot32_i16,
+    avx2_dot4
+};
+
+#else
+
+/* ISO C forbids an empty translation unit */
+typedef int fx_gemm_kernels_x86_unused_t;
+
+#endif /* FX_HAVE_X86_KERNELS */
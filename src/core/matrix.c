@@ -17,9 +17,10 @@
  */
 
 #include "matrix.h"
+#include "gemm_kernels.h"
 #include <string.h>
 
-void fx_matrix_init(fx_matrix_t* mat, fixed_t* buffer, uint16_t rows, uint16_t cols) {
+void fx_matrix_init(fx_matrix_t* mat, fixed_t* buffer, uint32_t rows, uint32_t cols) {
     if (!mat || !buffer) {
         return;
     }
@@ -43,48 +44,304 @@ void fx_matrix_mul(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C) {
         return;
     }
 
+    fx_gemm_region(A, B, C, 0, A->rows, 0, B->cols);
+}
+
+void fx_gemm_region(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C,
+                    size_t i0, size_t i1, size_t j0, size_t j1) {
+    const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+    const size_t k_len = A->cols;
+    const size_t p_cols = B->cols;
+    const size_t j_strips = j0 + (j1 - j0) - ((j1 - j0) % FX_GEMM_NR);
+
     /* SRS-003.6: Bounded execution O(N*M*P) with no data-dependent branching */
-    for (uint16_t i = 0; i < A->rows; i++) {
-        for (uint16_t j = 0; j < B->cols; j++) {
-            /* SRS-003.5: 64-bit accumulator prevents overflow */
+    for (size_t i = i0; i < i1; i++) {
+        const fixed_t* a_row = &A->data[i * k_len];
+        fixed_t* c_row = &C->data[i * C->cols];
+
+        /* SRS-003.2: FX_GEMM_NR-wide strips read B rows with unit stride.
+         * The active kernel (scalar or SIMD, SRS-003.10) forms the same
+         * exact Q32.32 sum for every column of the strip. */
+        for (size_t j = j0; j < j_strips; j += FX_GEMM_NR) {
+            /* SRS-003.5: 64-bit accumulators prevent overflow */
+            int64_t acc[FX_GEMM_NR] = {0};
+
+            kern->row_strip(k_len, a_row, &B->data[j], p_cols, acc);
+
+            /* SRS-003.4: Quantize back to Q16.16 with proper rounding
+             * Add FIXED_HALF (0.5) before shifting for round-to-nearest */
+            for (size_t jj = 0; jj < FX_GEMM_NR; jj++) {
+                int64_t sum = acc[jj] + FIXED_HALF;
+                c_row[j + jj] = (fixed_t)(sum >> FIXED_SHIFT);
+            }
+        }
+
+        /* Remaining columns: dot product of row i of A with column j of B */
+        for (size_t j = j_strips; j < j1; j++) {
             int64_t sum = 0;
 
-            /* Inner loop: dot product of row i of A with column j of B */
-            for (uint16_t k = 0; k < A->cols; k++) {
-                /* SRS-003.2: Row-major access for cache efficiency
-                 * A[i][k] = A.data[i * A.cols + k]
-                 * B[k][j] = B.data[k * B.cols + j] */
-                fixed_t val_a = A->data[i * A->cols + k];
-                fixed_t val_b = B->data[k * B->cols + j];
-
-                /* Multiply without intermediate quantization
-                 * Product is Q32.32 (int64_t) */
-                int64_t prod = (int64_t)val_a * val_b;
+            for (size_t k = 0; k < k_len; k++) {
+                /* Product is Q32.32 (int64_t), no intermediate quantization */
+                int64_t prod = (int64_t)a_row[k] * B->data[k * p_cols + j];
                 sum += prod;
             }
 
-            /* SRS-003.4: Quantize back to Q16.16 with proper rounding
-             * Add FIXED_HALF (0.5) before shifting for round-to-nearest */
             sum += FIXED_HALF;
-            C->data[i * C->cols + j] = (fixed_t)(sum >> FIXED_SHIFT);
+            c_row[j] = (fixed_t)(sum >> FIXED_SHIFT);
         }
     }
 }
 
-fixed_t fx_vector_dot(const fixed_t* a, const fixed_t* b, uint16_t len) {
-    if (!a || !b) {
-        return FIXED_ZERO;
+/**
+ * @brief Pack columns [j0, j0 + nc) of B into FX_GEMM_NR-wide panels.
+ *
+ * @details B[k][j] is read from src[k * ks + j * js], so row-major B
+ * (ks = cols, js = 1) and Bᵀ (ks = 1, js = cols) pack alike.
+ * Panel p holds columns j0 + p*NR .. j0 + p*NR + NR - 1 for every k,
+ * stored k-major so the micro-kernel reads it with unit stride:
+ *   panel[k * NR + jj] = B[k][j0 + p*NR + jj]
+ * Columns past the edge of B are zero-filled; their products contribute
+ * nothing and are never stored.
+ */
+static void gemm_pack_b(const fixed_t* src, size_t k_len, size_t ks, size_t js,
+                        size_t j0, size_t nc, fixed_t* packed) {
+    const size_t panels = (nc + FX_GEMM_NR - 1) / FX_GEMM_NR;
+
+    for (size_t p = 0; p < panels; p++) {
+        fixed_t* panel = packed + p * k_len * FX_GEMM_NR;
+        const size_t col0 = j0 + p * FX_GEMM_NR;
+        const size_t width = (nc - p * FX_GEMM_NR < FX_GEMM_NR)
+                           ? (nc - p * FX_GEMM_NR) : FX_GEMM_NR;
+
+        for (size_t k = 0; k < k_len; k++) {
+            const fixed_t* b_row = &src[k * ks + col0 * js];
+            size_t jj = 0;
+            for (; jj < width; jj++) {
+                panel[k * FX_GEMM_NR + jj] = b_row[jj * js];
+            }
+            for (; jj < FX_GEMM_NR; jj++) {
+                panel[k * FX_GEMM_NR + jj] = FIXED_ZERO;
+            }
+        }
     }
+}
 
-    /* SRS-003.5: 64-bit accumulator for overflow protection */
-    int64_t sum = 0;
+/**
+ * @brief Columns [j0, j0 + nc) of C = A × B from the packed panels of B.
+ *
+ * @details panels holds the ceil(nc / NR) panels of this column block.
+ * Element (i, j) is stored at c[i * ldc + j * c_step]; with bias the
+ * accumulator starts at bias[j] << 16, and act is applied to each rounded
+ * tile row before its single store.
+ */
+static void gemm_block(const fx_gemm_kernels_t* kern, const fx_matrix_t* A,
+                       const fixed_t* panels, size_t j0, size_t nc, const fixed_t* bias,
+                       const fx_activation_t* act, fixed_t* c, size_t ldc, size_t c_step) {
+    const size_t n_rows = A->rows;
+    const size_t k_len = A->cols;
+    const size_t n_panels = (nc + FX_GEMM_NR - 1) / FX_GEMM_NR;
+
+    /* SRS-003.5: 64-bit accumulator tile, one MR×NC block of C */
+    int64_t acc[FX_GEMM_MR * FX_GEMM_NC];
+
+    /* Row tiles of A / C */
+    for (size_t i0 = 0; i0 < n_rows; i0 += FX_GEMM_MR) {
+        const size_t mr = (n_rows - i0 < FX_GEMM_MR) ? (n_rows - i0) : FX_GEMM_MR;
+
+        for (size_t r = 0; r < FX_GEMM_MR; r++) {
+            for (size_t jj = 0; jj < FX_GEMM_NC; jj++) {
+                acc[r * FX_GEMM_NC + jj] = (bias && jj < nc)
+                                         ? (int64_t)bias[j0 + jj] * FIXED_ONE : 0;
+            }
+        }
 
-    /* SRS-003.6: Sequential iteration, no data-dependent branching */
-    for (uint16_t i = 0; i < len; i++) {
-        int64_t prod = (int64_t)a[i] * b[i];
-        sum += prod;
+        /* Depth blocks: the A slice (MR×KC) stays in L1 across panels */
+        for (size_t k0 = 0; k0 < k_len; k0 += FX_GEMM_KC) {
+            const size_t kc = (k_len - k0 < FX_GEMM_KC) ? (k_len - k0) : FX_GEMM_KC;
+
+            for (size_t p = 0; p < n_panels; p++) {
+                kern->micro(mr, kc,
+                            &A->data[i0 * k_len + k0], k_len,
+                            &panels[p * k_len * FX_GEMM_NR + k0 * FX_GEMM_NR],
+                            &acc[p * FX_GEMM_NR], FX_GEMM_NC);
+            }
+        }
+
+        /* SRS-003.4: Single round-to-nearest per output element */
+        for (size_t r = 0; r < mr; r++) {
+            fixed_t* c_row = &c[(i0 + r) * ldc + j0 * c_step];
+            fixed_t v[FX_GEMM_NC];
+
+            for (size_t jj = 0; jj < nc; jj++) {
+                int64_t sum = acc[r * FX_GEMM_NC + jj] + FIXED_HALF;
+                v[jj] = (fixed_t)(sum >> FIXED_SHIFT);
+            }
+
+            /* SRS-004.9: Activation on the tile, then one store per element */
+            fx_activation_apply(act, v, nc);
+
+            for (size_t jj = 0; jj < nc; jj++) {
+                c_row[jj * c_step] = v[jj];
+            }
+        }
+    }
+}
+
+void fx_matrix_mul_blocked(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C,
+                           fixed_t* scratch, size_t scratch_len) {
+    /* SRS-003.4: Dimensional validation - safety first */
+    if (!A || !B || !C || !scratch) {
+        return;
     }
 
+    if (A->cols != B->rows) {
+        return;
+    }
+
+    if (C->rows != A->rows || C->cols != B->cols) {
+        return; /* Output dimension mismatch */
+    }
+
+    if (scratch_len < FX_GEMM_SCRATCH_LEN(A->cols)) {
+        return; /* Packing buffer too small */
+    }
+
+    const size_t p_cols = B->cols;
+    const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+
+    /* SRS-003.9: Outer block over columns of B, packed once per block */
+    for (size_t j0 = 0; j0 < p_cols; j0 += FX_GEMM_NC) {
+        const size_t nc = (p_cols - j0 < FX_GEMM_NC) ? (p_cols - j0) : FX_GEMM_NC;
+
+        gemm_pack_b(B->data, B->rows, p_cols, 1u, j0, nc, scratch);
+        gemm_block(kern, A, scratch, j0, nc, NULL, NULL, C->data, p_cols, 1u);
+    }
+}
+
+void fx_pack_weights(const fx_matrix_t* W, fixed_t* buffer, size_t buffer_len,
+                     fx_packed_weights_t* packed) {
+    if (!W || !W->data || !buffer || !packed) {
+        return;
+    }
+
+    if (buffer_len < FX_PACKED_WEIGHTS_LEN(W->rows, W->cols)) {
+        return; /* Destination too small */
+    }
+
+    gemm_pack_b(W->data, W->rows, W->cols, 1u, 0u, W->cols, buffer);
+
+    packed->data = buffer;
+    packed->rows = W->rows;
+    packed->cols = W->cols;
+}
+
+void fx_pack_weights_transposed(const fx_matrix_t* Wt, fixed_t* buffer, size_t buffer_len,
+                                fx_packed_weights_t* packed) {
+    if (!Wt || !Wt->data || !buffer || !packed) {
+        return;
+    }
+
+    if (buffer_len < FX_PACKED_WEIGHTS_LEN(Wt->cols, Wt->rows)) {
+        return; /* Destination too small */
+    }
+
+    gemm_pack_b(Wt->data, Wt->cols, 1u, Wt->cols, 0u, Wt->rows, buffer);
+
+    packed->data = buffer;
+    packed->rows = Wt->cols;
+    packed->cols = Wt->rows;
+}
+
+void fx_gemm_packed(const fx_matrix_t* A, const fx_packed_weights_t* W, const fixed_t* bias,
+                    const fx_activation_t* act, fixed_t* c, size_t ldc, size_t c_step) {
+    const size_t k_len = W->rows;
+    const size_t p_cols = W->cols;
+    const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+
+    /* SRS-003.13: Column blocks start on a panel boundary, at j0 * K */
+    for (size_t j0 = 0; j0 < p_cols; j0 += FX_GEMM_NC) {
+        const size_t nc = (p_cols - j0 < FX_GEMM_NC) ? (p_cols - j0) : FX_GEMM_NC;
+
+        gemm_block(kern, A, &W->data[j0 * k_len], j0, nc, bias, act, c, ldc, c_step);
+    }
+}
+
+void fx_matrix_mul_packed(const fx_matrix_t* A, const fx_packed_weights_t* W, fx_matrix_t* C) {
+    /* SRS-003.4: Dimensional validation - safety first */
+    if (!A || !W || !C || !A->data || !W->data || !C->data) {
+        return;
+    }
+
+    if (A->cols != W->rows) {
+        return;
+    }
+
+    if (C->rows != A->rows || C->cols != W->cols) {
+        return; /* Output dimension mismatch */
+    }
+
+    fx_gemm_packed(A, W, NULL, NULL, C->data, C->cols, 1u);
+}
+
+void fx_matrix_vec_mul(const fx_matrix_t* x, const fx_matrix_t* Wt, fx_matrix_t* y) {
+    /* SRS-003.4: Dimensional validation - safety first */
+    if (!x || !Wt || !y) {
+        return;
+    }
+
+    if (x->rows != 1u || y->rows != 1u || x->cols != Wt->cols || y->cols != Wt->rows) {
+        return;
+    }
+
+    const fx_gemm_kernels_t* kern = fx_gemm_kernels();
+    const size_t k_len = Wt->cols;
+    const size_t p_rows = Wt->rows;
+    const size_t p_blocks = p_rows - (p_rows % 4u);
+    size_t j = 0;
+
+    /* SRS-003.12: Four weight rows per pass, each streamed once */
+    for (; j < p_blocks; j += 4u) {
+        int64_t acc[4];
+
+        kern->dot4(x->data, &Wt->data[j * k_len], k_len, k_len, acc);
+
+        /* SRS-003.4: Single round-to-nearest per output element */
+        for (size_t r = 0; r < 4u; r++) {
+            y->data[j + r] = (fixed_t)((acc[r] + FIXED_HALF) >> FIXED_SHIFT);
+        }
+    }
+
+    for (; j < p_rows; j++) {
+        const int64_t sum = kern->dot(x->data, &Wt->data[j * k_len], k_len);
+        y->data[j] = (fixed_t)((sum + FIXED_HALF) >> FIXED_SHIFT);
+    }
+}
+
+void fx_matrix_transpose(const fx_matrix_t* in, fx_matrix_t* out) {
+    if (!in || !out) {
+        return;
+    }
+
+    if (out->rows != in->cols || out->cols != in->rows) {
+        return;
+    }
+
+    for (size_t i = 0; i < in->rows; i++) {
+        for (size_t j = 0; j < in->cols; j++) {
+            out->data[j * out->cols + i] = in->data[i * in->cols + j];
+        }
+    }
+}
+
+fixed_t fx_vector_dot(const fixed_t* a, const fixed_t* b, size_t len) {
+    if (!a || !b) {
+        return FIXED_ZERO;
+    }
+
+    /* SRS-003.5: 64-bit accumulator for overflow protection
+     * SRS-003.10: Active kernel (scalar or SIMD) is bit-identical */
+    int64_t sum = fx_gemm_kernels()->dot(a, b, len);
+
     /* Round and quantize back to fixed-point */
     sum += FIXED_HALF;
     return (fixed_t)(sum >> FIXED_SHIFT);
@@ -105,8 +362,8 @@ void fx_matrix_add(const fx_matrix_t* A, const fx_matrix_t* B, fx_matrix_t* C) {
     }
 
     /* Element-wise addition */
-    uint16_t total_elements = A->rows * A->cols;
-    for (uint16_t i = 0; i < total_elements; i++) {
+    size_t total_elements = (size_t)A->rows * A->cols;
+    for (size_t i = 0; i < total_elements; i++) {
         C->data[i] = fixed_add(A->data[i], B->data[i]);
     }
 }
@@ -117,8 +374,8 @@ void fx_matrix_apply(fx_matrix_t* mat, fixed_t (*fn)(fixed_t)) {
     }
 
     /* Apply function to each element */
-    uint16_t total_elements = mat->rows * mat->cols;
-    for (uint16_t i = 0; i < total_elements; i++) {
+    size_t total_elements = (size_t)mat->rows * mat->cols;
+    for (size_t i = 0; i < total_elements; i++) {
         mat->data[i] = fn(mat->data[i]);
     }
 }
@@ -135,8 +392,8 @@ void fx_matrix_add_bias(fx_matrix_t* mat, const fx_matrix_t* bias) {
     }
 
     /* SRS-004.4: Broadcast bias to each row using fixed-point addition */
-    for (uint16_t i = 0; i < mat->rows; i++) {
-        for (uint16_t j = 0; j < mat->cols; j++) {
+    for (size_t i = 0; i < mat->rows; i++) {
+        for (size_t j = 0; j < mat->cols; j++) {
             /* Add bias[j] to mat[i][j] */
             mat->data[i * mat->cols + j] = fixed_add(
                 mat->data[i * mat->cols + j],
@@ -0,0 +1,232 @@
+/**
+ * @file ntt.c
+ * @project Certifiable Inference Engine
+ * @brief Exact convolution via three-prime number-theoretic transforms.
+ *
+ * @details All arithmetic is on integers modulo NTT-friendly primes of the
+ * form c·2^k + 1, so every transform is exact; the accumulator is rebuilt
+ * from its three residues with Garner's algorithm (CRT).
+ *
+ * @traceability SRS-006.16
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "convolution.h"
+
+/** @brief Number of CRT primes */
+#define NTT_PRIMES 3u
+
+/** @brief Largest supported transform length per axis (limited by 998244353 = 119·2^23 + 1) */
+#define NTT_MAX_LOG2 23u
+
+/** @brief Primes p = c·2^k + 1 with primitive root 3 */
+static const uint32_t ntt_mod[NTT_PRIMES] = {998244353u, 167772161u, 469762049u};
+
+/** @brief Offset that makes every int64_t accumulator non-negative */
+#define NTT_BIAS ((uint64_t)1 << 63)
+
+static uint32_t mod_mul(uint32_t a, uint32_t b, uint32_t p) {
+    return (uint32_t)(((uint64_t)a * b) % p);
+}
+
+static uint32_t mod_pow(uint32_t base, uint64_t e, uint32_t p) {
+    uint32_t r = 1u;
+
+    while (e != 0u) {
+        if ((e & 1u) != 0u) {
+            r = mod_mul(r, base, p);
+        }
+        base = mod_mul(base, base, p);
+        e >>= 1;
+    }
+    return r;
+}
+
+/** @brief Residue of a signed value, in [0, p) */
+static uint32_t mod_signed(int64_t v, uint32_t p) {
+    int64_t r = v % (int64_t)p;
+    return (uint32_t)((r < 0) ? r + (int64_t)p : r);
+}
+
+static size_t next_pow2(size_t n) {
+    size_t r = 1u;
+    while (r < n) {
+        r <<= 1;
+    }
+    return r;
+}
+
+/**
+ * @brief In-place iterative radix-2 NTT of a[0], a[stride], ..., a[(n-1)·stride].
+ */
+static void ntt_1d(uint32_t* a, size_t n, size_t stride, uint32_t p, int inverse) {
+    /* Bit-reversal permutation */
+    for (size_t i = 1u, j = 0u; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; (j & bit) != 0u; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            uint32_t t = a[i * stride];
+            a[i * stride] = a[j * stride];
+            a[j * stride] = t;
+        }
+    }
+
+    for (size_t len = 2u; len <= n; len <<= 1) {
+        uint32_t w_len = mod_pow(3u, (p - 1u) / len, p);
+        if (inverse) {
+            w_len = mod_pow(w_len, p - 2u, p);
+        }
+
+        for (size_t i = 0; i < n; i += len) {
+            uint32_t w = 1u;
+            for (size_t k = 0; k < len / 2u; k++) {
+                uint32_t* x = &a[(i + k) * stride];
+                uint32_t* y = &a[(i + k + len / 2u) * stride];
+                const uint32_t u = *x;
+                const uint32_t v = mod_mul(*y, w, p);
+
+                *x = (u + v >= p) ? u + v - p : u + v;
+                *y = (u >= v) ? u - v : u + p - v;
+                w = mod_mul(w, w_len, p);
+            }
+        }
+    }
+
+    if (inverse) {
+        const uint32_t n_inv = mod_pow((uint32_t)(n % p), p - 2u, p);
+        for (size_t i = 0; i < n; i++) {
+            a[i * stride] = mod_mul(a[i * stride], n_inv, p);
+        }
+    }
+}
+
+/**
+ * @brief Row-column 2-D NTT of an n1 × n2 row-major array.
+ */
+static void ntt_2d(uint32_t* a, size_t n1, size_t n2, uint32_t p, int inverse) {
+    for (size_t r = 0; r < n1; r++) {
+        ntt_1d(&a[r * n2], n2, 1u, p, inverse);
+    }
+    for (size_t c = 0; c < n2; c++) {
+        ntt_1d(&a[c], n1, n2, p, inverse);
+    }
+}
+
+size_t fx_conv2d_ntt_scratch_len(uint32_t in_h, uint32_t in_w) {
+    const size_t n1 = next_pow2(in_h);
+    const size_t n2 = next_pow2(in_w);
+
+    if (n1 > ((size_t)1 << NTT_MAX_LOG2) || n2 > ((size_t)1 << NTT_MAX_LOG2) ||
+        n1 * n2 > ((size_t)1 << NTT_MAX_LOG2)) {
+        return 0;
+    }
+    return 4u * n1 * n2;
+}
+
+void fx_conv2d_ntt(const fx_matrix_t* in, const fx_matrix_t* kernel,
+                   fx_matrix_t* out, int64_t* acc,
+                   uint32_t* scratch, size_t scratch_len) {
+    /* SRS-006.1: Validation - safe failure mode */
+    if (!in || !kernel || !out || !scratch || !in->data || !kernel->data || !out->data) {
+        return;
+    }
+
+    if (kernel->rows == 0u || kernel->cols == 0u ||
+        kernel->rows > in->rows || kernel->cols > in->cols) {
+        return;
+    }
+
+    if (out->rows != in->rows - kernel->rows + 1u ||
+        out->cols != in->cols - kernel->cols + 1u) {
+        return;
+    }
+
+    const size_t need = fx_conv2d_ntt_scratch_len(in->rows, in->cols);
+    if (need == 0u || scratch_len < need) {
+        return;
+    }
+
+    const size_t n1 = next_pow2(in->rows);
+    const size_t n2 = next_pow2(in->cols);
+    const size_t n = n1 * n2;
+    const size_t k_h = kernel->rows;
+    const size_t k_w = kernel->cols;
+    const size_t out_h = out->rows;
+    const size_t out_w = out->cols;
+    uint32_t* fa = scratch;              /* Input, then product */
+    uint32_t* fb = &scratch[n];          /* Flipped kernel */
+    uint32_t* res[2] = {&scratch[2u * n], &scratch[3u * n]};
+
+    for (size_t q = 0; q < NTT_PRIMES; q++) {
+        const uint32_t p = ntt_mod[q];
+        const uint32_t bias = (uint32_t)(NTT_BIAS % p);
+
+        for (size_t i = 0; i < n; i++) {
+            fa[i] = 0u;
+            fb[i] = 0u;
+        }
+        for (size_t y = 0; y < in->rows; y++) {
+            for (size_t x = 0; x < in->cols; x++) {
+                fa[y * n2 + x] = mod_signed(in->data[y * in->cols + x], p);
+            }
+        }
+        /* Correlation = convolution with the kernel flipped in both axes */
+        for (size_t ky = 0; ky < k_h; ky++) {
+            for (size_t kx = 0; kx < k_w; kx++) {
+                fb[(k_h - 1u - ky) * n2 + (k_w - 1u - kx)] =
+                    mod_signed(kernel->data[ky * k_w + kx], p);
+            }
+        }
+
+        ntt_2d(fa, n1, n2, p, 0);
+        ntt_2d(fb, n1, n2, p, 0);
+        for (size_t i = 0; i < n; i++) {
+            fa[i] = mod_mul(fa[i], fb[i], p);
+        }
+        ntt_2d(fa, n1, n2, p, 1);
+
+        /* Valid outputs sit at offset (KH-1, KW-1); store Z = Y + 2^63 mod p */
+        uint32_t* dst = (q < 2u) ? res[q] : fa;
+        for (size_t y = 0; y < out_h; y++) {
+            for (size_t x = 0; x < out_w; x++) {
+                uint32_t r = fa[(y + k_h - 1u) * n2 + (x + k_w - 1u)] + bias;
+                dst[y * out_w + x] = (r >= p) ? r - p : r;
+            }
+        }
+    }
+
+    /* Garner: Z = a1 + a2·p1 + a3·p1·p2, evaluated modulo 2^64 (exact as Z < 2^64) */
+    const uint32_t p1 = ntt_mod[0];
+    const uint32_t p2 = ntt_mod[1];
+    const uint32_t p3 = ntt_mod[2];
+    const uint32_t inv_p1_p2 = mod_pow(p1 % p2, p2 - 2u, p2);
+    const uint32_t inv_p1p2_p3 = mod_pow(mod_mul(p1 % p3, p2 % p3, p3), p3 - 2u, p3);
+    const uint32_t p1_p3 = p1 % p3;
+
+    for (size_t i = 0; i < out_h * out_w; i++) {
+        const uint32_t a1 = res[0][i];
+        const uint32_t r2 = res[1][i];
+        const uint32_t r3 = fa[i];
+
+        const uint32_t a2 = mod_mul((r2 + p2 - (a1 % p2)) % p2, inv_p1_p2, p2);
+        const uint32_t t3 = (uint32_t)(((uint64_t)a1 + mod_mul(a2 % p3, p1_p3, p3)) % p3);
+        const uint32_t a3 = mod_mul((r3 + p3 - t3) % p3, inv_p1p2_p3, p3);
+
+        const uint64_t z = (uint64_t)a1 + (uint64_t)a2 * p1 + (uint64_t)a3 * p1 * p2;
+        const int64_t y = (int64_t)(z - NTT_BIAS);
+
+        if (acc) {
+            acc[i] = y;
+        }
+        /* SRS-006.4: same single rounding as the direct loop */
+        out->data[i] = (fixed_t)((y + FIXED_HALF) >> FIXED_SHIFT);
+    }
+}
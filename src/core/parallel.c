@@ -0,0 +1,223 @@
+/**
+ * @file parallel.c
+ * @project Certifiable Inference Engine
+ * @brief Worker pool and statically partitioned GEMM.
+ *
+ * @details Workers sleep on a condition variable and wake when the job
+ * generation advances. The partition each worker handles is its fixed index,
+ * so which thread computes which output never depends on timing.
+ *
+ * @traceability SRS-003.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "parallel.h"
+#include "cpu_dispatch.h"
+#include "gemm_kernels.h"
+
+static void* pool_worker_main(void* arg) {
+    fx_pool_worker_t* self = (fx_pool_worker_t*)arg;
+    fx_pool_t* pool = self->pool;
+    uint64_t seen = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->start_cv, &pool->lock);
+        }
+        if (pool->shutdown) {
+            pthread_mutex_unlock(&pool->lock);
+            break;
+        }
+        seen = pool->generation;
+        fx_pool_job_fn job = pool->job;
+        void* ctx = pool->job_ctx;
+        const uint32_t n_parts = pool->n_threads;
+        pthread_mutex_unlock(&pool->lock);
+
+        job(ctx, self->index, n_parts);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->pending--;
+        if (pool->pending == 0u) {
+            pthread_cond_signal(&pool->done_cv);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Stop and join the workers that were started.
+ */
+static void pool_stop(fx_pool_t* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->start_cv);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (uint32_t t = 1; t <= pool->started; t++) {
+        pthread_join(pool->threads[t], NULL);
+    }
+    pool->started = 0;
+}
+
+fx_pool_res_t fx_pool_init(fx_pool_t* pool, uint32_t n_threads) {
+    if (!pool || n_threads == 0u || n_threads > FX_POOL_MAX_THREADS) {
+        return FX_POOL_INVALID_PARAM;
+    }
+
+    /* Fix the kernel selection before any concurrent use (SRS-003.10) */
+    (void)fx_dispatch_init();
+
+    pool->job = NULL;
+    pool->job_ctx = NULL;
+    pool->generation = 0;
+    pool->n_threads = n_threads;
+    pool->pending = 0;
+    pool->started = 0;
+    pool->shutdown = 0;
+
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        return FX_POOL_THREAD_ERROR;
+    }
+    if (pthread_cond_init(&pool->start_cv, NULL) != 0) {
+        pthread_mutex_destroy(&pool->lock);
+        return FX_POOL_THREAD_ERROR;
+    }
+    if (pthread_cond_init(&pool->done_cv, NULL) != 0) {
+        pthread_cond_destroy(&pool->start_cv);
+        pthread_mutex_destroy(&pool->lock);
+        return FX_POOL_THREAD_ERROR;
+    }
+
+    for (uint32_t t = 0; t < n_threads; t++) {
+        pool->workers[t].pool = pool;
+        pool->workers[t].index = t;
+    }
+
+    /* Partition 0 belongs to the caller; workers 1..n-1 get threads */
+    for (uint32_t t = 1; t < n_threads; t++) {
+        if (pthread_create(&pool->threads[t], NULL, pool_worker_main,
+                           &pool->workers[t]) != 0) {
+            pool_stop(pool);
+            pthread_cond_destroy(&pool->done_cv);
+            pthread_cond_destroy(&pool->start_cv);
+            pthread_mutex_destroy(&pool->lock);
+            return FX_POOL_THREAD_ERROR;
+        }
+        pool->started = t;
+    }
+
+    return FX_POOL_OK;
+}
+
+void fx_pool_destroy(fx_pool_t* pool) {
+    if (!pool) {
+        return;
+    }
+
+    pool_stop(pool);
+    pthread_cond_destroy(&pool->done_cv);
+    pthread_cond_destroy(&pool->start_cv);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+void fx_pool_run(fx_pool_t* pool, fx_pool_job_fn job, void* ctx) {
+    if (!pool || !job) {
+        return;
+    }
+
+    if (pool->n_threads == 1u) {
+        job(ctx, 0, 1);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->job = job;
+    pool->job_ctx = ctx;
+    pool->pending = pool->n_threads - 1u;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start_cv);
+    pthread_mutex_unlock(&pool->lock);
+
+    job(ctx, 0, pool->n_threads);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending != 0u) {
+        pthread_cond_wait(&pool->done_cv, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/* ========================================================================
+ * Parallel GEMM
+ * ======================================================================== */
+
+typedef struct {
+    const fx_matrix_t* A;
+    const fx_matrix_t* B;
+    fx_matrix_t* C;
+    int by_rows;
+} gemm_job_t;
+
+/**
+ * @brief Start of band @p part when @p units are split into @p n_parts.
+ *
+ * @details Pure function of its arguments: the partition is static.
+ */
+static size_t band_start(size_t units, uint32_t part, uint32_t n_parts) {
+    return (units * part) / n_parts;
+}
+
+static void gemm_job(void* ctx, uint32_t part, uint32_t n_parts) {
+    const gemm_job_t* g = (const gemm_job_t*)ctx;
+
+    if (g->by_rows) {
+        const size_t rows = g->A->rows;
+        fx_gemm_region(g->A, g->B, g->C,
+                       band_start(rows, part, n_parts),
+                       band_start(rows, part + 1u, n_parts),
+                       0, g->B->cols);
+    } else {
+        /* Column bands in whole FX_GEMM_NR strips; the last band takes the
+         * scalar tail columns. */
+        const size_t cols = g->B->cols;
+        const size_t strips = (cols + FX_GEMM_NR - 1u) / FX_GEMM_NR;
+        size_t j0 = band_start(strips, part, n_parts) * FX_GEMM_NR;
+        size_t j1 = band_start(strips, part + 1u, n_parts) * FX_GEMM_NR;
+
+        if (j1 > cols) {
+            j1 = cols;
+        }
+        if (j0 < j1) {
+            fx_gemm_region(g->A, g->B, g->C, 0, g->A->rows, j0, j1);
+        }
+    }
+}
+
+void fx_matrix_mul_parallel(fx_pool_t* pool, const fx_matrix_t* A,
+                            const fx_matrix_t* B, fx_matrix_t* C) {
+    /* SRS-003.4: Dimensional validation - safe failure mode */
+    if (!A || !B || !C || !A->data || !B->data || !C->data) {
+        return;
+    }
+
+    if (A->cols != B->rows || C->rows != A->rows || C->cols != B->cols) {
+        return;
+    }
+
+    if (!pool || pool->n_threads == 1u) {
+        fx_gemm_region(A, B, C, 0, A->rows, 0, B->cols);
+        return;
+    }
+
+    gemm_job_t g = {A, B, C, A->rows >= pool->n_threads};
+    fx_pool_run(pool, gemm_job, &g);
+}
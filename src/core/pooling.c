@@ -77,12 +77,12 @@ void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
      * - Inner loop: Step by 2 through input columns
      * - Each iteration processes one 2×2 window
      */
-    uint16_t out_row = 0;
+    size_t out_row = 0;
 
-    for (uint16_t i = 0; i < in->rows; i += 2) {
-        uint16_t out_col = 0;
+    for (size_t i = 0; i < in->rows; i += 2) {
+        size_t out_col = 0;
 
-        for (uint16_t j = 0; j < in->cols; j += 2) {
+        for (size_t j = 0; j < in->cols; j += 2) {
             /*
              * Extract 2×2 Window (SRS-008.2)
              *
@@ -98,8 +98,8 @@ void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
              * c = [i+1][j  ]
              * d = [i+1][j+1]
              */
-            const uint16_t row1_offset = i * in->cols;
-            const uint16_t row2_offset = (i + 1) * in->cols;
+            const size_t row1_offset = i * in->cols;
+            const size_t row2_offset = (i + 1) * in->cols;
 
             const fixed_t a = in->data[row1_offset + j];
             const fixed_t b = in->data[row1_offset + j + 1];
@@ -167,3 +167,404 @@ void fx_maxpool_2x2(const fx_matrix_t* in, fx_matrix_t* out) {
      * do not require explicit validation.
      */
 }
+
+/* ========================================================================
+ * Generic pooling (SRS-008.8, SRS-008.9, SRS-008.10)
+ * ======================================================================== */
+
+/** @brief Windows up to this length are scanned directly, longer ones use vHGW */
+#define POOL_DIRECT_MAX 4u
+
+uint32_t fx_pool_output_dim(uint32_t in, uint32_t k, uint32_t stride,
+                            uint32_t pad_before, uint32_t pad_after) {
+    if (k == 0u || stride == 0u || pad_before >= k || pad_after >= k) {
+        return 0;
+    }
+
+    const uint64_t padded = (uint64_t)in + pad_before + pad_after;
+
+    if (padded < k) {
+        return 0;
+    }
+
+    return (uint32_t)((padded - k) / stride + 1u);
+}
+
+/**
+ * @brief Validate params against in/out; returns 1 if the shapes agree.
+ */
+static int pool_shapes_valid(const fx_matrix_t* in, const fx_pool_params_t* p,
+                             const fx_matrix_t* out) {
+    if (!in || !p || !out || !in->data || !out->data) {
+        return 0;
+    }
+
+    const uint32_t out_h = fx_pool_output_dim(in->rows, p->pool_h, p->stride_h,
+                                              p->pad_top, p->pad_bottom);
+    const uint32_t out_w = fx_pool_output_dim(in->cols, p->pool_w, p->stride_w,
+                                              p->pad_left, p->pad_right);
+
+    return out_h != 0u && out_w != 0u && out->rows == out_h && out->cols == out_w;
+}
+
+size_t fx_maxpool_scratch_len(uint32_t in_h, uint32_t in_w,
+                              const fx_pool_params_t* params) {
+    if (!params) {
+        return 0;
+    }
+
+    const uint32_t out_w = fx_pool_output_dim(in_w, params->pool_w, params->stride_w,
+                                              params->pad_left, params->pad_right);
+    const uint32_t out_h = fx_pool_output_dim(in_h, params->pool_h, params->stride_h,
+                                              params->pad_top, params->pad_bottom);
+    if (out_w == 0u || out_h == 0u) {
+        return 0;
+    }
+
+    const size_t line_w = (size_t)in_w + params->pad_left + params->pad_right;
+    const size_t line_h = (size_t)in_h + params->pad_top + params->pad_bottom;
+    const size_t line = (line_w > line_h) ? line_w : line_h;
+
+    return (size_t)in_h * out_w + 3u * line;
+}
+
+/**
+ * @brief 1-D max over windows [j·s, j·s + k) of line, j = 0..out_n−1.
+ *
+ * @details For k > POOL_DIRECT_MAX, van Herk / Gil-Werman: split the line
+ * into blocks of k, take prefix maxima g and suffix maxima h within each
+ * block; a window starting at a spans the tail of one block and the head of
+ * the next, so its max is max(h[a], g[a + k − 1]).
+ */
+static void pool_max_line(const fixed_t* line, size_t k, size_t s, size_t out_n,
+                          fixed_t* dst, size_t dst_stride, fixed_t* g, fixed_t* h) {
+    if (k <= POOL_DIRECT_MAX) {
+        for (size_t j = 0; j < out_n; j++) {
+            const fixed_t* w = &line[j * s];
+            fixed_t m = w[0];
+
+            for (size_t t = 1; t < k; t++) {
+                if (w[t] > m) {
+                    m = w[t];
+                }
+            }
+            dst[j * dst_stride] = m;
+        }
+        return;
+    }
+
+    const size_t len = (out_n - 1u) * s + k;   /* Elements any window touches */
+
+    for (size_t i = 0; i < len; i++) {
+        g[i] = ((i % k) == 0u || line[i] > g[i - 1u]) ? line[i] : g[i - 1u];
+    }
+
+    for (size_t i = len; i-- > 0u;) {
+        const int block_end = ((i + 1u) % k) == 0u || i + 1u == len;
+        h[i] = (block_end || line[i] > h[i + 1u]) ? line[i] : h[i + 1u];
+    }
+
+    for (size_t j = 0; j < out_n; j++) {
+        const size_t a = j * s;
+        const fixed_t head = g[a + k - 1u];
+
+        dst[j * dst_stride] = (h[a] > head) ? h[a] : head;
+    }
+}
+
+void fx_maxpool(const fx_matrix_t* in, const fx_pool_params_t* params,
+                fx_matrix_t* out, fixed_t* scratch, size_t scratch_len) {
+    /* SRS-008.3: Validation - safe failure mode */
+    if (!scratch || !pool_shapes_valid(in, params, out)) {
+        return;
+    }
+
+    if (scratch_len < fx_maxpool_scratch_len(in->rows, in->cols, params)) {
+        return;
+    }
+
+    const size_t in_h = in->rows;
+    const size_t in_w = in->cols;
+    const size_t out_h = out->rows;
+    const size_t out_w = out->cols;
+    const size_t line_w = in_w + params->pad_left + params->pad_right;
+    const size_t line_h = in_h + params->pad_top + params->pad_bottom;
+    const size_t line_max = (line_w > line_h) ? line_w : line_h;
+    fixed_t* inter = scratch;                 /* in_h × out_w */
+    fixed_t* line = &scratch[in_h * out_w];
+    fixed_t* g = &line[line_max];
+    fixed_t* h = &g[line_max];
+
+    /* FIXED_MIN is the identity of max, so padding never wins a window
+     * that also covers an input element (guaranteed by pad < k) */
+    for (size_t i = 0; i < line_max; i++) {
+        line[i] = FIXED_MIN;
+    }
+
+    /* Horizontal pass: every input row → out_w row maxima */
+    for (size_t y = 0; y < in_h; y++) {
+        for (size_t x = 0; x < in_w; x++) {
+            line[params->pad_left + x] = in->data[y * in_w + x];
+        }
+        pool_max_line(line, params->pool_w, params->stride_w, out_w,
+                      &inter[y * out_w], 1u, g, h);
+    }
+
+    for (size_t i = 0; i < line_max; i++) {
+        line[i] = FIXED_MIN;
+    }
+
+    /* Vertical pass: every column of row maxima → out_h outputs */
+    for (size_t x = 0; x < out_w; x++) {
+        for (size_t y = 0; y < in_h; y++) {
+            line[params->pad_top + y] = inter[y * out_w + x];
+        }
+        pool_max_line(line, params->pool_h, params->stride_h, out_h,
+                      &out->data[x], out_w, g, h);
+    }
+}
+
+/**
+ * @brief Exact unsigned division by a constant without a divide instruction.
+ */
+typedef struct {
+    uint64_t magic;              /**< Granlund–Montgomery multiplier (non-power-of-two) */
+    uint32_t shift;              /**< log2(d) for powers of two, else ⌈log2 d⌉ */
+    int pow2;                    /**< Non-zero if d is a power of two */
+} pool_divisor_t;
+
+/** @brief High 64 bits of a 64×64-bit product */
+static uint64_t mul_hi64(uint64_t a, uint64_t b) {
+    const uint64_t a_lo = a & 0xFFFFFFFFu;
+    const uint64_t a_hi = a >> 32;
+    const uint64_t b_lo = b & 0xFFFFFFFFu;
+    const uint64_t b_hi = b >> 32;
+    const uint64_t lo_lo = a_lo * b_lo;
+    const uint64_t lo_hi = a_lo * b_hi;
+    const uint64_t hi_lo = a_hi * b_lo;
+    const uint64_t mid = (lo_lo >> 32) + (lo_hi & 0xFFFFFFFFu) + (hi_lo & 0xFFFFFFFFu);
+
+    return a_hi * b_hi + (lo_hi >> 32) + (hi_lo >> 32) + (mid >> 32);
+}
+
+/**
+ * @brief Precompute division by d (2 <= d < 2^32), once per call.
+ */
+static void pool_divisor_init(pool_divisor_t* dv, uint64_t d) {
+    uint32_t l = 0;
+
+    while (((uint64_t)1 << l) < d) {
+        l++;
+    }
+
+    dv->shift = l;
+    dv->pow2 = ((uint64_t)1 << l) == d;
+    dv->magic = 0;
+
+    if (dv->pow2) {
+        return;
+    }
+
+    /* magic = ⌊2^64 · (2^l − d) / d⌋ + 1, by binary long division
+     * (2^l − d < d, so the quotient fits in 64 bits) */
+    uint64_t r = ((uint64_t)1 << l) - d;
+    uint64_t q = 0;
+
+    for (int bit = 0; bit < 64; bit++) {
+        r <<= 1;
+        q <<= 1;
+        if (r >= d) {
+            r -= d;
+            q |= 1u;
+        }
+    }
+    dv->magic = q + 1u;
+}
+
+/** @brief ⌊n / d⌋, exact for every 64-bit n */
+static uint64_t pool_divide(const pool_divisor_t* dv, uint64_t n) {
+    if (dv->pow2) {
+        return n >> dv->shift;
+    }
+
+    const uint64_t t = mul_hi64(dv->magic, n);
+    return (t + ((n - t) >> 1)) >> (dv->shift - 1u);
+}
+
+/**
+ * @brief round(sum / area), half away from zero; dv divides by 2·area.
+ *
+ * @details round(|S| / A) half up = ⌊(2|S| + A) / 2A⌋. With A <= 2^30 and
+ * |S| <= A·2^31 the numerator stays below 2^63.
+ */
+static fixed_t pool_mean(const pool_divisor_t* dv, int64_t sum, uint64_t area) {
+    const uint64_t mag = (sum < 0) ? (uint64_t)0 - (uint64_t)sum : (uint64_t)sum;
+    const uint64_t q = pool_divide(dv, 2u * mag + area);
+
+    return (sum < 0) ? (fixed_t)(-(int64_t)q) : (fixed_t)q;
+}
+
+void fx_avgpool(const fx_matrix_t* in, const fx_pool_params_t* params,
+                fx_matrix_t* out) {
+    /* SRS-008.3: Validation - safe failure mode */
+    if (!pool_shapes_valid(in, params, out)) {
+        return;
+    }
+
+    const uint64_t area = (uint64_t)params->pool_h * params->pool_w;
+    if (area > FX_AVGPOOL_MAX_AREA) {
+        return;
+    }
+
+    pool_divisor_t dv;
+    pool_divisor_init(&dv, 2u * area);
+
+    const int64_t in_h = (int64_t)in->rows;
+    const int64_t in_w = (int64_t)in->cols;
+
+    for (size_t y = 0; y < out->rows; y++) {
+        /* Window rows clipped to the input; padding contributes zero */
+        const int64_t y0 = (int64_t)(y * params->stride_h) - (int64_t)params->pad_top;
+        const int64_t y_b = (y0 < 0) ? 0 : y0;
+        const int64_t y_e = (y0 + (int64_t)params->pool_h > in_h) ? in_h : y0 + (int64_t)params->pool_h;
+
+        for (size_t x = 0; x < out->cols; x++) {
+            const int64_t x0 = (int64_t)(x * params->stride_w) - (int64_t)params->pad_left;
+            const int64_t x_b = (x0 < 0) ? 0 : x0;
+            const int64_t x_e = (x0 + (int64_t)params->pool_w > in_w) ? in_w : x0 + (int64_t)params->pool_w;
+            int64_t sum = 0;
+
+            for (int64_t iy = y_b; iy < y_e; iy++) {
+                const fixed_t* row = &in->data[(size_t)iy * in->cols];
+                for (int64_t ix = x_b; ix < x_e; ix++) {
+                    sum += row[ix];
+                }
+            }
+
+            out->data[y * out->cols + x] = pool_mean(&dv, sum, area);
+        }
+    }
+}
+
+/* ========================================================================
+ * Integral image, box filter and global average pooling (SRS-008.12)
+ * ======================================================================== */
+
+void fx_integral_build(fx_integral_t* sat, int64_t* buffer, size_t buffer_len,
+                       const fx_matrix_t* in) {
+    if (!sat) {
+        return;
+    }
+
+    sat->data = buffer;
+    sat->rows = 0;
+    sat->cols = 0;
+
+    if (!buffer || !in || !in->data || buffer_len < FX_INTEGRAL_LEN(in->rows, in->cols)) {
+        return;
+    }
+
+    const size_t stride = (size_t)in->cols + 1u;
+
+    /* Row 0 and column 0 are zero so every query needs no bounds test */
+    for (size_t x = 0; x < stride; x++) {
+        buffer[x] = 0;
+    }
+
+    for (size_t y = 0; y < in->rows; y++) {
+        const fixed_t* src = &in->data[y * in->cols];
+        const int64_t* above = &buffer[y * stride];
+        int64_t* row = &buffer[(y + 1u) * stride];
+        int64_t run = 0;
+
+        row[0] = 0;
+        for (size_t x = 0; x < in->cols; x++) {
+            run += src[x];
+            row[x + 1u] = above[x + 1u] + run;
+        }
+    }
+
+    sat->rows = in->rows;
+    sat->cols = in->cols;
+}
+
+int64_t fx_integral_box_sum(const fx_integral_t* sat, uint32_t y0, uint32_t x0,
+                            uint32_t y1, uint32_t x1) {
+    if (!sat || !sat->data || y0 > y1 || x0 > x1 || y1 > sat->rows || x1 > sat->cols) {
+        return 0;
+    }
+
+    const size_t stride = (size_t)sat->cols + 1u;
+
+    return sat->data[y1 * stride + x1] - sat->data[y0 * stride + x1]
+         - sat->data[y1 * stride + x0] + sat->data[y0 * stride + x0];
+}
+
+void fx_box_filter(const fx_integral_t* sat, const fx_pool_params_t* params,
+                   fx_matrix_t* out) {
+    /* SRS-008.3: Validation - safe failure mode */
+    if (!sat || !sat->data || !params || !out || !out->data || sat->rows == 0u) {
+        return;
+    }
+
+    const uint32_t out_h = fx_pool_output_dim(sat->rows, params->pool_h, params->stride_h,
+                                              params->pad_top, params->pad_bottom);
+    const uint32_t out_w = fx_pool_output_dim(sat->cols, params->pool_w, params->stride_w,
+                                              params->pad_left, params->pad_right);
+    const uint64_t area = (uint64_t)params->pool_h * params->pool_w;
+
+    if (out_h == 0u || out_w == 0u || out->rows != out_h || out->cols != out_w ||
+        area > FX_AVGPOOL_MAX_AREA) {
+        return;
+    }
+
+    pool_divisor_t dv;
+    pool_divisor_init(&dv, 2u * area);
+
+    for (size_t y = 0; y < out_h; y++) {
+        /* Window clipped to the image; padding contributes zero */
+        const int64_t y0 = (int64_t)(y * params->stride_h) - (int64_t)params->pad_top;
+        const int64_t y1 = y0 + (int64_t)params->pool_h;
+        const uint32_t y_b = (y0 < 0) ? 0u : (uint32_t)y0;
+        const uint32_t y_e = (y1 > (int64_t)sat->rows) ? sat->rows : (uint32_t)y1;
+
+        for (size_t x = 0; x < out_w; x++) {
+            const int64_t x0 = (int64_t)(x * params->stride_w) - (int64_t)params->pad_left;
+            const int64_t x1 = x0 + (int64_t)params->pool_w;
+            const uint32_t x_b = (x0 < 0) ? 0u : (uint32_t)x0;
+            const uint32_t x_e = (x1 > (int64_t)sat->cols) ? sat->cols : (uint32_t)x1;
+
+            out->data[y * out_w + x] =
+                pool_mean(&dv, fx_integral_box_sum(sat, y_b, x_b, y_e, x_e), area);
+        }
+    }
+}
+
+void fx_global_avgpool(const fx_tensor_t* in, fx_matrix_t* out) {
+    /* SRS-008.3: Validation - safe failure mode */
+    if (!in || !out || !in->data || !out->data || in->rows == 0u || in->cols == 0u) {
+        return;
+    }
+
+    const uint64_t area = (uint64_t)in->rows * in->cols;
+
+    if (out->rows != 1u || out->cols != in->channels || area > FX_AVGPOOL_MAX_AREA) {
+        return;
+    }
+
+    pool_divisor_t dv;
+    pool_divisor_init(&dv, 2u * area);
+
+    for (size_t c = 0; c < in->channels; c++) {
+        /* The whole-plane sum is the bottom-right integral-image entry; a
+         * single pass yields it without storing the table */
+        int64_t sum = 0;
+
+        for (size_t y = 0; y < in->rows; y++) {
+            for (size_t x = 0; x < in->cols; x++) {
+                sum += in->data[fx_tensor_index(in, c, y, x)];
+            }
+        }
+        out->data[c] = pool_mean(&dv, sum, area);
+    }
+}
@@ -0,0 +1,237 @@
+/**
+ * @file qint8.c
+ * @project Certifiable Inference Engine
+ * @brief Integer-only int8 dense and convolution layers.
+ *
+ * @details The inner loops are plain int8 × int8 → int32 reductions over
+ * raw values: the input zero point lives in the folded bias, so nothing is
+ * subtracted per element and the loops vectorize as widening multiply-adds.
+ * Each output then takes one int64_t rescale with a single round-half-up,
+ * the output zero point and one clamp that also implements ReLU/ReLU6.
+ *
+ * @traceability SRS-009-QUANTIZATION
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "qint8.h"
+
+/** @brief Σ x[k] · w[k], exact for n <= FX_Q8_MAX_DEPTH */
+static int32_t q8_dot(const int8_t* x, const int8_t* w, size_t n) {
+    int32_t acc = 0;
+
+    for (size_t k = 0; k < n; k++) {
+        acc += (int32_t)x[k] * w[k];
+    }
+
+    return acc;
+}
+
+/** @brief Clamp to [lo, hi] */
+static int64_t q8_clamp(int64_t v, int64_t lo, int64_t hi) {
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+/** @brief Rescale of output channel j */
+static const fx_requant_t* q8_rescale(const fx_q8_params_t* p, size_t j) {
+    return (p->channel != NULL) ? &p->channel[j] : &p->tensor;
+}
+
+/**
+ * @brief SRS-009.4 output stage: bias, one rounding, zero point, clamp.
+ */
+static int8_t q8_output(const fx_q8_params_t* p, size_t j, int32_t dot) {
+    const int64_t acc = (int64_t)dot + (p->bias ? p->bias[j] : 0);
+    const int64_t y = fx_requant_apply(acc, q8_rescale(p, j)) + p->out_zero_point;
+
+    return (int8_t)q8_clamp(y, p->act_min, p->act_max);
+}
+
+/** @brief Multiplier positive and shift in range */
+static int requant_valid(const fx_requant_t* r) {
+    return r->multiplier > 0 && r->shift >= FX_Q8_SHIFT_MIN && r->shift <= FX_Q8_SHIFT_MAX;
+}
+
+/** @brief Every rescale valid, zero point and clamp inside int8 */
+static int params_valid(const fx_q8_params_t* p, size_t channels) {
+    if (!p || p->act_min < INT8_MIN || p->act_max > INT8_MAX || p->act_min > p->act_max) {
+        return 0;
+    }
+
+    if (p->out_zero_point < INT8_MIN || p->out_zero_point > INT8_MAX) {
+        return 0;
+    }
+
+    if (p->channel == NULL) {
+        return requant_valid(&p->tensor);
+    }
+
+    for (size_t j = 0; j < channels; j++) {
+        if (!requant_valid(&p->channel[j])) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+void fx_q8_fold_bias(const fx_q8_matrix_t* weights, int32_t in_zero_point,
+                     const int32_t* bias, int32_t* folded) {
+    if (!weights || !weights->data || !folded) {
+        return;
+    }
+
+    const size_t k_len = weights->cols;
+
+    for (size_t j = 0; j < weights->rows; j++) {
+        const int8_t* w_row = &weights->data[j * k_len];
+        int64_t sum = 0;
+
+        for (size_t k = 0; k < k_len; k++) {
+            sum += w_row[k];
+        }
+
+        const int64_t b = (bias ? bias[j] : 0) - (int64_t)in_zero_point * sum;
+        folded[j] = (int32_t)q8_clamp(b, INT32_MIN, INT32_MAX);
+    }
+}
+
+void fx_q8_fold_activation(fx_q8_params_t* params, fx_activation_kind_t kind,
+                           int32_t six) {
+    if (!params) {
+        return;
+    }
+
+    const int32_t z = params->out_zero_point;
+
+    switch (kind) {
+        case FX_ACT_IDENTITY:
+            params->act_min = INT8_MIN;
+            params->act_max = INT8_MAX;
+            break;
+        case FX_ACT_RELU:
+            params->act_min = (int32_t)q8_clamp(z, INT8_MIN, INT8_MAX);
+            params->act_max = INT8_MAX;
+            break;
+        case FX_ACT_RELU6:
+            params->act_min = (int32_t)q8_clamp(z, INT8_MIN, INT8_MAX);
+            params->act_max = (int32_t)q8_clamp((int64_t)z + six, params->act_min, INT8_MAX);
+            break;
+        default:
+            /* Not a clamp: leave the output stage unchanged */
+            break;
+    }
+}
+
+void fx_q8_matrix_mul(const fx_q8_matrix_t* in, const fx_q8_matrix_t* weights,
+                      const fx_q8_params_t* params, fx_q8_matrix_t* out) {
+    /* SRS-003.4: Dimensional validation - safe failure mode */
+    if (!in || !weights || !out || !in->data || !weights->data || !out->data) {
+        return;
+    }
+
+    if (in->cols != weights->cols || in->cols > FX_Q8_MAX_DEPTH ||
+        out->rows != in->rows || out->cols != weights->rows) {
+        return;
+    }
+
+    if (!params_valid(params, weights->rows)) {
+        return;
+    }
+
+    const size_t k_len = in->cols;
+    const size_t p_cols = out->cols;
+
+    for (size_t i = 0; i < in->rows; i++) {
+        const int8_t* x_row = &in->data[i * k_len];
+        int8_t* y_row = &out->data[i * p_cols];
+
+        for (size_t j = 0; j < p_cols; j++) {
+            y_row[j] = q8_output(params, j, q8_dot(x_row, &weights->data[j * k_len], k_len));
+        }
+    }
+}
+
+void fx_q8_conv2d(const fx_q8_tensor_t* in, const fx_q8_matrix_t* filter,
+                  uint32_t k_h, uint32_t k_w, const fx_q8_params_t* params,
+                  fx_q8_tensor_t* out) {
+    /* SRS-006.1: Dimension validation - safe failure mode */
+    if (!in || !filter || !out || !in->data || !filter->data || !out->data) {
+        return;
+    }
+
+    if (in->layout != out->layout || k_h == 0u || k_w == 0u ||
+        k_h > in->rows || k_w > in->cols) {
+        return;
+    }
+
+    const size_t c_in = in->channels;
+    const size_t taps = c_in * k_h * k_w;
+
+    if ((size_t)filter->cols != taps || taps > FX_Q8_MAX_DEPTH || filter->rows != out->channels) {
+        return;
+    }
+
+    if (out->rows != in->rows - k_h + 1u || out->cols != in->cols - k_w + 1u) {
+        return;
+    }
+
+    if (!params_valid(params, out->channels)) {
+        return;
+    }
+
+    for (size_t o = 0; o < out->channels; o++) {
+        const int8_t* w = &filter->data[o * taps];
+
+        for (size_t y = 0; y < out->rows; y++) {
+            for (size_t x = 0; x < out->cols; x++) {
+                int32_t acc = 0;
+
+                if (in->layout == FX_LAYOUT_NHWC) {
+                    /* KW × C_in contiguous inputs against contiguous OHWI weights */
+                    for (size_t ky = 0; ky < k_h; ky++) {
+                        acc += q8_dot(&in->data[fx_q8_tensor_index(in, 0, y + ky, x)],
+                                      &w[ky * k_w * c_in], (size_t)k_w * c_in);
+                    }
+                } else {
+                    for (size_t c = 0; c < c_in; c++) {
+                        for (size_t ky = 0; ky < k_h; ky++) {
+                            acc += q8_dot(&in->data[fx_q8_tensor_index(in, c, y + ky, x)],
+                                          &w[(c * k_h + ky) * k_w], k_w);
+                        }
+                    }
+                }
+
+                out->data[fx_q8_tensor_index(out, o, y, x)] = q8_output(params, o, acc);
+            }
+        }
+    }
+}
+
+void fx_q8_quantize(const fixed_t* in, size_t n, const fx_requant_t* r,
+                    int32_t zero_point, int8_t* out) {
+    if (!in || !out || !r || !requant_valid(r)) {
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const int64_t q = fx_requant_apply(in[i], r) + zero_point;
+        out[i] = (int8_t)q8_clamp(q, INT8_MIN, INT8_MAX);
+    }
+}
+
+void fx_q8_dequantize(const int8_t* in, size_t n, const fx_requant_t* r,
+                      int32_t zero_point, fixed_t* out) {
+    if (!in || !out || !r || !requant_valid(r)) {
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const int64_t x = fx_requant_apply((int64_t)in[i] - zero_point, r);
+        out[i] = (fixed_t)q8_clamp(x, FIXED_MIN, FIXED_MAX);
+    }
+}
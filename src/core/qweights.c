@@ -0,0 +1,250 @@
+/**
+ * @file qweights.c
+ * @project Certifiable Inference Engine
+ * @brief Dense and convolution layers with int8/int16 weights.
+ *
+ * @details Every output is one exact int64_t sum of Q16.16 activations times
+ * narrow integer weights, in Q(16 + f) for that output channel, followed by
+ * a single round-half-up to Q16.16. The weight element type is resolved once
+ * per dot product, so the inner loops are plain widening multiply-adds with
+ * four independent accumulators; integer addition is associative, so the
+ * split does not change the sum.
+ *
+ * When max|x| · l1_max proves that no partial sum leaves int32_t, the
+ * dot products run on the dispatched int32_t kernels instead: twice the
+ * lanes per vector register and the same exact sum.
+ *
+ * @traceability SRS-009-QUANTIZATION
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "qweights.h"
+#include "gemm_kernels.h"
+
+/** @brief Outputs rounded and activated together before their single store */
+#define QW_CHUNK 16u
+
+/** @brief Σ x[k] · q[k] for int8_t weights */
+static int64_t qdot_i8(const fixed_t* x, const int8_t* q, size_t n) {
+    int64_t a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+    size_t k = 0;
+
+    for (; k + 4u <= n; k += 4u) {
+        a0 += (int64_t)x[k] * q[k];
+        a1 += (int64_t)x[k + 1u] * q[k + 1u];
+        a2 += (int64_t)x[k + 2u] * q[k + 2u];
+        a3 += (int64_t)x[k + 3u] * q[k + 3u];
+    }
+    for (; k < n; k++) {
+        a0 += (int64_t)x[k] * q[k];
+    }
+
+    return (a0 + a1) + (a2 + a3);
+}
+
+/** @brief Σ x[k] · q[k] for int16_t weights */
+static int64_t qdot_i16(const fixed_t* x, const int16_t* q, size_t n) {
+    int64_t a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+    size_t k = 0;
+
+    for (; k + 4u <= n; k += 4u) {
+        a0 += (int64_t)x[k] * q[k];
+        a1 += (int64_t)x[k + 1u] * q[k + 1u];
+        a2 += (int64_t)x[k + 2u] * q[k + 2u];
+        a3 += (int64_t)x[k + 3u] * q[k + 3u];
+    }
+    for (; k < n; k++) {
+        a0 += (int64_t)x[k] * q[k];
+    }
+
+    return (a0 + a1) + (a2 + a3);
+}
+
+/**
+ * @brief Σ x[k] · w[row][offset + k] for k in [0, n)
+ *
+ * @param narrow Non-zero when qw_int32_safe() proved the int32_t path exact
+ */
+static int64_t qdot(const fx_qweights_t* w, size_t row, size_t offset,
+                    const fixed_t* x, size_t n, int narrow) {
+    const size_t base = row * w->cols + offset;
+
+    if (w->type == FX_QW_INT8) {
+        const int8_t* q = &((const int8_t*)w->data)[base];
+        return narrow ? fx_gemm_kernels()->qdot32_i8(x, q, n) : qdot_i8(x, q, n);
+    }
+
+    const int16_t* q = &((const int16_t*)w->data)[base];
+    return narrow ? fx_gemm_kernels()->qdot32_i16(x, q, n) : qdot_i16(x, q, n);
+}
+
+/**
+ * @brief max|x| · l1_max <= INT32_MAX, so every partial sum fits int32_t
+ *
+ * @complexity O(n)
+ */
+static int qw_int32_safe(const fx_qweights_t* w, const fixed_t* x, size_t n) {
+    uint32_t max_abs = 0;
+
+    if (w->l1_max == 0u) {
+        return 0;
+    }
+
+    for (size_t k = 0; k < n; k++) {
+        /* Unsigned negation: |INT32_MIN| = 2^31 is representable */
+        const uint32_t a = (x[k] < 0) ? 0u - (uint32_t)x[k] : (uint32_t)x[k];
+        max_abs = (a > max_abs) ? a : max_abs;
+    }
+
+    return (uint64_t)max_abs * w->l1_max <= (uint64_t)INT32_MAX;
+}
+
+/** @brief Bias at the Q(16 + f) scale of the accumulator (exact) */
+static int64_t qw_bias(const fx_matrix_t* bias, size_t o, uint32_t f) {
+    return bias ? (int64_t)bias->data[o] * ((int64_t)1 << f) : 0;
+}
+
+/** @brief Single round-half-up from Q(16 + f) to Q16.16 */
+static fixed_t qw_round(int64_t acc, uint32_t f) {
+    if (f == 0u) {
+        return (fixed_t)acc;
+    }
+    return (fixed_t)((acc + ((int64_t)1 << (f - 1u))) >> f);
+}
+
+/** @brief Weights present, known type, depth and every fraction-bit count in range */
+static int qweights_valid(const fx_qweights_t* w) {
+    if (!w || !w->data || w->rows == 0u || w->cols == 0u) {
+        return 0;
+    }
+
+    /* |x · q| <= 2^46: longer rows could overflow the int64_t sum */
+    if (w->cols > FX_QW_MAX_DEPTH) {
+        return 0;
+    }
+
+    if (w->type != FX_QW_INT8 && w->type != FX_QW_INT16) {
+        return 0;
+    }
+
+    for (size_t o = 0; o < w->rows; o++) {
+        if (fx_qweights_frac(w, o) > FX_QW_MAX_FRAC) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+void fx_qdense_forward(const fx_matrix_t* in, const fx_qweights_t* weights,
+                       const fx_matrix_t* bias, const fx_activation_t* act,
+                       fx_matrix_t* out) {
+    /* SRS-003.4: Dimensional validation - safe failure mode */
+    if (!in || !out || !in->data || !out->data || !qweights_valid(weights)) {
+        return;
+    }
+
+    if (in->cols != weights->cols || out->rows != in->rows || out->cols != weights->rows) {
+        return;
+    }
+
+    if (bias && (!bias->data || bias->rows != 1u || bias->cols != weights->rows)) {
+        return;
+    }
+
+    const size_t k_len = in->cols;
+    const size_t p_cols = out->cols;
+
+    for (size_t i = 0; i < in->rows; i++) {
+        const fixed_t* x_row = &in->data[i * k_len];
+        fixed_t* y_row = &out->data[i * p_cols];
+        const int narrow = qw_int32_safe(weights, x_row, k_len);
+
+        for (size_t j0 = 0; j0 < p_cols; j0 += QW_CHUNK) {
+            const size_t len = (p_cols - j0 < QW_CHUNK) ? p_cols - j0 : QW_CHUNK;
+            fixed_t v[QW_CHUNK];
+
+            for (size_t jj = 0; jj < len; jj++) {
+                const size_t j = j0 + jj;
+                const uint32_t f = fx_qweights_frac(weights, j);
+
+                /* SRS-009.2: bias folded at the accumulator's scale, one rounding */
+                v[jj] = qw_round(qw_bias(bias, j, f) + qdot(weights, j, 0, x_row, k_len, narrow), f);
+            }
+
+            fx_activation_apply(act, v, len);
+
+            /* Single store per output element */
+            for (size_t jj = 0; jj < len; jj++) {
+                y_row[j0 + jj] = v[jj];
+            }
+        }
+    }
+}
+
+void fx_qconv2d_tensor(const fx_tensor_t* in, const fx_qweights_t* filter,
+                       uint32_t k_h, uint32_t k_w,
+                       const fx_matrix_t* bias, fx_tensor_t* out) {
+    /* SRS-006.1: Dimension validation - safe failure mode */
+    if (!in || !out || !in->data || !out->data || !qweights_valid(filter)) {
+        return;
+    }
+
+    if (in->layout != out->layout || k_h == 0u || k_w == 0u ||
+        k_h > in->rows || k_w > in->cols) {
+        return;
+    }
+
+    const size_t c_in = in->channels;
+
+    if ((size_t)filter->cols != c_in * k_h * k_w || filter->rows != out->channels) {
+        return;
+    }
+
+    if (out->rows != in->rows - k_h + 1u || out->cols != in->cols - k_w + 1u) {
+        return;
+    }
+
+    if (bias && (!bias->data || bias->rows != 1u || bias->cols != out->channels)) {
+        return;
+    }
+
+    const size_t out_h = out->rows;
+    const size_t out_w = out->cols;
+    const int narrow = qw_int32_safe(filter, in->data, c_in * in->rows * in->cols);
+
+    for (size_t o = 0; o < out->channels; o++) {
+        const uint32_t f = fx_qweights_frac(filter, o);
+        const int64_t acc0 = qw_bias(bias, o, f);
+
+        for (size_t y = 0; y < out_h; y++) {
+            for (size_t x = 0; x < out_w; x++) {
+                int64_t acc = acc0;
+
+                if (in->layout == FX_LAYOUT_NHWC) {
+                    /* KW × C_in contiguous inputs against contiguous OHWI weights */
+                    for (size_t ky = 0; ky < k_h; ky++) {
+                        acc += qdot(filter, o, ky * k_w * c_in,
+                                    &in->data[fx_tensor_index(in, 0, y + ky, x)],
+                                    (size_t)k_w * c_in, narrow);
+                    }
+                } else {
+                    for (size_t c = 0; c < c_in; c++) {
+                        for (size_t ky = 0; ky < k_h; ky++) {
+                            acc += qdot(filter, o, (c * k_h + ky) * k_w,
+                                        &in->data[fx_tensor_index(in, c, y + ky, x)], k_w, narrow);
+                        }
+                    }
+                }
+
+                /* SRS-006.4: Single rounding */
+                out->data[fx_tensor_index(out, o, y, x)] = qw_round(acc, f);
+            }
+        }
+    }
+}
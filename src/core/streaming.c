@@ -0,0 +1,145 @@
+/**
+ * @file streaming.c
+ * @project Certifiable Inference Engine
+ * @brief Line-buffer convolution and max pooling for row-at-a-time input.
+ *
+ * @details Input row r is stored in ring slot r mod KH, so the KH rows that
+ * output row y depends on are slots (y + ky) mod KH, ky = 0..KH−1. No row
+ * is ever moved; each push is one row copy plus, once warm, one output row.
+ *
+ * @traceability SRS-006.17, SRS-008.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "streaming.h"
+#include <string.h>
+
+void fx_stream_conv_init(fx_stream_conv_t* s, const fx_matrix_t* kernel,
+                         uint32_t in_w, fixed_t* ring, size_t ring_len) {
+    if (!s) {
+        return;
+    }
+
+    s->kernel = NULL;
+    s->ring = ring;
+    s->in_w = in_w;
+    s->rows_in = 0;
+
+    if (!kernel || !kernel->data || !ring || kernel->rows == 0u ||
+        kernel->cols == 0u || kernel->cols > in_w) {
+        return;
+    }
+
+    if (ring_len < FX_STREAM_CONV_RING_LEN(kernel->rows, in_w)) {
+        return;
+    }
+
+    s->kernel = kernel;
+}
+
+void fx_stream_conv_reset(fx_stream_conv_t* s) {
+    if (s) {
+        s->rows_in = 0;
+    }
+}
+
+int fx_stream_conv_push(fx_stream_conv_t* s, const fixed_t* row, fixed_t* out_row) {
+    /* SRS-006.1: Validation - safe failure mode */
+    if (!s || !s->kernel || !row || !out_row) {
+        return 0;
+    }
+
+    const fx_matrix_t* kernel = s->kernel;
+    const size_t k_h = kernel->rows;
+    const size_t k_w = kernel->cols;
+    const size_t in_w = s->in_w;
+    const size_t out_w = in_w - k_w + 1u;
+
+    memcpy(&s->ring[(s->rows_in % k_h) * in_w], row, in_w * sizeof(fixed_t));
+    s->rows_in++;
+
+    if (s->rows_in < k_h) {
+        return 0;
+    }
+
+    /* Output row y = rows_in − KH; its first input row sits in slot y mod KH */
+    const size_t first_slot = (s->rows_in - k_h) % k_h;
+
+    for (size_t x = 0; x < out_w; x++) {
+        /* SRS-006.3: 64-bit accumulator, same sum as fx_conv2d() */
+        int64_t acc = 0;
+
+        for (size_t ky = 0; ky < k_h; ky++) {
+            const fixed_t* in_row = &s->ring[((first_slot + ky) % k_h) * in_w + x];
+            const fixed_t* k_row = &kernel->data[ky * k_w];
+
+            for (size_t kx = 0; kx < k_w; kx++) {
+                acc += (int64_t)in_row[kx] * k_row[kx];
+            }
+        }
+
+        /* SRS-006.4: Single rounding */
+        out_row[x] = (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+    }
+
+    return 1;
+}
+
+void fx_stream_pool_init(fx_stream_pool_t* s, uint32_t in_w,
+                         fixed_t* pending, size_t pending_len) {
+    if (!s) {
+        return;
+    }
+
+    s->pending = pending;
+    s->in_w = 0;
+    s->rows_in = 0;
+
+    if (!pending || in_w == 0u || (in_w % 2u) != 0u ||
+        pending_len < FX_STREAM_POOL_ROW_LEN(in_w)) {
+        return;
+    }
+
+    s->in_w = in_w;
+}
+
+void fx_stream_pool_reset(fx_stream_pool_t* s) {
+    if (s) {
+        s->rows_in = 0;
+    }
+}
+
+int fx_stream_pool_push(fx_stream_pool_t* s, const fixed_t* row, fixed_t* out_row) {
+    /* SRS-008.3: Validation - safe failure mode */
+    if (!s || s->in_w == 0u || !row || !out_row) {
+        return 0;
+    }
+
+    const size_t out_w = s->in_w / 2u;
+    const int top = (s->rows_in % 2u) == 0u;
+
+    s->rows_in++;
+
+    /* SRS-008.2: max is associative, so max(max(a,b), max(c,d)) equals the
+     * sequential selection of fx_maxpool_2x2() */
+    for (size_t j = 0; j < out_w; j++) {
+        fixed_t m = row[2u * j];
+
+        if (row[2u * j + 1u] > m) {
+            m = row[2u * j + 1u];
+        }
+
+        if (top) {
+            s->pending[j] = m;
+        } else {
+            out_row[j] = (s->pending[j] > m) ? s->pending[j] : m;
+        }
+    }
+
+    return top ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file winograd.c
+ * @project Certifiable Inference Engine
+ * @brief Exact integer Winograd F(2×2,3×3) convolution.
+ *
+ * @details Transforms (correlation form, as used by fx_conv2d()):
+ *
+ *   Bᵀ = | 1  0 -1  0 |   G' = 2G = | 2  0  0 |   Aᵀ = | 1  1  1  0 |
+ *        | 0  1  1  0 |             | 1  1  1 |        | 0  1 -1 -1 |
+ *        | 0 -1  1  0 |             | 1 -1  1 |
+ *        | 0  1  0 -1 |             | 0  0  2 |
+ *
+ *   4·Y = Aᵀ [ (G' g G'ᵀ) ⊙ (Bᵀ d B) ] A
+ *
+ * Everything after the filter transform runs modulo 2^64 in uint64_t, which
+ * is exact for the final 4·Y as long as it fits in a signed 64-bit value.
+ *
+ * @traceability SRS-006.15
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "convolution.h"
+
+void fx_winograd_filter_init(fx_winograd_filter_t* wf, int64_t* buffer,
+                             size_t buffer_len, const fx_conv_filter_t* filter) {
+    if (!wf) {
+        return;
+    }
+
+    wf->data = buffer;
+    wf->out_channels = 0;
+    wf->in_channels = 0;
+
+    if (!buffer || !filter || !filter->data || filter->rows != 3u || filter->cols != 3u) {
+        return;
+    }
+
+    if (buffer_len < FX_WINOGRAD_FILTER_LEN(filter->out_channels, filter->in_channels)) {
+        return;
+    }
+
+    for (size_t o = 0; o < filter->out_channels; o++) {
+        for (size_t i = 0; i < filter->in_channels; i++) {
+            int64_t g[3][3];
+            int64_t t[4][3];
+            int64_t* u = &buffer[(o * filter->in_channels + i) * 16u];
+
+            for (size_t r = 0; r < 3u; r++) {
+                for (size_t c = 0; c < 3u; c++) {
+                    g[r][c] = filter->data[fx_filter_index(filter, o, i, r, c)];
+                }
+            }
+
+            /* t = G' g */
+            for (size_t c = 0; c < 3u; c++) {
+                t[0][c] = 2 * g[0][c];
+                t[1][c] = g[0][c] + g[1][c] + g[2][c];
+                t[2][c] = g[0][c] - g[1][c] + g[2][c];
+                t[3][c] = 2 * g[2][c];
+            }
+
+            /* U' = t G'ᵀ */
+            for (size_t r = 0; r < 4u; r++) {
+                u[r * 4u + 0u] = 2 * t[r][0];
+                u[r * 4u + 1u] = t[r][0] + t[r][1] + t[r][2];
+                u[r * 4u + 2u] = t[r][0] - t[r][1] + t[r][2];
+                u[r * 4u + 3u] = 2 * t[r][2];
+            }
+        }
+    }
+
+    wf->out_channels = filter->out_channels;
+    wf->in_channels = filter->in_channels;
+}
+
+/**
+ * @brief V = Bᵀ d B for one 4×4 input tile (mod 2^64).
+ */
+static void winograd_input_transform(uint64_t d[4][4], uint64_t* v) {
+    uint64_t t[4][4];
+
+    for (size_t c = 0; c < 4u; c++) {
+        t[0][c] = d[0][c] - d[2][c];
+        t[1][c] = d[1][c] + d[2][c];
+        t[2][c] = d[2][c] - d[1][c];
+        t[3][c] = d[1][c] - d[3][c];
+    }
+
+    for (size_t r = 0; r < 4u; r++) {
+        v[r * 4u + 0u] = t[r][0] - t[r][2];
+        v[r * 4u + 1u] = t[r][1] + t[r][2];
+        v[r * 4u + 2u] = t[r][2] - t[r][1];
+        v[r * 4u + 3u] = t[r][1] - t[r][3];
+    }
+}
+
+/**
+ * @brief Y = Aᵀ M A; returns the 2×2 tile as exact signed 4·Y values.
+ */
+static void winograd_output_transform(const uint64_t* m, int64_t y[2][2]) {
+    uint64_t s[2][4];
+
+    for (size_t c = 0; c < 4u; c++) {
+        s[0][c] = m[0u * 4u + c] + m[1u * 4u + c] + m[2u * 4u + c];
+        s[1][c] = m[1u * 4u + c] - m[2u * 4u + c] - m[3u * 4u + c];
+    }
+
+    for (size_t r = 0; r < 2u; r++) {
+        /* Two's complement reinterpretation of the exact residue */
+        y[r][0] = (int64_t)(s[r][0] + s[r][1] + s[r][2]);
+        y[r][1] = (int64_t)(s[r][1] - s[r][2] - s[r][3]);
+    }
+}
+
+void fx_conv2d_winograd(const fx_tensor_t* in, const fx_winograd_filter_t* wf,
+                        const fx_matrix_t* bias, fx_tensor_t* out,
+                        int64_t* scratch, size_t scratch_len) {
+    /* SRS-006.1: Validation - safe failure mode */
+    if (!in || !wf || !out || !scratch || !in->data || !wf->data || !out->data) {
+        return;
+    }
+
+    if (wf->out_channels == 0u || wf->in_channels != in->channels ||
+        wf->out_channels != out->channels || out->layout != in->layout) {
+        return;
+    }
+
+    if (in->rows < 3u || in->cols < 3u ||
+        out->rows != in->rows - 2u || out->cols != in->cols - 2u) {
+        return;
+    }
+
+    if (bias && (!bias->data || bias->rows != 1u || bias->cols != out->channels)) {
+        return;
+    }
+
+    if (scratch_len < FX_WINOGRAD_SCRATCH_LEN(in->channels)) {
+        return;
+    }
+
+    const size_t c_in = in->channels;
+    const size_t c_out = out->channels;
+    const size_t out_h = out->rows;
+    const size_t out_w = out->cols;
+    uint64_t* v_all = (uint64_t*)scratch;
+
+    for (size_t ty = 0; ty < out_h; ty += 2u) {
+        for (size_t tx = 0; tx < out_w; tx += 2u) {
+            /* Input transforms for every channel of this tile. Positions
+             * past the input edge feed only outputs that are not stored. */
+            for (size_t i = 0; i < c_in; i++) {
+                uint64_t d[4][4];
+
+                for (size_t r = 0; r < 4u; r++) {
+                    for (size_t c = 0; c < 4u; c++) {
+                        const size_t iy = ty + r;
+                        const size_t ix = tx + c;
+                        d[r][c] = (iy < in->rows && ix < in->cols)
+                                  ? (uint64_t)(int64_t)in->data[fx_tensor_index(in, i, iy, ix)]
+                                  : 0u;
+                    }
+                }
+                winograd_input_transform(d, &v_all[i * 16u]);
+            }
+
+            for (size_t o = 0; o < c_out; o++) {
+                const int64_t* u_o = &wf->data[o * c_in * 16u];
+                const int64_t acc0 = bias ? (int64_t)bias->data[o] * FIXED_ONE : 0;
+                uint64_t m[16] = {0};
+                int64_t y[2][2];
+
+                /* 16 multiplies per channel pair (36 for the direct form) */
+                for (size_t i = 0; i < c_in; i++) {
+                    const int64_t* u = &u_o[i * 16u];
+                    const uint64_t* v = &v_all[i * 16u];
+
+                    for (size_t e = 0; e < 16u; e++) {
+                        m[e] += (uint64_t)u[e] * v[e];
+                    }
+                }
+
+                winograd_output_transform(m, y);
+
+                for (size_t r = 0; r < 2u && ty + r < out_h; r++) {
+                    for (size_t c = 0; c < 2u && tx + c < out_w; c++) {
+                        /* 4·Y is exact, so the shift loses nothing */
+                        const int64_t acc = acc0 + (y[r][c] >> 2);
+
+                        out->data[fx_tensor_index(out, o, ty + r, tx + c)] =
+                            (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+                    }
+                }
+            }
+        }
+    }
+}
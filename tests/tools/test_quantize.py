@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""
+Verification of tools/quantize.py exports that C code relies on (SRS-009.7).
+
+Run directly or through CTest (test_quantize_tool). Requires numpy, which
+quantize.py imports; without it every test is skipped.
+
+Author: William Murray
+Copyright (c) 2026 The Murray Family Innovation Trust
+License: GPL-3.0 or Commercial
+"""
+
+import sys
+import tempfile
+import unittest
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parents[2] / "tools"))
+
+try:
+    import numpy as np
+    import quantize
+except ImportError:
+    np = None
+    quantize = None
+
+
+@unittest.skipIf(quantize is None, "numpy not installed")
+class TestL1MaxExport(unittest.TestCase):
+    """fx_qweights_t.l1_max is uint32_t and must never be truncated."""
+
+    def test_l1_max_is_largest_row_norm(self):
+        values = [1, -2, 3,
+                  -7, 0, 1]
+        self.assertEqual(quantize.export_l1_max(values, 2, 3, "t"), 8)
+
+    def test_l1_max_at_uint32_limit_is_kept(self):
+        # 131073 * 32767 = 4294909951 <= 2^32 - 1
+        values = [32767] * 131073
+        cols = len(values)
+        expected = sum(values)
+        self.assertLessEqual(expected, quantize.UINT32_MAX)
+        self.assertEqual(quantize.export_l1_max(values, 1, cols, "t"), expected)
+
+    def test_l1_max_above_uint32_exports_unknown(self):
+        # int16 row with K = 140000: sum |q| ~ 4.6e9 > 2^32 - 1
+        values = [-32768] * 140000
+        self.assertGreater(sum(abs(v) for v in values), quantize.UINT32_MAX)
+        self.assertEqual(quantize.export_l1_max(values, 1, 140000, "t"), 0)
+
+    @unittest.skipIf(np is None or not hasattr(np, "full"), "numpy not installed")
+    def test_header_never_emits_truncated_l1_max(self):
+        weights = np.full((1, 140000), 0.99)
+        with tempfile.TemporaryDirectory() as tmp:
+            out = Path(tmp) / "deep_qweights.h"
+            stats = quantize.export_quantized_header("deep", weights, None, out,
+                                                     16, False, act_range=4.0)
+            text = out.read_text()
+        self.assertEqual(stats["l1_max"], 0)
+        self.assertIn("#define DEEP_L1_MAX 0u", text)
+        self.assertNotIn("ACC_BOUND", text)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -16,9 +16,11 @@
 
 #include "activations.h"
 #include "matrix.h"
+#include "cpu_dispatch.h"
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
+#include <math.h>
 
 /**
  * @brief Test ReLU correctness.
@@ -252,6 +254,389 @@ void test_dense_layer_forward(void) {
     printf("✓\n");
 }
 
+/**
+ * @brief Test ReLU6 and clamp correctness.
+ * @traceability SRS-004.10
+ */
+void test_relu6_clamp(void) {
+    printf("Testing ReLU6 and clamp correctness... ");
+
+    fixed_t buf[6];
+    fx_matrix_t mat;
+    fx_matrix_init(&mat, buf, 2, 3);
+
+    const int32_t values[6] = {-7, -1, 0, 3, 6, 9};
+    for (int i = 0; i < 6; i++) {
+        mat.data[i] = fixed_from_int(values[i]);
+    }
+    fx_relu6(&mat);
+    assert(mat.data[0] == FIXED_ZERO && mat.data[1] == FIXED_ZERO);
+    assert(mat.data[2] == FIXED_ZERO);
+    assert(fixed_to_int(mat.data[3]) == 3);
+    assert(mat.data[4] == FX_RELU6_MAX && mat.data[5] == FX_RELU6_MAX);
+
+    for (int i = 0; i < 6; i++) {
+        mat.data[i] = fixed_from_int(values[i]);
+    }
+    fx_clamp(&mat, fixed_from_int(-2), fixed_from_int(4));
+    assert(fixed_to_int(mat.data[0]) == -2 && fixed_to_int(mat.data[1]) == -1);
+    assert(fixed_to_int(mat.data[3]) == 3 && fixed_to_int(mat.data[5]) == 4);
+
+    /* Inverted bounds are rejected */
+    fx_clamp(&mat, fixed_from_int(1), fixed_from_int(0));
+    assert(fixed_to_int(mat.data[0]) == -2);
+
+    printf("✓\n");
+}
+
+#define ACT_LEN 1003
+
+static fixed_t act_src[ACT_LEN];
+static fixed_t act_ref[ACT_LEN];
+static fixed_t act_out[ACT_LEN];
+
+/**
+ * @brief Test branch-free kernels against the per-element definitions on every ISA level.
+ * @traceability SRS-004.2, SRS-004.4, SRS-004.10
+ */
+void test_branchless_kernels(void) {
+    printf("Testing branch-free activation kernels on all levels...\n");
+
+    static const fx_isa_t levels[] = {FX_ISA_SCALAR, FX_ISA_SSE41, FX_ISA_AVX2};
+    static const fixed_t alphas[] = {FIXED_ONE / 100, FIXED_ONE / 3, -FIXED_ONE / 2, 1 << 22};
+    uint32_t state = 99u;
+
+    /* Full int32 range, extremes included; odd length exercises tails */
+    for (size_t i = 0; i < ACT_LEN; i++) {
+        state = state * 1664525u + 1013904223u;
+        act_src[i] = (fixed_t)state;
+    }
+    act_src[0] = FIXED_MIN;
+    act_src[1] = FIXED_MAX;
+    act_src[2] = -1;
+
+    fx_matrix_t mat;
+    fx_matrix_attach(&mat, act_out, 1, ACT_LEN);
+
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        if (fx_dispatch_force(levels[l]) != levels[l]) {
+            printf("  - %s not available on this CPU, skipped\n", fx_isa_name(levels[l]));
+            continue;
+        }
+
+        /* ReLU */
+        for (size_t i = 0; i < ACT_LEN; i++) {
+            act_ref[i] = (act_src[i] < 0) ? FIXED_ZERO : act_src[i];
+        }
+        memcpy(act_out, act_src, sizeof(act_src));
+        fx_relu(&mat);
+        assert(memcmp(act_ref, act_out, sizeof(act_ref)) == 0);
+
+        /* ReLU6 */
+        for (size_t i = 0; i < ACT_LEN; i++) {
+            act_ref[i] = (act_src[i] < 0) ? FIXED_ZERO
+                       : (act_src[i] > FX_RELU6_MAX) ? FX_RELU6_MAX : act_src[i];
+        }
+        memcpy(act_out, act_src, sizeof(act_src));
+        fx_relu6(&mat);
+        assert(memcmp(act_ref, act_out, sizeof(act_ref)) == 0);
+
+        /* Leaky ReLU: identical to fixed_mul(), wrap included */
+        for (size_t a = 0; a < sizeof(alphas) / sizeof(alphas[0]); a++) {
+            for (size_t i = 0; i < ACT_LEN; i++) {
+                act_ref[i] = (act_src[i] < 0) ? fixed_mul(act_src[i], alphas[a]) : act_src[i];
+            }
+            memcpy(act_out, act_src, sizeof(act_src));
+            fx_leaky_relu(&mat, alphas[a]);
+            assert(memcmp(act_ref, act_out, sizeof(act_ref)) == 0);
+        }
+
+        /* Clamp through the fused-layer entry point */
+        const fx_activation_t clamp = {FX_ACT_CLAMP, 0, -FIXED_ONE, 2 * FIXED_ONE};
+        for (size_t i = 0; i < ACT_LEN; i++) {
+            act_ref[i] = (act_src[i] < clamp.lo) ? clamp.lo
+                       : (act_src[i] > clamp.hi) ? clamp.hi : act_src[i];
+        }
+        memcpy(act_out, act_src, sizeof(act_src));
+        fx_activation_apply(&clamp, act_out, ACT_LEN);
+        assert(memcmp(act_ref, act_out, sizeof(act_ref)) == 0);
+
+        printf("  ✓ %s\n", fx_isa_name(levels[l]));
+    }
+
+    fx_dispatch_force(FX_ISA_AVX2);
+}
+
+/**
+ * @brief Test sigmoid/tanh/exp error bounds against libm over every Q16.16 value in [-24, 24].
+ * @traceability SRS-004.11
+ */
+void test_lut_error_bounds(void) {
+    printf("Testing table-driven sigmoid/tanh/exp error bounds... ");
+
+    double max_sig = 0.0;
+    double max_tanh = 0.0;
+    double max_exp_excess = 0.0;
+
+    for (int32_t x = -24 * FIXED_ONE; x <= 24 * FIXED_ONE; x++) {
+        const double d = (double)x / FIXED_ONE;
+        const double sig = fabs((double)fixed_sigmoid(x) - FIXED_ONE / (1.0 + exp(-d)));
+        const double th = fabs((double)fixed_tanh(x) - FIXED_ONE * tanh(d));
+
+        max_sig = (sig > max_sig) ? sig : max_sig;
+        max_tanh = (th > max_tanh) ? th : max_tanh;
+
+        /* e^x must fit: ln(32768) ~= 10.397 */
+        if (x < 10 * FIXED_ONE) {
+            const double ref = FIXED_ONE * exp(d);
+            const double err = fabs((double)fixed_exp(x) - ref);
+            const double excess = (err - 0.5) / ref;
+
+            max_exp_excess = (excess > max_exp_excess) ? excess : max_exp_excess;
+            if (x <= 0) {
+                assert(err <= 1.0);
+            }
+        }
+    }
+
+    assert(max_sig <= 1.0);
+    assert(max_tanh <= 1.0);
+    assert(max_exp_excess <= 1.0 / (1 << 23));
+
+    printf("✓ (sigmoid %.2f, tanh %.2f LSB)\n", max_sig, max_tanh);
+}
+
+/**
+ * @brief Test symmetry, saturation, golden values and the matrix/fused entry points.
+ * @traceability SRS-004.11
+ */
+void test_lut_properties(void) {
+    printf("Testing table-driven sigmoid/tanh/exp properties... ");
+
+    /* Golden values: identical on every platform */
+    assert(fixed_sigmoid(FIXED_ONE) == 47911);
+    assert(fixed_tanh(FIXED_ONE / 2) == 30285);
+    assert(fixed_exp(-FIXED_ONE) == 24109);
+    assert(fixed_exp(FIXED_ONE) == 178145);
+    assert(fixed_exp(10 * FIXED_ONE) == 1443526516);
+    assert(fixed_exp(0) == FIXED_ONE);
+    assert(fixed_sigmoid(0) == FIXED_ONE / 2);
+    assert(fixed_tanh(0) == 0);
+
+    /* Exact symmetry and monotonicity */
+    fixed_t prev_sig = fixed_sigmoid(-20 * FIXED_ONE);
+    fixed_t prev_tanh = fixed_tanh(-20 * FIXED_ONE);
+    for (int32_t x = -20 * FIXED_ONE; x <= 20 * FIXED_ONE; x += 13) {
+        assert(fixed_sigmoid(-x) == FIXED_ONE - fixed_sigmoid(x));
+        assert(fixed_tanh(-x) == -fixed_tanh(x));
+        assert(fixed_sigmoid(x) >= prev_sig && fixed_tanh(x) >= prev_tanh);
+        prev_sig = fixed_sigmoid(x);
+        prev_tanh = fixed_tanh(x);
+    }
+
+    /* Saturation at the ends of the range */
+    assert(fixed_sigmoid(FIXED_MAX) == FIXED_ONE && fixed_sigmoid(FIXED_MIN) == 0);
+    assert(fixed_tanh(FIXED_MAX) == FIXED_ONE && fixed_tanh(FIXED_MIN) == -FIXED_ONE);
+    assert(fixed_exp(FIXED_MAX) == FIXED_MAX && fixed_exp(11 * FIXED_ONE) == FIXED_MAX);
+    assert(fixed_exp(FIXED_MIN) == 0 && fixed_exp(-12 * FIXED_ONE) == 0);
+
+    /* Matrix and fused entry points match the scalar functions */
+    fixed_t buf[7];
+    fixed_t vals[7];
+    fx_matrix_t mat;
+    fx_matrix_init(&mat, buf, 1, 7);
+    for (int i = 0; i < 7; i++) {
+        vals[i] = (i - 3) * 40000;
+    }
+
+    memcpy(buf, vals, sizeof(buf));
+    fx_sigmoid(&mat);
+    for (int i = 0; i < 7; i++) {
+        assert(buf[i] == fixed_sigmoid(vals[i]));
+    }
+
+    memcpy(buf, vals, sizeof(buf));
+    fx_tanh(&mat);
+    for (int i = 0; i < 7; i++) {
+        assert(buf[i] == fixed_tanh(vals[i]));
+    }
+
+    memcpy(buf, vals, sizeof(buf));
+    fx_exp(&mat);
+    for (int i = 0; i < 7; i++) {
+        assert(buf[i] == fixed_exp(vals[i]));
+    }
+
+    const fx_activation_t act = {FX_ACT_SIGMOID, 0, 0, 0};
+    memcpy(buf, vals, sizeof(buf));
+    fx_activation_apply(&act, buf, 7);
+    for (int i = 0; i < 7; i++) {
+        assert(buf[i] == fixed_sigmoid(vals[i]));
+    }
+
+    printf("✓\n");
+}
+
+#define SM_ROWS 64
+#define SM_COLS 100
+
+static fixed_t sm_logits[SM_ROWS * SM_COLS];
+static fixed_t sm_prob[SM_ROWS * SM_COLS];
+static fixed_t sm_logp[SM_ROWS * SM_COLS];
+
+/**
+ * @brief Test softmax and log-softmax against a double reference, row sums and shift invariance.
+ * @traceability SRS-004.6
+ */
+void test_softmax(void) {
+    printf("Testing row-wise softmax / log-softmax... ");
+
+    uint32_t state = 7u;
+    fx_matrix_t prob, logp;
+    fx_matrix_attach(&prob, sm_prob, SM_ROWS, SM_COLS);
+    fx_matrix_attach(&logp, sm_logp, SM_ROWS, SM_COLS);
+
+    /* Logit spread grows with the row index, from ~0.004 to ~16000 */
+    for (uint32_t r = 0; r < SM_ROWS; r++) {
+        for (uint32_t c = 0; c < SM_COLS; c++) {
+            state = state * 1664525u + 1013904223u;
+            sm_logits[r * SM_COLS + c] = (fixed_t)((int32_t)state >> (31 - r / 4));
+        }
+    }
+    sm_logits[SM_COLS - 1] = FIXED_MAX;     /* Extremes in one row */
+    sm_logits[SM_COLS - 2] = FIXED_MIN;
+
+    memcpy(sm_prob, sm_logits, sizeof(sm_logits));
+    memcpy(sm_logp, sm_logits, sizeof(sm_logits));
+    fx_softmax(&prob);
+    fx_log_softmax(&logp);
+
+    for (uint32_t r = 0; r < SM_ROWS; r++) {
+        const fixed_t* x = &sm_logits[r * SM_COLS];
+        double m = x[0];
+        double sum = 0.0;
+        int64_t row_sum = 0;
+
+        for (uint32_t c = 1; c < SM_COLS; c++) {
+            m = (x[c] > m) ? x[c] : m;
+        }
+        for (uint32_t c = 0; c < SM_COLS; c++) {
+            sum += exp((x[c] - m) / FIXED_ONE);
+        }
+
+        for (uint32_t c = 0; c < SM_COLS; c++) {
+            const double ref_p = FIXED_ONE * exp((x[c] - m) / FIXED_ONE) / sum;
+            const double ref_l = (x[c] - m) - FIXED_ONE * log(sum);
+            const fixed_t p = sm_prob[r * SM_COLS + c];
+
+            assert(p >= 0 && p <= FIXED_ONE);
+            assert(fabs(p - ref_p) <= 1.0);
+            if (ref_l > (double)FIXED_MIN) {
+                assert(fabs(sm_logp[r * SM_COLS + c] - ref_l) <= 1.0);
+            } else {
+                assert(sm_logp[r * SM_COLS + c] == FIXED_MIN);
+            }
+            row_sum += p;
+        }
+        assert(row_sum >= FIXED_ONE - SM_COLS && row_sum <= FIXED_ONE + SM_COLS);
+    }
+
+    /* Adding a constant to a row leaves the output bit-identical */
+    fixed_t row[SM_COLS];
+    fx_matrix_t one_row;
+    fx_matrix_attach(&one_row, row, 1, SM_COLS);
+    for (uint32_t c = 0; c < SM_COLS; c++) {
+        row[c] = sm_logits[20 * SM_COLS + c] + 3 * FIXED_ONE;
+    }
+    fx_softmax(&one_row);
+    assert(memcmp(row, &sm_prob[20 * SM_COLS], sizeof(row)) == 0);
+
+    /* Single class: certainty */
+    fixed_t single = fixed_from_int(-1234);
+    fx_matrix_t single_mat;
+    fx_matrix_attach(&single_mat, &single, 1, 1);
+    fx_softmax(&single_mat);
+    assert(single == FIXED_ONE);
+    fx_log_softmax(&single_mat);
+    assert(single == 0);
+
+    printf("✓\n");
+}
+
+/** @brief Custom element function for the generic-callback path */
+static fixed_t halve(fixed_t x) {
+    return x / 2;
+}
+
+/**
+ * @brief Test the enum-driven matrix activation against the dedicated functions.
+ * @traceability SRS-004.12
+ */
+void test_matrix_apply_activation(void) {
+    printf("Testing enum-driven fx_matrix_apply_activation... ");
+
+    fixed_t src[37];
+    fixed_t got[37];
+    fixed_t ref[37];
+    fx_matrix_t got_mat, ref_mat;
+    fx_matrix_attach(&got_mat, got, 1, 37);
+    fx_matrix_attach(&ref_mat, ref, 1, 37);
+
+    for (int i = 0; i < 37; i++) {
+        src[i] = (i - 18) * 23456;
+    }
+
+    const fx_activation_t acts[] = {
+        {FX_ACT_IDENTITY, 0, 0, 0},
+        {FX_ACT_RELU, 0, 0, 0},
+        {FX_ACT_LEAKY_RELU, FIXED_ONE / 10, 0, 0},
+        {FX_ACT_RELU6, 0, 0, 0},
+        {FX_ACT_CLAMP, 0, -FIXED_ONE, FIXED_ONE},
+        {FX_ACT_SIGMOID, 0, 0, 0},
+        {FX_ACT_TANH, 0, 0, 0},
+        {FX_ACT_EXP, 0, 0, 0}
+    };
+
+    for (size_t a = 0; a < sizeof(acts) / sizeof(acts[0]); a++) {
+        memcpy(got, src, sizeof(src));
+        memcpy(ref, src, sizeof(src));
+        fx_matrix_apply_activation(&got_mat, &acts[a]);
+
+        switch (acts[a].kind) {
+            case FX_ACT_RELU:       fx_relu(&ref_mat); break;
+            case FX_ACT_LEAKY_RELU: fx_leaky_relu(&ref_mat, acts[a].alpha); break;
+            case FX_ACT_RELU6:      fx_relu6(&ref_mat); break;
+            case FX_ACT_CLAMP:      fx_clamp(&ref_mat, acts[a].lo, acts[a].hi); break;
+            case FX_ACT_SIGMOID:    fx_sigmoid(&ref_mat); break;
+            case FX_ACT_TANH:       fx_tanh(&ref_mat); break;
+            case FX_ACT_EXP:        fx_exp(&ref_mat); break;
+            case FX_ACT_IDENTITY:
+            default:                break;
+        }
+        assert(memcmp(got, ref, sizeof(got)) == 0);
+    }
+
+    /* NULL activation is identity */
+    memcpy(got, src, sizeof(src));
+    fx_matrix_apply_activation(&got_mat, NULL);
+    assert(memcmp(got, src, sizeof(got)) == 0);
+
+    /* The generic callback still works for library and custom functions */
+    memcpy(got, src, sizeof(src));
+    memcpy(ref, src, sizeof(src));
+    fx_matrix_apply(&got_mat, fixed_tanh);
+    fx_tanh(&ref_mat);
+    assert(memcmp(got, ref, sizeof(got)) == 0);
+
+    memcpy(got, src, sizeof(src));
+    fx_matrix_apply(&got_mat, halve);
+    for (int i = 0; i < 37; i++) {
+        assert(got[i] == src[i] / 2);
+    }
+
+    printf("✓\n");
+}
+
 int main(void) {
     printf("═══════════════════════════════════════════════\n");
     printf("SRS-004 Activation Functions Verification Suite\n");
@@ -260,6 +645,12 @@ int main(void) {
     test_relu_correctness();
     test_relu_in_place();
     test_leaky_relu();
+    test_relu6_clamp();
+    test_branchless_kernels();
+    test_lut_error_bounds();
+    test_lut_properties();
+    test_softmax();
+    test_matrix_apply_activation();
     test_bias_addition();
     test_bias_dimension_validation();
     test_dense_layer_forward();
@@ -272,6 +663,10 @@ int main(void) {
     printf("  • SRS-004.2: ReLU determinism ✓\n");
     printf("  • SRS-004.3: Bias vector addition ✓\n");
     printf("  • SRS-004.4: Bounded fixed-point arithmetic ✓\n");
+    printf("  • SRS-004.6: Row-wise softmax / log-softmax ✓\n");
+    printf("  • SRS-004.10: Branch-free ReLU / leaky / ReLU6 / clamp ✓\n");
+    printf("  • SRS-004.11: Table-driven sigmoid / tanh / exp ✓\n");
+    printf("  • SRS-004.12: Enum-driven matrix activation ✓\n");
     printf("\nVerification criteria met:\n");
     printf("  • V-004.1: ReLU correctness verified ✓\n");
     printf("  • V-004.2: In-place operation confirmed ✓\n");
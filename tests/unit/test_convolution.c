@@ -18,8 +18,10 @@
  */
 
 #include "convolution.h"
+#include "pooling.h"
 #include "fixed_point.h"
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 
 /* Test counter */
@@ -318,6 +320,963 @@ static void test_zero_kernel(void) {
     TEST_ASSERT(all_zero, "Zero kernel produces zero output");
 }
 
+/* ------------------------------------------------------------------------
+ * Multi-channel tensor convolution (SRS-006.8)
+ * ------------------------------------------------------------------------ */
+
+#define MC_CIN 3
+#define MC_COUT 4
+#define MC_H 9
+#define MC_W 70
+#define MC_KH 3
+#define MC_KW 2
+#define MC_OH (MC_H - MC_KH + 1)
+#define MC_OW (MC_W - MC_KW + 1)
+
+static fixed_t mc_in_nchw[MC_CIN * MC_H * MC_W];
+static fixed_t mc_in_nhwc[MC_CIN * MC_H * MC_W];
+static fixed_t mc_w_oihw[MC_COUT * MC_CIN * MC_KH * MC_KW];
+static fixed_t mc_w_ohwi[MC_COUT * MC_CIN * MC_KH * MC_KW];
+static fixed_t mc_bias[MC_COUT];
+static fixed_t mc_ref[MC_COUT * MC_OH * MC_OW];
+static fixed_t mc_out_nchw[MC_COUT * MC_OH * MC_OW];
+static fixed_t mc_out_nhwc[MC_COUT * MC_OH * MC_OW];
+
+static uint32_t mc_rng = 2024u;
+
+static fixed_t mc_rand(void) {
+    mc_rng = mc_rng * 1664525u + 1013904223u;
+    return (fixed_t)((int32_t)mc_rng >> 10);   /* ±32.0 */
+}
+
+/**
+ * @brief Fill NCHW/OIHW operands and their NHWC/OHWI copies.
+ */
+static void mc_fill(fx_tensor_t* in_c, fx_tensor_t* in_l,
+                    fx_conv_filter_t* f_c, fx_conv_filter_t* f_l) {
+    fx_tensor_attach(in_c, mc_in_nchw, MC_CIN, MC_H, MC_W, FX_LAYOUT_NCHW);
+    fx_tensor_attach(in_l, mc_in_nhwc, MC_CIN, MC_H, MC_W, FX_LAYOUT_NHWC);
+
+    *f_c = (fx_conv_filter_t){mc_w_oihw, MC_COUT, MC_CIN, MC_KH, MC_KW, FX_LAYOUT_NCHW};
+    *f_l = (fx_conv_filter_t){mc_w_ohwi, MC_COUT, MC_CIN, MC_KH, MC_KW, FX_LAYOUT_NHWC};
+
+    for (size_t c = 0; c < MC_CIN; c++) {
+        for (size_t y = 0; y < MC_H; y++) {
+            for (size_t x = 0; x < MC_W; x++) {
+                fixed_t v = mc_rand();
+                in_c->data[fx_tensor_index(in_c, c, y, x)] = v;
+                in_l->data[fx_tensor_index(in_l, c, y, x)] = v;
+            }
+        }
+    }
+
+    for (size_t o = 0; o < MC_COUT; o++) {
+        mc_bias[o] = mc_rand();
+        for (size_t i = 0; i < MC_CIN; i++) {
+            for (size_t ky = 0; ky < MC_KH; ky++) {
+                for (size_t kx = 0; kx < MC_KW; kx++) {
+                    fixed_t v = mc_rand();
+                    f_c->data[fx_filter_index(f_c, o, i, ky, kx)] = v;
+                    f_l->data[fx_filter_index(f_l, o, i, ky, kx)] = v;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @test Multi-channel result equals a single-rounding reference in both layouts
+ * @traceability SRS-006.3, SRS-006.4, SRS-006.8
+ */
+static void test_multichannel_layouts(void) {
+    printf("\nTest: Multi-Channel Convolution (3→4 channels, NCHW/NHWC)\n");
+    printf("──────────────────────────────────────────────────────────\n");
+
+    fx_tensor_t in_c, in_l, out_c, out_l;
+    fx_conv_filter_t f_c, f_l;
+    fx_matrix_t bias;
+
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+    fx_matrix_attach(&bias, mc_bias, 1, MC_COUT);
+
+    /* Reference: one int64_t sum per output, rounded once */
+    for (size_t o = 0; o < MC_COUT; o++) {
+        for (size_t y = 0; y < MC_OH; y++) {
+            for (size_t x = 0; x < MC_OW; x++) {
+                int64_t acc = (int64_t)mc_bias[o] * FIXED_ONE;
+                for (size_t i = 0; i < MC_CIN; i++) {
+                    for (size_t ky = 0; ky < MC_KH; ky++) {
+                        for (size_t kx = 0; kx < MC_KW; kx++) {
+                            acc += (int64_t)in_c.data[fx_tensor_index(&in_c, i, y + ky, x + kx)] *
+                                   f_c.data[fx_filter_index(&f_c, o, i, ky, kx)];
+                        }
+                    }
+                }
+                mc_ref[(o * MC_OH + y) * MC_OW + x] = (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+            }
+        }
+    }
+
+    fx_tensor_init(&out_c, mc_out_nchw, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_l, mc_out_nhwc, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NHWC);
+
+    fx_conv2d_tensor(&in_c, &f_c, &bias, &out_c);
+    fx_conv2d_tensor(&in_l, &f_l, &bias, &out_l);
+
+    TEST_ASSERT(memcmp(mc_ref, mc_out_nchw, sizeof(mc_ref)) == 0,
+                "NCHW matches single-rounding reference");
+
+    int layouts_match = 1;
+    for (size_t o = 0; o < MC_COUT; o++) {
+        for (size_t y = 0; y < MC_OH; y++) {
+            for (size_t x = 0; x < MC_OW; x++) {
+                if (out_l.data[fx_tensor_index(&out_l, o, y, x)] !=
+                    out_c.data[fx_tensor_index(&out_c, o, y, x)]) {
+                    layouts_match = 0;
+                }
+            }
+        }
+    }
+    TEST_ASSERT(layouts_match, "NHWC bit-identical to NCHW");
+}
+
+/**
+ * @test Single channel tensor convolution equals fx_conv2d
+ * @traceability SRS-006.8
+ */
+static void test_multichannel_single_plane(void) {
+    printf("\nTest: Single-Channel Tensor Convolution vs fx_conv2d\n");
+    printf("────────────────────────────────────────────────────\n");
+
+    fixed_t in_data[36], k_data[9], ref_data[16], out_data[16];
+    fx_matrix_t in, kernel, ref;
+    fx_tensor_t in_t, out_t;
+
+    fx_matrix_init(&in, in_data, 6, 6);
+    fx_matrix_init(&kernel, k_data, 3, 3);
+    fx_matrix_init(&ref, ref_data, 4, 4);
+    for (int i = 0; i < 36; i++) {
+        in.data[i] = mc_rand();
+    }
+    for (int i = 0; i < 9; i++) {
+        kernel.data[i] = mc_rand();
+    }
+
+    fx_conv2d(&in, &kernel, &ref);
+
+    const fx_conv_filter_t f = {k_data, 1, 1, 3, 3, FX_LAYOUT_NCHW};
+    fx_tensor_attach(&in_t, in_data, 1, 6, 6, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_t, out_data, 1, 4, 4, FX_LAYOUT_NCHW);
+    fx_conv2d_tensor(&in_t, &f, NULL, &out_t);
+
+    TEST_ASSERT(memcmp(ref_data, out_data, sizeof(ref_data)) == 0,
+                "1×1-channel result equals fx_conv2d");
+}
+
+/**
+ * @test Mismatched layouts and shapes leave output untouched
+ * @traceability SRS-006.1, SRS-006.8
+ */
+static void test_multichannel_invalid(void) {
+    printf("\nTest: Multi-Channel Shape Validation\n");
+    printf("────────────────────────────────────\n");
+
+    fx_tensor_t in_c, in_l, out;
+    fx_conv_filter_t f_c, f_l;
+
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+    fx_tensor_attach(&out, mc_out_nchw, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NCHW);
+    for (size_t i = 0; i < fx_tensor_size(&out); i++) {
+        out.data[i] = fixed_from_int(999);
+    }
+
+    fx_conv2d_tensor(&in_c, &f_l, NULL, &out);          /* Layout mismatch */
+    fx_tensor_attach(&out, mc_out_nchw, MC_COUT, MC_OH, MC_OW - 1, FX_LAYOUT_NCHW);
+    fx_conv2d_tensor(&in_c, &f_c, NULL, &out);          /* Wrong width */
+    fx_tensor_attach(&out, mc_out_nchw, MC_COUT - 1, MC_OH, MC_OW, FX_LAYOUT_NCHW);
+    fx_conv2d_tensor(&in_c, &f_c, NULL, &out);          /* Wrong C_out */
+
+    int untouched = 1;
+    for (size_t i = 0; i < (size_t)MC_COUT * MC_OH * MC_OW; i++) {
+        if (mc_out_nchw[i] != fixed_from_int(999)) {
+            untouched = 0;
+        }
+    }
+    TEST_ASSERT(untouched, "Invalid shapes leave output unchanged");
+}
+
+/* Sub-tensor 8×69 → conv 6×68 (crosses one NCHW tile) → pooled 3×34 */
+#define FP_H 8
+#define FP_W 69
+#define FP_PH ((FP_H - MC_KH + 1) / 2)
+#define FP_PW ((FP_W - MC_KW + 1) / 2)
+
+/**
+ * @brief Reference: max-pool every channel of conv into pooled via fx_maxpool_2x2.
+ */
+static void fp_reference_pool(const fx_tensor_t* conv, fx_tensor_t* pooled) {
+    fixed_t plane[2 * FP_PH * 2 * FP_PW];
+    fixed_t half[FP_PH * FP_PW];
+    fx_matrix_t p_in, p_out;
+
+    fx_matrix_attach(&p_in, plane, conv->rows, conv->cols);
+    fx_matrix_attach(&p_out, half, pooled->rows, pooled->cols);
+
+    for (size_t c = 0; c < conv->channels; c++) {
+        for (size_t y = 0; y < conv->rows; y++) {
+            for (size_t x = 0; x < conv->cols; x++) {
+                plane[y * conv->cols + x] = conv->data[fx_tensor_index(conv, c, y, x)];
+            }
+        }
+        fx_maxpool_2x2(&p_in, &p_out);
+        for (size_t y = 0; y < pooled->rows; y++) {
+            for (size_t x = 0; x < pooled->cols; x++) {
+                pooled->data[fx_tensor_index(pooled, c, y, x)] = half[y * pooled->cols + x];
+            }
+        }
+    }
+}
+
+/**
+ * @test Fused conv → bias → activation → max-pool equals the unfused sequence
+ * @traceability SRS-006.18, SRS-008.1
+ */
+static void test_conv_act_maxpool(void) {
+    printf("\nTest: Fused Conv → Bias → Activation → 2×2 MaxPool\n");
+    printf("──────────────────────────────────────────────────\n");
+
+    static fixed_t fp_ref[MC_COUT * FP_PH * FP_PW];
+    static fixed_t fp_out[MC_COUT * FP_PH * FP_PW];
+    const fx_activation_t relu = {FX_ACT_RELU, 0, 0, 0};
+    const fx_activation_t leaky = {FX_ACT_LEAKY_RELU, FIXED_ONE / 10, 0, 0};
+    const fx_activation_t* acts[3] = {&relu, &leaky, NULL};
+
+    fx_tensor_t in_c, in_l, conv, ref, out;
+    fx_conv_filter_t f_c, f_l;
+    fx_matrix_t bias;
+    int all_match = 1;
+
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+    fx_matrix_attach(&bias, mc_bias, 1, MC_COUT);
+
+    for (size_t l = 0; l < 2; l++) {
+        const fx_conv_filter_t* f = (l == 0) ? &f_c : &f_l;
+        fx_tensor_t in;
+
+        fx_tensor_attach(&in, (l == 0) ? mc_in_nchw : mc_in_nhwc, MC_CIN, FP_H, FP_W, f->layout);
+
+        for (size_t a = 0; a < 3; a++) {
+            fx_tensor_init(&conv, mc_ref, MC_COUT, 2 * FP_PH, 2 * FP_PW, f->layout);
+            fx_tensor_init(&ref, fp_ref, MC_COUT, FP_PH, FP_PW, f->layout);
+            fx_tensor_init(&out, fp_out, MC_COUT, FP_PH, FP_PW, f->layout);
+
+            fx_conv2d_tensor(&in, f, &bias, &conv);
+            fx_activation_apply(acts[a], conv.data, fx_tensor_size(&conv));
+            fp_reference_pool(&conv, &ref);
+
+            fx_conv2d_act_maxpool(&in, f, &bias, acts[a], &out);
+            if (memcmp(fp_ref, fp_out, sizeof(fp_ref)) != 0) {
+                all_match = 0;
+            }
+        }
+    }
+    TEST_ASSERT(all_match, "ReLU / leaky / identity bit-identical to unfused (NCHW, NHWC)");
+
+    /* Odd conv output and non-monotone activation are rejected */
+    const fx_activation_t bad = {FX_ACT_LEAKY_RELU, -FIXED_ONE, 0, 0};
+    fx_tensor_t in;
+    fx_tensor_attach(&in, mc_in_nchw, MC_CIN, FP_H, FP_W, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&out, fp_out, MC_COUT, FP_PH, FP_PW, FX_LAYOUT_NCHW);
+    fp_out[0] = fixed_from_int(999);
+    fx_conv2d_act_maxpool(&in, &f_c, &bias, &bad, &out);
+    fx_tensor_attach(&in, mc_in_nchw, MC_CIN, FP_H + 1, FP_W, FX_LAYOUT_NCHW);
+    fx_conv2d_act_maxpool(&in, &f_c, &bias, &relu, &out);
+    TEST_ASSERT(fp_out[0] == fixed_from_int(999), "Odd conv size / negative slope rejected");
+}
+
+static fixed_t mc_col[FX_IM2COL_SCRATCH_LEN(MC_CIN, MC_KH, MC_KW, MC_OH, MC_OW)];
+static fixed_t mc_out_col[MC_COUT * MC_OH * MC_OW];
+
+/**
+ * @test im2col + GEMM is bit-identical to the direct tensor convolution
+ * @traceability SRS-006.11
+ */
+static void test_im2col_matches_direct(void) {
+    printf("\nTest: im2col + GEMM vs Direct Convolution\n");
+    printf("─────────────────────────────────────────\n");
+
+    fx_tensor_t in_c, in_l, out_d, out_g;
+    fx_conv_filter_t f_c, f_l;
+    fx_matrix_t bias;
+    const size_t col_len = sizeof(mc_col) / sizeof(mc_col[0]);
+
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+    fx_matrix_attach(&bias, mc_bias, 1, MC_COUT);
+
+    fx_tensor_init(&out_d, mc_out_nchw, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_g, mc_out_col, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NCHW);
+    fx_conv2d_tensor(&in_c, &f_c, &bias, &out_d);
+    fx_conv2d_im2col(&in_c, &f_c, &bias, &out_g, mc_col, col_len);
+    TEST_ASSERT(memcmp(mc_out_nchw, mc_out_col, sizeof(mc_out_col)) == 0,
+                "NCHW im2col bit-identical to direct");
+
+    fx_tensor_init(&out_d, mc_out_nhwc, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NHWC);
+    fx_tensor_init(&out_g, mc_out_col, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NHWC);
+    fx_conv2d_tensor(&in_l, &f_l, NULL, &out_d);
+    fx_conv2d_im2col(&in_l, &f_l, NULL, &out_g, mc_col, col_len);
+    TEST_ASSERT(memcmp(mc_out_nhwc, mc_out_col, sizeof(mc_out_col)) == 0,
+                "NHWC im2col bit-identical to direct");
+
+    /* Single plane against the original fx_conv2d */
+    fixed_t ref_data[MC_OH * MC_OW];
+    fx_matrix_t plane, kernel, ref;
+    fx_matrix_attach(&plane, mc_in_nchw, MC_H, MC_W);
+    fx_matrix_attach(&kernel, mc_w_oihw, MC_KH, MC_KW);
+    fx_matrix_init(&ref, ref_data, MC_OH, MC_OW);
+    fx_conv2d(&plane, &kernel, &ref);
+
+    const fx_conv_filter_t f1 = {mc_w_oihw, 1, 1, MC_KH, MC_KW, FX_LAYOUT_NCHW};
+    fx_tensor_attach(&in_c, mc_in_nchw, 1, MC_H, MC_W, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_g, mc_out_col, 1, MC_OH, MC_OW, FX_LAYOUT_NCHW);
+    fx_conv2d_im2col(&in_c, &f1, NULL, &out_g, mc_col, col_len);
+    TEST_ASSERT(memcmp(ref_data, mc_out_col, sizeof(ref_data)) == 0,
+                "Single-plane im2col bit-identical to fx_conv2d");
+
+    /* Undersized scratch: output untouched */
+    out_g.data[0] = fixed_from_int(999);
+    fx_conv2d_im2col(&in_c, &f1, NULL, &out_g, mc_col,
+                     FX_IM2COL_SCRATCH_LEN(1, MC_KH, MC_KW, MC_OH, MC_OW) - 1);
+    TEST_ASSERT(out_g.data[0] == fixed_from_int(999), "Undersized scratch rejected");
+}
+
+static fixed_t mc_packed[FX_PACKED_WEIGHTS_LEN(MC_CIN * MC_KH * MC_KW, MC_COUT)];
+
+/**
+ * @test im2col over a pre-packed filter bank is bit-identical to direct
+ * @traceability SRS-003.13, SRS-006.11
+ */
+static void test_im2col_packed_matches_direct(void) {
+    printf("\nTest: im2col + Pre-Packed Filters vs Direct Convolution\n");
+    printf("───────────────────────────────────────────────────────\n");
+
+    fx_tensor_t in_c, in_l, out_d, out_g;
+    fx_conv_filter_t f_c, f_l;
+    fx_matrix_t bias, bank;
+    fx_packed_weights_t packed;
+    const size_t col_len = sizeof(mc_col) / sizeof(mc_col[0]);
+    const size_t packed_len = sizeof(mc_packed) / sizeof(mc_packed[0]);
+
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+    fx_matrix_attach(&bias, mc_bias, 1, MC_COUT);
+
+    /* OIHW bank viewed as C_out × (C_in·KH·KW), packed once */
+    fx_matrix_attach(&bank, mc_w_oihw, MC_COUT, MC_CIN * MC_KH * MC_KW);
+    fx_pack_weights_transposed(&bank, mc_packed, packed_len, &packed);
+
+    fx_tensor_init(&out_d, mc_out_nchw, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NCHW);
+    fx_tensor_init(&out_g, mc_out_col, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NCHW);
+    fx_conv2d_tensor(&in_c, &f_c, &bias, &out_d);
+    fx_conv2d_im2col_packed(&in_c, &packed, MC_KH, MC_KW, &bias, &out_g, mc_col, col_len);
+    TEST_ASSERT(memcmp(mc_out_nchw, mc_out_col, sizeof(mc_out_col)) == 0,
+                "NCHW packed im2col bit-identical to direct");
+
+    fx_matrix_attach(&bank, mc_w_ohwi, MC_COUT, MC_CIN * MC_KH * MC_KW);
+    fx_pack_weights_transposed(&bank, mc_packed, packed_len, &packed);
+
+    fx_tensor_init(&out_d, mc_out_nhwc, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NHWC);
+    fx_tensor_init(&out_g, mc_out_col, MC_COUT, MC_OH, MC_OW, FX_LAYOUT_NHWC);
+    fx_conv2d_tensor(&in_l, &f_l, &bias, &out_d);
+    fx_conv2d_im2col_packed(&in_l, &packed, MC_KH, MC_KW, &bias, &out_g, mc_col, col_len);
+    TEST_ASSERT(memcmp(mc_out_nhwc, mc_out_col, sizeof(mc_out_col)) == 0,
+                "NHWC packed im2col bit-identical to direct");
+
+    /* Kernel size inconsistent with the packed depth: output untouched */
+    out_g.data[0] = fixed_from_int(999);
+    fx_conv2d_im2col_packed(&in_l, &packed, MC_KH, MC_KW + 1u, &bias, &out_g, mc_col, col_len);
+    TEST_ASSERT(out_g.data[0] == fixed_from_int(999), "Mismatched kernel size rejected");
+
+    fx_conv2d_im2col_packed(&in_l, &packed, MC_KH, MC_KW, &bias, &out_g, mc_col, col_len - 1u);
+    TEST_ASSERT(out_g.data[0] == fixed_from_int(999), "Undersized scratch rejected");
+}
+
+/**
+ * @brief Bounds-checked reference for strided/dilated/padded convolution.
+ */
+static void ex_reference(const fx_tensor_t* in, const fx_conv_filter_t* f,
+                         const fixed_t* bias, const fx_conv_params_t* p,
+                         uint32_t out_h, uint32_t out_w, fixed_t* ref) {
+    for (size_t o = 0; o < f->out_channels; o++) {
+        for (size_t y = 0; y < out_h; y++) {
+            for (size_t x = 0; x < out_w; x++) {
+                int64_t acc = bias ? (int64_t)bias[o] * FIXED_ONE : 0;
+                for (size_t i = 0; i < f->in_channels; i++) {
+                    for (size_t ky = 0; ky < f->rows; ky++) {
+                        for (size_t kx = 0; kx < f->cols; kx++) {
+                            int64_t iy = (int64_t)(y * p->stride_h + ky * p->dilation_h) - p->pad_top;
+                            int64_t ix = (int64_t)(x * p->stride_w + kx * p->dilation_w) - p->pad_left;
+                            if (iy < 0 || ix < 0 || iy >= in->rows || ix >= in->cols) {
+                                continue;
+                            }
+                            acc += (int64_t)in->data[fx_tensor_index(in, i, (size_t)iy, (size_t)ix)] *
+                                   f->data[fx_filter_index(f, o, i, ky, kx)];
+                        }
+                    }
+                }
+                ref[(o * out_h + y) * out_w + x] = (fixed_t)((acc + FIXED_HALF) >> FIXED_SHIFT);
+            }
+        }
+    }
+}
+
+/**
+ * @test Stride, dilation and padding match the bounds-checked reference
+ * @traceability SRS-006.7, SRS-006.9, SRS-006.10
+ */
+static void test_strided_dilated_padded(void) {
+    printf("\nTest: Stride / Dilation / Implicit Padding\n");
+    printf("──────────────────────────────────────────\n");
+
+    static const fx_conv_params_t cases[] = {
+        FX_CONV_PARAMS_VALID,
+        {1, 1, 1, 1, 1, 1, 0, 1},      /* "same" for 3×2 */
+        {2, 2, 1, 1, 0, 0, 0, 0},      /* strided */
+        {1, 1, 2, 3, 0, 0, 0, 0},      /* dilated */
+        {2, 3, 2, 2, 3, 2, 4, 1},      /* everything, asymmetric */
+        {1, 1, 1, 1, 5, 5, 5, 5}       /* pad wider than the kernel */
+    };
+
+    fx_tensor_t in_c, in_l, out_c, out_l;
+    fx_conv_filter_t f_c, f_l;
+    fx_matrix_t bias;
+    int all_match = 1;
+    int layouts_match = 1;
+
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+    fx_matrix_attach(&bias, mc_bias, 1, MC_COUT);
+
+    for (size_t t = 0; t < sizeof(cases) / sizeof(cases[0]); t++) {
+        const fx_conv_params_t* p = &cases[t];
+        const uint32_t oh = fx_conv_output_dim(MC_H, MC_KH, p->stride_h, p->dilation_h,
+                                               p->pad_top, p->pad_bottom);
+        const uint32_t ow = fx_conv_output_dim(MC_W, MC_KW, p->stride_w, p->dilation_w,
+                                               p->pad_left, p->pad_right);
+        const size_t n = (size_t)MC_COUT * oh * ow;
+        static fixed_t big_ref[MC_COUT * 20 * 80];
+        static fixed_t big_c[MC_COUT * 20 * 80];
+        static fixed_t big_l[MC_COUT * 20 * 80];
+
+        assert(n <= sizeof(big_ref) / sizeof(big_ref[0]));
+
+        ex_reference(&in_c, &f_c, mc_bias, p, oh, ow, big_ref);
+
+        fx_tensor_init(&out_c, big_c, MC_COUT, oh, ow, FX_LAYOUT_NCHW);
+        fx_tensor_init(&out_l, big_l, MC_COUT, oh, ow, FX_LAYOUT_NHWC);
+        fx_conv2d_tensor_ex(&in_c, &f_c, &bias, p, &out_c);
+        fx_conv2d_tensor_ex(&in_l, &f_l, &bias, p, &out_l);
+
+        if (memcmp(big_ref, big_c, n * sizeof(fixed_t)) != 0) {
+            all_match = 0;
+        }
+        for (size_t o = 0; o < MC_COUT; o++) {
+            for (size_t y = 0; y < oh; y++) {
+                for (size_t x = 0; x < ow; x++) {
+                    if (out_l.data[fx_tensor_index(&out_l, o, y, x)] !=
+                        out_c.data[fx_tensor_index(&out_c, o, y, x)]) {
+                        layouts_match = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT(all_match, "NCHW matches reference for all parameter sets");
+    TEST_ASSERT(layouts_match, "NHWC bit-identical to NCHW for all parameter sets");
+    TEST_ASSERT(fx_conv_output_dim(4, 3, 1, 3, 0, 0) == 0, "Oversized dilated window rejected");
+    TEST_ASSERT(fx_conv_output_dim(8, 3, 2, 1, 1, 1) == 4, "Output size (8, k3, s2, p1) = 4");
+}
+
+/**
+ * @test Implicit "same" padding equals fx_conv2d on a zero-padded copy
+ * @traceability SRS-006.7
+ */
+static void test_same_padding_zero_copy(void) {
+    printf("\nTest: Implicit vs Materialized Zero Padding\n");
+    printf("───────────────────────────────────────────\n");
+
+    fixed_t in_data[36], k_data[9], pad_data[64], ref_data[36], out_data[36];
+    fx_matrix_t in, kernel, padded, ref, out;
+    const fx_conv_params_t same = {1, 1, 1, 1, 1, 1, 1, 1};
+
+    fx_matrix_init(&in, in_data, 6, 6);
+    fx_matrix_init(&kernel, k_data, 3, 3);
+    fx_matrix_init(&padded, pad_data, 8, 8);
+    fx_matrix_init(&ref, ref_data, 6, 6);
+    fx_matrix_init(&out, out_data, 6, 6);
+
+    for (int i = 0; i < 36; i++) {
+        in.data[i] = mc_rand();
+    }
+    for (int i = 0; i < 9; i++) {
+        kernel.data[i] = mc_rand();
+    }
+    for (int r = 0; r < 6; r++) {
+        for (int c = 0; c < 6; c++) {
+            padded.data[(r + 1) * 8 + c + 1] = in.data[r * 6 + c];
+        }
+    }
+
+    fx_conv2d(&padded, &kernel, &ref);
+    fx_conv2d_ex(&in, &kernel, &same, &out);
+
+    TEST_ASSERT(memcmp(ref_data, out_data, sizeof(ref_data)) == 0,
+                "Implicit padding bit-identical to padded copy");
+}
+
+/* ------------------------------------------------------------------------
+ * Depthwise / depthwise-separable (SRS-006.12, SRS-006.13)
+ * ------------------------------------------------------------------------ */
+
+#define DW_K 3
+#define PW_COUT 5
+#define DW_MAX_OUT (MC_H * MC_W)
+
+static fixed_t dw_w[MC_CIN * DW_K * DW_K];
+static fixed_t dw_b[MC_CIN];
+static fixed_t pw_w[PW_COUT * MC_CIN];
+static fixed_t pw_b[PW_COUT];
+static fixed_t dw_mid_c[MC_CIN * DW_MAX_OUT];
+static fixed_t dw_mid_l[MC_CIN * DW_MAX_OUT];
+static fixed_t dw_plane[DW_MAX_OUT];
+static fixed_t ds_ref[PW_COUT * DW_MAX_OUT];
+static fixed_t ds_out[PW_COUT * DW_MAX_OUT];
+static fixed_t ds_scratch[FX_DWSEP_SCRATCH_LEN(MC_CIN, MC_W)];
+
+static void dw_fill(void) {
+    for (size_t i = 0; i < sizeof(dw_w) / sizeof(dw_w[0]); i++) {
+        dw_w[i] = mc_rand();
+    }
+    for (size_t i = 0; i < MC_CIN; i++) {
+        dw_b[i] = mc_rand();
+    }
+    for (size_t i = 0; i < sizeof(pw_w) / sizeof(pw_w[0]); i++) {
+        pw_w[i] = mc_rand() / 4;
+    }
+    for (size_t i = 0; i < PW_COUT; i++) {
+        pw_b[i] = mc_rand();
+    }
+}
+
+/**
+ * @test Depthwise equals per-channel single-plane convolution, both layouts
+ * @traceability SRS-006.12
+ */
+static void test_depthwise(void) {
+    printf("\nTest: Depthwise Convolution\n");
+    printf("───────────────────────────\n");
+
+    static const fx_conv_params_t cases[] = {
+        FX_CONV_PARAMS_VALID,
+        {1, 1, 1, 1, 1, 1, 1, 1},
+        {2, 2, 1, 2, 1, 0, 2, 1}
+    };
+    fx_tensor_t in_c, in_l, out_c, out_l;
+    fx_conv_filter_t f_c, f_l;
+    fx_matrix_t bias;
+    int planes_match = 1;
+    int layouts_match = 1;
+
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+    dw_fill();
+    fx_matrix_attach(&bias, dw_b, 1, MC_CIN);
+
+    const fx_conv_filter_t dwf_c = {dw_w, MC_CIN, 1, DW_K, DW_K, FX_LAYOUT_NCHW};
+    const fx_conv_filter_t dwf_l = {dw_w, MC_CIN, 1, DW_K, DW_K, FX_LAYOUT_NHWC};
+
+    for (size_t t = 0; t < sizeof(cases) / sizeof(cases[0]); t++) {
+        const fx_conv_params_t* p = &cases[t];
+        const uint32_t oh = fx_conv_output_dim(MC_H, DW_K, p->stride_h, p->dilation_h,
+                                               p->pad_top, p->pad_bottom);
+        const uint32_t ow = fx_conv_output_dim(MC_W, DW_K, p->stride_w, p->dilation_w,
+                                               p->pad_left, p->pad_right);
+
+        fx_tensor_init(&out_c, dw_mid_c, MC_CIN, oh, ow, FX_LAYOUT_NCHW);
+        fx_tensor_init(&out_l, dw_mid_l, MC_CIN, oh, ow, FX_LAYOUT_NHWC);
+        fx_conv2d_depthwise(&in_c, &dwf_c, &bias, p, &out_c);
+        fx_conv2d_depthwise(&in_l, &dwf_l, &bias, p, &out_l);
+
+        for (size_t ch = 0; ch < MC_CIN; ch++) {
+            fx_tensor_t plane_in, plane_out;
+            fx_matrix_t plane_bias;
+            const fx_conv_filter_t f1 = {&dw_w[ch * DW_K * DW_K], 1, 1, DW_K, DW_K,
+                                         FX_LAYOUT_NCHW};
+
+            fx_tensor_attach(&plane_in, &mc_in_nchw[ch * MC_H * MC_W], 1, MC_H, MC_W,
+                             FX_LAYOUT_NCHW);
+            fx_tensor_init(&plane_out, dw_plane, 1, oh, ow, FX_LAYOUT_NCHW);
+            fx_matrix_attach(&plane_bias, &dw_b[ch], 1, 1);
+            fx_conv2d_tensor_ex(&plane_in, &f1, &plane_bias, p, &plane_out);
+
+            if (memcmp(dw_plane, &dw_mid_c[ch * oh * ow], (size_t)oh * ow * sizeof(fixed_t)) != 0) {
+                planes_match = 0;
+            }
+            for (size_t y = 0; y < oh; y++) {
+                for (size_t x = 0; x < ow; x++) {
+                    if (out_l.data[fx_tensor_index(&out_l, ch, y, x)] !=
+                        out_c.data[fx_tensor_index(&out_c, ch, y, x)]) {
+                        layouts_match = 0;
+                    }
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT(planes_match, "NCHW equals per-channel convolution");
+    TEST_ASSERT(layouts_match, "NHWC bit-identical to NCHW");
+}
+
+/**
+ * @test Fused depthwise-separable equals the unfused layer sequence
+ * @traceability SRS-006.13
+ */
+static void test_dwsep_matches_unfused(void) {
+    printf("\nTest: Fused Depthwise-Separable vs Unfused\n");
+    printf("──────────────────────────────────────────\n");
+
+    static const fx_conv_params_t cases[] = {
+        {1, 1, 1, 1, 1, 1, 1, 1},
+        {2, 2, 1, 1, 0, 1, 0, 1}
+    };
+    static const fx_layout_t layouts[] = {FX_LAYOUT_NCHW, FX_LAYOUT_NHWC};
+    const fx_activation_t relu = {FX_ACT_RELU, 0, 0, 0};
+    const fx_activation_t leaky = {FX_ACT_LEAKY_RELU, fixed_from_float(0.1f), 0, 0};
+    fx_tensor_t in_c, in_l, mid, ref, out;
+    fx_conv_filter_t f_c, f_l;
+    fx_matrix_t dwb, pwb;
+    int all_match = 1;
+
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+    dw_fill();
+    fx_matrix_attach(&dwb, dw_b, 1, MC_CIN);
+    fx_matrix_attach(&pwb, pw_b, 1, PW_COUT);
+
+    for (size_t l = 0; l < 2; l++) {
+        const fx_tensor_t* in = (layouts[l] == FX_LAYOUT_NCHW) ? &in_c : &in_l;
+        const fx_conv_filter_t dwf = {dw_w, MC_CIN, 1, DW_K, DW_K, layouts[l]};
+        const fx_conv_filter_t pwf = {pw_w, PW_COUT, MC_CIN, 1, 1, layouts[l]};
+        const fx_dwsep_layer_t layer = {&dwf, &dwb, &relu, &pwf, &pwb, &leaky};
+
+        for (size_t t = 0; t < sizeof(cases) / sizeof(cases[0]); t++) {
+            const fx_conv_params_t* p = &cases[t];
+            const uint32_t oh = fx_conv_output_dim(MC_H, DW_K, p->stride_h, p->dilation_h,
+                                                   p->pad_top, p->pad_bottom);
+            const uint32_t ow = fx_conv_output_dim(MC_W, DW_K, p->stride_w, p->dilation_w,
+                                                   p->pad_left, p->pad_right);
+            const size_t n_out = (size_t)PW_COUT * oh * ow;
+
+            fx_tensor_init(&mid, dw_mid_c, MC_CIN, oh, ow, layouts[l]);
+            fx_tensor_init(&ref, ds_ref, PW_COUT, oh, ow, layouts[l]);
+            fx_tensor_init(&out, ds_out, PW_COUT, oh, ow, layouts[l]);
+
+            fx_conv2d_depthwise(in, &dwf, &dwb, p, &mid);
+            fx_activation_apply(&relu, mid.data, fx_tensor_size(&mid));
+            fx_conv2d_tensor(&mid, &pwf, &pwb, &ref);
+            fx_activation_apply(&leaky, ref.data, n_out);
+
+            fx_conv2d_dwsep(in, &layer, p, &out, ds_scratch,
+                            sizeof(ds_scratch) / sizeof(ds_scratch[0]));
+
+            if (memcmp(ds_ref, ds_out, n_out * sizeof(fixed_t)) != 0) {
+                all_match = 0;
+            }
+        }
+    }
+
+    TEST_ASSERT(all_match, "Fused output bit-identical in both layouts");
+
+    /* Undersized scratch: output untouched */
+    const fx_conv_filter_t dwf = {dw_w, MC_CIN, 1, DW_K, DW_K, FX_LAYOUT_NCHW};
+    const fx_conv_filter_t pwf = {pw_w, PW_COUT, MC_CIN, 1, 1, FX_LAYOUT_NCHW};
+    const fx_dwsep_layer_t layer = {&dwf, NULL, NULL, &pwf, NULL, NULL};
+    const fx_conv_params_t valid = FX_CONV_PARAMS_VALID;
+
+    fx_tensor_init(&out, ds_out, PW_COUT, MC_H - 2, MC_W - 2, FX_LAYOUT_NCHW);
+    out.data[0] = fixed_from_int(999);
+    fx_conv2d_dwsep(&in_c, &layer, &valid, &out, ds_scratch,
+                    FX_DWSEP_SCRATCH_LEN(MC_CIN, MC_W - 2) - 1);
+    TEST_ASSERT(out.data[0] == fixed_from_int(999), "Undersized scratch rejected");
+}
+
+/**
+ * @brief Run separable and 2-D forms on the same input; 1 if identical.
+ */
+static int separable_matches_2d(const fixed_t* v, size_t k_h, const fixed_t* h,
+                                size_t k_w, uint32_t inter_bits) {
+    static fixed_t k2d[9 * 9];
+    static fixed_t ref_data[MC_H * MC_W];
+    static fixed_t out_data[MC_H * MC_W];
+    static int64_t row_scratch[FX_SEPARABLE_SCRATCH_LEN(MC_W)];
+    fx_matrix_t in, col_k, row_k, kernel, ref, out;
+
+    for (size_t ky = 0; ky < k_h; ky++) {
+        for (size_t kx = 0; kx < k_w; kx++) {
+            k2d[ky * k_w + kx] = fixed_mul(v[ky], h[kx]);
+        }
+    }
+
+    fx_matrix_attach(&in, mc_in_nchw, MC_H, MC_W);
+    fx_matrix_attach(&col_k, (fixed_t*)v, (uint32_t)k_h, 1);
+    fx_matrix_attach(&row_k, (fixed_t*)h, 1, (uint32_t)k_w);
+    fx_matrix_attach(&kernel, k2d, (uint32_t)k_h, (uint32_t)k_w);
+    fx_matrix_init(&ref, ref_data, MC_H - (uint32_t)k_h + 1, MC_W - (uint32_t)k_w + 1);
+    fx_matrix_init(&out, out_data, MC_H - (uint32_t)k_h + 1, MC_W - (uint32_t)k_w + 1);
+
+    fx_conv2d(&in, &kernel, &ref);
+    fx_conv2d_separable(&in, &col_k, &row_k, inter_bits, &out, row_scratch,
+                        FX_SEPARABLE_SCRATCH_LEN(MC_W));
+
+    return memcmp(ref_data, out_data, (size_t)ref.rows * ref.cols * sizeof(fixed_t)) == 0;
+}
+
+/**
+ * @test Separable passes match the 2-D kernel bit-for-bit where exact
+ * @traceability SRS-006.14
+ */
+static void test_separable(void) {
+    printf("\nTest: Separable Convolution vs 2-D Kernel\n");
+    printf("─────────────────────────────────────────\n");
+
+    fx_tensor_t in_c, in_l;
+    fx_conv_filter_t f_c, f_l;
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+
+    /* Sobel: integer smoothing column, derivative row */
+    const fixed_t sobel_v[3] = {fixed_from_int(1), fixed_from_int(2), fixed_from_int(1)};
+    const fixed_t sobel_h[3] = {fixed_from_int(-1), 0, fixed_from_int(1)};
+    TEST_ASSERT(separable_matches_2d(sobel_v, 3, sobel_h, 3, 0),
+                "Sobel 3×3 bit-identical (integer intermediate)");
+
+    /* 7×7 box */
+    fixed_t box[7];
+    for (int i = 0; i < 7; i++) {
+        box[i] = FIXED_ONE;
+    }
+    TEST_ASSERT(separable_matches_2d(box, 7, box, 7, 0), "Box 7×7 bit-identical");
+
+    /* Binomial 1/16·[1 4 6 4 1]: fractional factor needs 4 extra bits */
+    const fixed_t binom[5] = {FIXED_ONE / 16, FIXED_ONE / 4, 3 * FIXED_ONE / 8,
+                              FIXED_ONE / 4, FIXED_ONE / 16};
+    TEST_ASSERT(separable_matches_2d(binom, 5, binom, 5, 4),
+                "Binomial 5×5 bit-identical (4 intermediate bits)");
+    TEST_ASSERT(separable_matches_2d(binom, 5, binom, 5, FX_SEPARABLE_MAX_INTER_BITS),
+                "Binomial 5×5 bit-identical (exact Q32.32 intermediate)");
+
+    /* Parameter validation */
+    fixed_t out_data[4];
+    int64_t row_scratch[4];
+    fx_matrix_t in, col_k, row_k, out;
+    fx_matrix_attach(&in, mc_in_nchw, 4, 4);
+    fx_matrix_attach(&col_k, (fixed_t*)sobel_v, 3, 1);
+    fx_matrix_attach(&row_k, (fixed_t*)sobel_h, 1, 3);
+    fx_matrix_attach(&out, out_data, 2, 2);
+    out_data[0] = fixed_from_int(999);
+    fx_conv2d_separable(&in, &col_k, &row_k, FX_SEPARABLE_MAX_INTER_BITS + 1u, &out,
+                        row_scratch, 4);
+    fx_conv2d_separable(&in, &col_k, &row_k, 0, &out, row_scratch, 3);
+    TEST_ASSERT(out_data[0] == fixed_from_int(999), "Invalid precision / scratch rejected");
+
+    /* Near-full-range input with unit taps at G = 16: Q32.32 column sums
+     * times h would pass 2^63, so the call must be rejected */
+    fixed_t big_in[16];
+    const fixed_t unit[3] = {FIXED_ONE, FIXED_ONE, FIXED_ONE};
+    for (int i = 0; i < 16; i++) {
+        big_in[i] = (i & 1) ? FIXED_MAX : fixed_from_int(30000);
+    }
+    fx_matrix_attach(&in, big_in, 4, 4);
+    fx_matrix_attach(&col_k, (fixed_t*)unit, 3, 1);
+    fx_matrix_attach(&row_k, (fixed_t*)unit, 1, 3);
+    fx_conv2d_separable(&in, &col_k, &row_k, FX_SEPARABLE_MAX_INTER_BITS, &out,
+                        row_scratch, 4);
+    TEST_ASSERT(out_data[0] == fixed_from_int(999), "Overflowing magnitudes rejected");
+
+    /* Same data without extra intermediate bits stays exact and runs */
+    fx_conv2d_separable(&in, &col_k, &row_k, 0, &out, row_scratch, 4);
+    TEST_ASSERT(out_data[0] != fixed_from_int(999), "Bounded magnitudes accepted");
+}
+
+/**
+ * @test Winograd F(2×2,3×3) is bit-identical to the direct convolution
+ * @traceability SRS-006.15
+ */
+static void test_winograd(void) {
+    printf("\nTest: Integer Winograd F(2×2,3×3)\n");
+    printf("─────────────────────────────────\n");
+
+    static int64_t wg_u[FX_WINOGRAD_FILTER_LEN(MC_COUT, MC_CIN)];
+    static int64_t wg_scratch[FX_WINOGRAD_SCRATCH_LEN(MC_CIN)];
+    static fixed_t w3_c[MC_COUT * MC_CIN * 9];
+    static fixed_t w3_l[MC_COUT * MC_CIN * 9];
+    static const uint32_t sizes[][2] = {{MC_H, MC_W}, {8, 8}, {5, 6}, {3, 3}};
+
+    fx_tensor_t in_c, in_l, ref, out;
+    fx_conv_filter_t f_c, f_l;
+    fx_winograd_filter_t wf;
+    fx_matrix_t bias;
+    int all_match = 1;
+
+    mc_fill(&in_c, &in_l, &f_c, &f_l);
+    fx_matrix_attach(&bias, mc_bias, 1, MC_COUT);
+
+    const fx_conv_filter_t g_c = {w3_c, MC_COUT, MC_CIN, 3, 3, FX_LAYOUT_NCHW};
+    const fx_conv_filter_t g_l = {w3_l, MC_COUT, MC_CIN, 3, 3, FX_LAYOUT_NHWC};
+    for (size_t o = 0; o < MC_COUT; o++) {
+        for (size_t i = 0; i < MC_CIN; i++) {
+            for (size_t r = 0; r < 3; r++) {
+                for (size_t c = 0; c < 3; c++) {
+                    fixed_t v = mc_rand();
+                    w3_c[fx_filter_index(&g_c, o, i, r, c)] = v;
+                    w3_l[fx_filter_index(&g_l, o, i, r, c)] = v;
+                }
+            }
+        }
+    }
+
+    for (size_t l = 0; l < 2; l++) {
+        const fx_conv_filter_t* g = (l == 0) ? &g_c : &g_l;
+        fixed_t* src = (l == 0) ? mc_in_nchw : mc_in_nhwc;
+
+        fx_winograd_filter_init(&wf, wg_u, sizeof(wg_u) / sizeof(wg_u[0]), g);
+        TEST_ASSERT(wf.out_channels == MC_COUT, "Filter transform initialized");
+
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            const uint32_t h = sizes[s][0];
+            const uint32_t w = sizes[s][1];
+            fx_tensor_t in;
+
+            /* Sub-tensors reuse the filled buffer; contents are just data */
+            fx_tensor_attach(&in, src, MC_CIN, h, w, g->layout);
+            fx_tensor_init(&ref, mc_out_nchw, MC_COUT, h - 2, w - 2, g->layout);
+            fx_tensor_init(&out, mc_out_col, MC_COUT, h - 2, w - 2, g->layout);
+
+            fx_conv2d_tensor(&in, g, &bias, &ref);
+            fx_conv2d_winograd(&in, &wf, &bias, &out, wg_scratch,
+                               sizeof(wg_scratch) / sizeof(wg_scratch[0]));
+
+            if (memcmp(ref.data, out.data, fx_tensor_size(&ref) * sizeof(fixed_t)) != 0) {
+                all_match = 0;
+            }
+        }
+    }
+    TEST_ASSERT(all_match, "Even/odd tiles bit-identical to direct (NCHW, NHWC)");
+
+    /* Near-range operands: transforms overflow int64, result still exact */
+    fixed_t big_in[16], big_w[9], big_ref[4], big_out[4];
+    int64_t big_u[16], big_scratch[16];
+    fx_tensor_t bin, bref, bout;
+    for (int i = 0; i < 16; i++) {
+        big_in[i] = (i % 3 == 0) ? FIXED_MIN : FIXED_MAX - i;
+    }
+    for (int i = 0; i < 9; i++) {
+        big_w[i] = (i % 2 == 0) ? (FIXED_ONE / 64) : -(FIXED_ONE / 128);
+    }
+    const fx_conv_filter_t bf = {big_w, 1, 1, 3, 3, FX_LAYOUT_NCHW};
+    fx_tensor_attach(&bin, big_in, 1, 4, 4, FX_LAYOUT_NCHW);
+    fx_tensor_init(&bref, big_ref, 1, 2, 2, FX_LAYOUT_NCHW);
+    fx_tensor_init(&bout, big_out, 1, 2, 2, FX_LAYOUT_NCHW);
+    fx_winograd_filter_init(&wf, big_u, 16, &bf);
+    fx_conv2d_tensor(&bin, &bf, NULL, &bref);
+    fx_conv2d_winograd(&bin, &wf, NULL, &bout, big_scratch, 16);
+    TEST_ASSERT(memcmp(big_ref, big_out, sizeof(big_ref)) == 0,
+                "Full-range inputs bit-identical (modular transforms)");
+
+    /* Non-3×3 filters are rejected */
+    fx_winograd_filter_init(&wf, wg_u, sizeof(wg_u) / sizeof(wg_u[0]), &f_c);
+    TEST_ASSERT(wf.out_channels == 0, "Non-3×3 filter rejected");
+}
+
+#define NTT_H 40
+#define NTT_W 37
+#define NTT_K 15
+
+/**
+ * @test NTT convolution reproduces the exact direct accumulators
+ * @traceability SRS-006.16
+ */
+static void test_ntt(void) {
+    printf("\nTest: NTT Convolution (Large Kernel)\n");
+    printf("────────────────────────────────────\n");
+
+    static fixed_t nt_in[NTT_H * NTT_W];
+    static fixed_t nt_k[NTT_K * NTT_K];
+    static fixed_t nt_ref[(NTT_H - NTT_K + 1) * (NTT_W - NTT_K + 1)];
+    static fixed_t nt_out[(NTT_H - NTT_K + 1) * (NTT_W - NTT_K + 1)];
+    static int64_t nt_acc[(NTT_H - NTT_K + 1) * (NTT_W - NTT_K + 1)];
+    static uint32_t nt_scratch[4 * 64 * 64];
+    const size_t scratch_len = sizeof(nt_scratch) / sizeof(nt_scratch[0]);
+
+    fx_matrix_t in, kernel, ref, out;
+    fx_matrix_attach(&in, nt_in, NTT_H, NTT_W);
+    fx_matrix_attach(&kernel, nt_k, NTT_K, NTT_K);
+    fx_matrix_init(&ref, nt_ref, NTT_H - NTT_K + 1, NTT_W - NTT_K + 1);
+    fx_matrix_init(&out, nt_out, NTT_H - NTT_K + 1, NTT_W - NTT_K + 1);
+
+    TEST_ASSERT(fx_conv2d_ntt_scratch_len(NTT_H, NTT_W) == scratch_len,
+                "Scratch length rounds both axes to powers of two");
+    TEST_ASSERT(fx_conv2d_ntt_scratch_len(1u << 12, 1u << 12) == 0,
+                "Oversized transform reported");
+
+    for (size_t i = 0; i < NTT_H * NTT_W; i++) {
+        nt_in[i] = mc_rand();
+    }
+    for (size_t i = 0; i < NTT_K * NTT_K; i++) {
+        nt_k[i] = mc_rand();
+    }
+
+    fx_conv2d(&in, &kernel, &ref);
+    fx_conv2d_ntt(&in, &kernel, &out, nt_acc, nt_scratch, scratch_len);
+
+    int acc_exact = 1;
+    for (size_t y = 0; y < ref.rows; y++) {
+        for (size_t x = 0; x < ref.cols; x++) {
+            int64_t sum = 0;
+            for (size_t ky = 0; ky < NTT_K; ky++) {
+                for (size_t kx = 0; kx < NTT_K; kx++) {
+                    sum += (int64_t)nt_in[(y + ky) * NTT_W + x + kx] *
+                           nt_k[ky * NTT_K + kx];
+                }
+            }
+            if (nt_acc[y * ref.cols + x] != sum) {
+                acc_exact = 0;
+            }
+        }
+    }
+    TEST_ASSERT(acc_exact, "Accumulators equal the direct int64 sums");
+    TEST_ASSERT(memcmp(nt_ref, nt_out, sizeof(nt_ref)) == 0,
+                "15×15 kernel bit-identical to fx_conv2d");
+
+    /* Full-range operands: accumulators span most of int64 */
+    fixed_t big_in[8 * 8], big_k[4 * 4], big_ref[5 * 5], big_out[5 * 5];
+    fx_matrix_t bin, bk, bref, bout;
+    for (int i = 0; i < 64; i++) {
+        big_in[i] = (i % 3 == 0) ? FIXED_MIN : FIXED_MAX - i;
+    }
+    for (int i = 0; i < 16; i++) {
+        big_k[i] = (i % 2 == 0) ? FIXED_MAX / 64 : FIXED_MIN / 128;
+    }
+    fx_matrix_attach(&bin, big_in, 8, 8);
+    fx_matrix_attach(&bk, big_k, 4, 4);
+    fx_matrix_init(&bref, big_ref, 5, 5);
+    fx_matrix_init(&bout, big_out, 5, 5);
+    fx_conv2d(&bin, &bk, &bref);
+    fx_conv2d_ntt(&bin, &bk, &bout, NULL, nt_scratch, scratch_len);
+    TEST_ASSERT(memcmp(big_ref, big_out, sizeof(big_ref)) == 0,
+                "Full-range inputs bit-identical (CRT reconstruction)");
+
+    /* Undersized scratch leaves the output untouched */
+    nt_out[0] = fixed_from_int(999);
+    fx_conv2d_ntt(&in, &kernel, &out, NULL, nt_scratch, scratch_len - 1u);
+    TEST_ASSERT(nt_out[0] == fixed_from_int(999), "Undersized scratch rejected");
+}
+
 int main(void) {
     printf("╔═══════════════════════════════════════════════╗\n");
     printf("║   SpeyTech Certifiable Inference Engine      ║\n");
@@ -331,6 +1290,19 @@ int main(void) {
     test_vertical_edges();
     test_deterministic_behavior();
     test_zero_kernel();
+    test_multichannel_layouts();
+    test_multichannel_single_plane();
+    test_multichannel_invalid();
+    test_conv_act_maxpool();
+    test_im2col_matches_direct();
+    test_im2col_packed_matches_direct();
+    test_strided_dilated_padded();
+    test_same_padding_zero_copy();
+    test_depthwise();
+    test_dwsep_matches_unfused();
+    test_separable();
+    test_winograd();
+    test_ntt();
 
     /* Print summary */
     printf("\n═══════════════════════════════════════════════\n");
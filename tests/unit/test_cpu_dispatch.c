@@ -0,0 +1,177 @@
+/**
+ * @file test_cpu_dispatch.c
+ * @project Certifiable Inference Engine
+ * @brief Verification suite for SRS-003.10 (Bit-Identical SIMD Dispatch).
+ *
+ * @details Runs every kernel level supported by the host CPU and checks that
+ * GEMM, blocked GEMM, GEMV and dot products are byte-identical to the scalar
+ * reference, including operands at the edges of the Q16.16 range.
+ *
+ * @traceability SRS-003.10
+ * @compliance MISRA-C:2012, ISO 26262
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "cpu_dispatch.h"
+#include "matrix.h"
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#define MAX_DIM 67
+
+static fixed_t buf_a[MAX_DIM * MAX_DIM];
+static fixed_t buf_b[MAX_DIM * MAX_DIM];
+static fixed_t ref_c[MAX_DIM * MAX_DIM];
+static fixed_t ref_blk[MAX_DIM * MAX_DIM];
+static fixed_t out_c[MAX_DIM * MAX_DIM];
+static fixed_t scratch[FX_GEMM_SCRATCH_LEN(MAX_DIM)];
+static fixed_t buf_bt[MAX_DIM * MAX_DIM];
+
+static const uint16_t shapes[][3] = {
+    {1, 1, 1}, {1, 9, 8}, {5, 3, 17}, {4, 31, 16}, {9, 64, 33}, {67, 67, 67}
+};
+
+#define SHAPE_COUNT (sizeof(shapes) / sizeof(shapes[0]))
+
+static uint32_t rng_state = 777u;
+
+static fixed_t rand_fixed(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return (fixed_t)((int32_t)rng_state >> 9);
+}
+
+/**
+ * @brief Fill operands for one shape (same data for every ISA).
+ */
+static void fill_operands(size_t shape, fx_matrix_t* A, fx_matrix_t* B) {
+    const uint16_t n = shapes[shape][0];
+    const uint16_t m = shapes[shape][1];
+    const uint16_t p = shapes[shape][2];
+
+    rng_state = 777u + (uint32_t)shape;
+    fx_matrix_init(A, buf_a, n, m);
+    fx_matrix_init(B, buf_b, m, p);
+
+    for (size_t i = 0; i < (size_t)n * m; i++) {
+        A->data[i] = rand_fixed();
+    }
+    for (size_t i = 0; i < (size_t)m * p; i++) {
+        B->data[i] = rand_fixed();
+    }
+
+    /* One extreme product per output keeps the reference sum in range */
+    A->data[0] = FIXED_MIN;
+    B->data[0] = FIXED_MIN;
+    B->data[(size_t)m * p - 1] = FIXED_MAX;
+}
+
+/**
+ * @test Initialization selects a level the CPU supports.
+ * @traceability SRS-003.10
+ */
+static void test_dispatch_init(void) {
+    printf("Testing dispatch initialization... ");
+
+    fx_isa_t isa = fx_dispatch_init();
+    assert(isa >= FX_ISA_SCALAR && isa <= FX_ISA_AVX2);
+    assert(fx_dispatch_active() == isa);
+    assert(fx_dispatch_init() == isa); /* Idempotent */
+
+    printf("✓ (%s)\n", fx_isa_name(isa));
+}
+
+/**
+ * @test Forcing scalar always succeeds.
+ * @traceability SRS-003.10
+ */
+static void test_force_scalar(void) {
+    printf("Testing forced scalar fallback... ");
+
+    assert(fx_dispatch_force(FX_ISA_SCALAR) == FX_ISA_SCALAR);
+    assert(fx_dispatch_active() == FX_ISA_SCALAR);
+
+    printf("✓\n");
+}
+
+/**
+ * @test Every supported level is bit-identical to scalar.
+ * @traceability SRS-003.3, SRS-003.10, V-003.1
+ */
+static void test_levels_bit_identical(void) {
+    printf("Testing all kernel levels bit-identical to scalar...\n");
+
+    static const fx_isa_t levels[] = {FX_ISA_SSE41, FX_ISA_AVX2};
+
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        if (fx_dispatch_force(levels[l]) != levels[l]) {
+            printf("  - %s not available on this CPU, skipped\n", fx_isa_name(levels[l]));
+            continue;
+        }
+
+        for (size_t s = 0; s < SHAPE_COUNT; s++) {
+            fx_matrix_t A, B, C;
+            const uint16_t n = shapes[s][0];
+            const uint16_t m = shapes[s][1];
+            const uint16_t p = shapes[s][2];
+            const size_t bytes = (size_t)n * p * sizeof(fixed_t);
+
+            fill_operands(s, &A, &B);
+
+            /* Scalar references */
+            fx_dispatch_force(FX_ISA_SCALAR);
+            fx_matrix_init(&C, ref_c, n, p);
+            fx_matrix_mul(&A, &B, &C);
+            fx_matrix_init(&C, ref_blk, n, p);
+            fx_matrix_mul_blocked(&A, &B, &C, scratch, FX_GEMM_SCRATCH_LEN(m));
+            fixed_t ref_dot = fx_vector_dot(A.data, B.data, m);
+
+            /* Blocked and reference paths must agree with each other too */
+            assert(memcmp(ref_c, ref_blk, bytes) == 0);
+
+            fx_dispatch_force(levels[l]);
+
+            fx_matrix_init(&C, out_c, n, p);
+            fx_matrix_mul(&A, &B, &C);
+            assert(memcmp(ref_c, out_c, bytes) == 0);
+
+            fx_matrix_init(&C, out_c, n, p);
+            fx_matrix_mul_blocked(&A, &B, &C, scratch, FX_GEMM_SCRATCH_LEN(m));
+            assert(memcmp(ref_c, out_c, bytes) == 0);
+
+            assert(fx_vector_dot(A.data, B.data, m) == ref_dot);
+
+            /* GEMV on the first row of A against Bᵀ */
+            fx_matrix_t x, Bt;
+            fx_matrix_attach(&x, buf_a, 1, m);
+            fx_matrix_init(&Bt, buf_bt, p, m);
+            fx_matrix_transpose(&B, &Bt);
+            fx_matrix_init(&C, out_c, 1, p);
+            fx_matrix_vec_mul(&x, &Bt, &C);
+            assert(memcmp(ref_c, out_c, (size_t)p * sizeof(fixed_t)) == 0);
+        }
+
+        printf("  ✓ %s\n", fx_isa_name(levels[l]));
+    }
+
+    fx_dispatch_force(FX_ISA_AVX2);
+}
+
+int main(void) {
+    printf("═══════════════════════════════════════════════\n");
+    printf("SRS-003.10 SIMD Dispatch Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n\n");
+
+    test_dispatch_init();
+    test_force_scalar();
+    test_levels_bit_identical();
+
+    printf("\n═══════════════════════════════════════════════\n");
+    printf("✅ SRS-003.10 Compliance Verified\n");
+    printf("═══════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -296,6 +296,280 @@ void test_matrix_addition(void) {
     printf("✓\n");
 }
 
+/**
+ * @brief Deterministic pseudo-random generator for test data (LCG).
+ */
+static uint32_t test_rng_state = 12345u;
+
+static fixed_t test_rand_fixed(void) {
+    test_rng_state = test_rng_state * 1664525u + 1013904223u;
+    /* Spread over roughly ±128.0 so sums exercise the upper accumulator bits */
+    return (fixed_t)((int32_t)test_rng_state >> 8);
+}
+
+#define BLOCKED_MAX_DIM 97
+
+static fixed_t blk_a[BLOCKED_MAX_DIM * BLOCKED_MAX_DIM];
+static fixed_t blk_b[BLOCKED_MAX_DIM * BLOCKED_MAX_DIM];
+static fixed_t blk_ref[BLOCKED_MAX_DIM * BLOCKED_MAX_DIM];
+static fixed_t blk_out[BLOCKED_MAX_DIM * BLOCKED_MAX_DIM];
+static fixed_t blk_scratch[FX_GEMM_SCRATCH_LEN(BLOCKED_MAX_DIM)];
+
+/**
+ * @brief Test blocked GEMM is bit-identical to the reference loop.
+ * @traceability SRS-003.9, V-003.1
+ */
+void test_blocked_matches_reference(void) {
+    printf("Testing blocked GEMM matches reference... ");
+
+    /* Shapes cover full tiles, edge tiles and multiple k/NC blocks */
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {3, 5, 7}, {4, 8, 8}, {13, 17, 9},
+        {64, 64, 64}, {65, 97, 71}, {97, 33, 97}
+    };
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        const uint16_t n = shapes[s][0];
+        const uint16_t m = shapes[s][1];
+        const uint16_t p = shapes[s][2];
+        fx_matrix_t A, B, R, C;
+
+        fx_matrix_init(&A, blk_a, n, m);
+        fx_matrix_init(&B, blk_b, m, p);
+        fx_matrix_init(&R, blk_ref, n, p);
+        fx_matrix_init(&C, blk_out, n, p);
+
+        for (size_t i = 0; i < (size_t)n * m; i++) {
+            A.data[i] = test_rand_fixed();
+        }
+        for (size_t i = 0; i < (size_t)m * p; i++) {
+            B.data[i] = test_rand_fixed();
+        }
+
+        fx_matrix_mul(&A, &B, &R);
+        fx_matrix_mul_blocked(&A, &B, &C, blk_scratch, FX_GEMM_SCRATCH_LEN(m));
+
+        assert(memcmp(R.data, C.data, (size_t)n * p * sizeof(fixed_t)) == 0);
+    }
+
+    /* Undersized scratch must leave C untouched */
+    fx_matrix_t A, B, C;
+    fx_matrix_init(&A, blk_a, 8, 16);
+    fx_matrix_init(&B, blk_b, 16, 8);
+    fx_matrix_init(&C, blk_out, 8, 8);
+    for (int i = 0; i < 64; i++) {
+        C.data[i] = fixed_from_int(999);
+    }
+    fx_matrix_mul_blocked(&A, &B, &C, blk_scratch, FX_GEMM_SCRATCH_LEN(16) - 1);
+    for (int i = 0; i < 64; i++) {
+        assert(fixed_to_int(C.data[i]) == 999);
+    }
+
+    printf("✓\n");
+}
+
+#define GEMV_MAX_DIM 300
+
+static fixed_t gemv_w[GEMV_MAX_DIM * GEMV_MAX_DIM];
+static fixed_t gemv_wt[GEMV_MAX_DIM * GEMV_MAX_DIM];
+static fixed_t gemv_x[GEMV_MAX_DIM];
+static fixed_t gemv_ref[GEMV_MAX_DIM];
+static fixed_t gemv_out[GEMV_MAX_DIM];
+
+/**
+ * @brief Test GEMV on transposed weights against fx_matrix_mul().
+ * @details Covers row counts that are not multiples of four and lengths
+ * that exercise every SIMD body and tail.
+ * @traceability SRS-003.4, SRS-003.12
+ */
+void test_vec_mul_matches_gemm(void) {
+    printf("Testing GEMV bit-identical to GEMM on batch 1... ");
+
+    static const uint16_t shapes[][2] = {
+        {1, 1}, {3, 5}, {7, 4}, {16, 9}, {65, 31}, {130, 66}, {300, 257}
+    };
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        const uint16_t k = shapes[s][0];
+        const uint16_t p = shapes[s][1];
+        fx_matrix_t x, W, Wt, R, Y;
+
+        fx_matrix_init(&x, gemv_x, 1, k);
+        fx_matrix_init(&W, gemv_w, k, p);
+        fx_matrix_init(&Wt, gemv_wt, p, k);
+        fx_matrix_init(&R, gemv_ref, 1, p);
+        fx_matrix_init(&Y, gemv_out, 1, p);
+
+        for (size_t i = 0; i < k; i++) {
+            x.data[i] = test_rand_fixed();
+        }
+        for (size_t i = 0; i < (size_t)k * p; i++) {
+            W.data[i] = test_rand_fixed();
+        }
+
+        fx_matrix_transpose(&W, &Wt);
+        assert(Wt.data[(p - 1u) * k] == W.data[p - 1u]);
+
+        fx_matrix_mul(&x, &W, &R);
+        fx_matrix_vec_mul(&x, &Wt, &Y);
+
+        assert(memcmp(R.data, Y.data, (size_t)p * sizeof(fixed_t)) == 0);
+    }
+
+    /* Batch > 1 and mismatched shapes must leave y untouched */
+    fx_matrix_t x, Wt, Y;
+    fx_matrix_init(&x, gemv_x, 2, 8);
+    fx_matrix_init(&Wt, gemv_wt, 4, 8);
+    fx_matrix_init(&Y, gemv_out, 1, 4);
+    for (int i = 0; i < 4; i++) {
+        Y.data[i] = fixed_from_int(999);
+    }
+    fx_matrix_vec_mul(&x, &Wt, &Y);
+    x.rows = 1;
+    x.cols = 7;
+    fx_matrix_vec_mul(&x, &Wt, &Y);
+    for (int i = 0; i < 4; i++) {
+        assert(fixed_to_int(Y.data[i]) == 999);
+    }
+
+    printf("✓\n");
+}
+
+static fixed_t pack_buf[FX_PACKED_WEIGHTS_LEN(BLOCKED_MAX_DIM, BLOCKED_MAX_DIM)];
+static fixed_t pack_buf_t[FX_PACKED_WEIGHTS_LEN(BLOCKED_MAX_DIM, BLOCKED_MAX_DIM)];
+
+/**
+ * @brief Test GEMM on weights packed at load time against fx_matrix_mul().
+ * @details Packs both from W (K×P) and from Wᵀ (P×K); the two packings must
+ * be identical, including the zero columns of the last panel.
+ * @traceability SRS-003.4, SRS-003.13
+ */
+void test_packed_matches_reference(void) {
+    printf("Testing pre-packed GEMM matches reference... ");
+
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {3, 5, 7}, {4, 8, 8}, {13, 17, 9},
+        {64, 64, 64}, {65, 97, 71}, {97, 33, 97}, {2, 300, 3}
+    };
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        const uint16_t n = shapes[s][0];
+        const uint16_t m = shapes[s][1];
+        const uint16_t p = shapes[s][2];
+        const size_t len = FX_PACKED_WEIGHTS_LEN(m, p);
+        fx_matrix_t A, B, Bt, R, C;
+        fx_packed_weights_t W, Wt;
+
+        fx_matrix_init(&A, blk_a, n, m);
+        fx_matrix_init(&B, gemv_w, m, p);
+        fx_matrix_init(&Bt, gemv_wt, p, m);
+        fx_matrix_init(&R, blk_ref, n, p);
+        fx_matrix_init(&C, blk_out, n, p);
+
+        for (size_t i = 0; i < (size_t)n * m; i++) {
+            A.data[i] = test_rand_fixed();
+        }
+        for (size_t i = 0; i < (size_t)m * p; i++) {
+            B.data[i] = test_rand_fixed();
+        }
+        fx_matrix_transpose(&B, &Bt);
+
+        memset(pack_buf, 0x5a, sizeof(pack_buf));
+        fx_pack_weights(&B, pack_buf, len, &W);
+        fx_pack_weights_transposed(&Bt, pack_buf_t, len, &Wt);
+        assert(W.rows == m && W.cols == p && Wt.rows == m && Wt.cols == p);
+        assert(memcmp(pack_buf, pack_buf_t, len * sizeof(fixed_t)) == 0);
+
+        fx_matrix_mul(&A, &B, &R);
+        fx_matrix_mul_packed(&A, &W, &C);
+
+        assert(memcmp(R.data, C.data, (size_t)n * p * sizeof(fixed_t)) == 0);
+    }
+
+    /* Undersized buffer leaves the descriptor untouched */
+    fx_matrix_t A, B, C;
+    fx_packed_weights_t W = {NULL, 0, 0};
+    fx_matrix_init(&B, gemv_w, 16, 9);
+    fx_pack_weights(&B, pack_buf, FX_PACKED_WEIGHTS_LEN(16, 9) - 1, &W);
+    assert(W.data == NULL);
+
+    /* Mismatched input depth leaves C untouched */
+    fx_pack_weights(&B, pack_buf, FX_PACKED_WEIGHTS_LEN(16, 9), &W);
+    fx_matrix_init(&A, blk_a, 2, 15);
+    fx_matrix_init(&C, blk_out, 2, 9);
+    for (int i = 0; i < 18; i++) {
+        C.data[i] = fixed_from_int(999);
+    }
+    fx_matrix_mul_packed(&A, &W, &C);
+    for (int i = 0; i < 18; i++) {
+        assert(fixed_to_int(C.data[i]) == 999);
+    }
+
+    printf("✓\n");
+}
+
+#define LARGE_ROWS 512
+#define LARGE_COLS 256
+#define LARGE_DOT_LEN 70000
+
+static fixed_t large_a[LARGE_ROWS * LARGE_COLS];
+static fixed_t large_b[LARGE_ROWS * LARGE_COLS];
+static fixed_t large_c[LARGE_ROWS * LARGE_COLS];
+static fixed_t large_bias[LARGE_COLS];
+static fixed_t large_u[LARGE_DOT_LEN];
+static fixed_t large_v[LARGE_DOT_LEN];
+
+static fixed_t test_negate(fixed_t x) {
+    return -x;
+}
+
+/**
+ * @brief Test element-wise operations beyond 65,535 elements.
+ * @details Used to wrap in 16-bit element counters and stop early.
+ * @traceability SRS-003.2, SRS-003.4
+ */
+void test_large_dimensions(void) {
+    printf("Testing operations above 65,535 elements... ");
+
+    const size_t total = (size_t)LARGE_ROWS * LARGE_COLS;
+    fx_matrix_t A, B, C, bias;
+
+    fx_matrix_init(&A, large_a, LARGE_ROWS, LARGE_COLS);
+    fx_matrix_init(&B, large_b, LARGE_ROWS, LARGE_COLS);
+    fx_matrix_init(&C, large_c, LARGE_ROWS, LARGE_COLS);
+    fx_matrix_init(&bias, large_bias, 1, LARGE_COLS);
+
+    for (size_t i = 0; i < total; i++) {
+        A.data[i] = FIXED_ONE;
+        B.data[i] = fixed_from_int(2);
+    }
+    for (size_t j = 0; j < LARGE_COLS; j++) {
+        bias.data[j] = FIXED_ONE;
+    }
+
+    fx_matrix_add(&A, &B, &C);
+    assert(C.data[0] == fixed_from_int(3));
+    assert(C.data[total - 1] == fixed_from_int(3));
+
+    fx_matrix_add_bias(&C, &bias);
+    assert(C.data[total - 1] == fixed_from_int(4));
+
+    fx_matrix_apply(&C, test_negate);
+    for (size_t i = 0; i < total; i++) {
+        assert(C.data[i] == fixed_from_int(-4));
+    }
+
+    /* Dot product longer than a uint16_t length */
+    for (size_t i = 0; i < LARGE_DOT_LEN; i++) {
+        large_u[i] = FIXED_ONE;
+        large_v[i] = FIXED_ONE;
+    }
+    assert(fx_vector_dot(large_u, large_v, LARGE_DOT_LEN) ==
+           fixed_from_int(LARGE_DOT_LEN));
+
+    printf("✓\n");
+}
+
 int main(void) {
     printf("═══════════════════════════════════════════════\n");
     printf("SRS-003 Linear Algebra Verification Suite\n");
@@ -308,6 +582,10 @@ int main(void) {
     test_overflow_protection();
     test_vector_dot_product();
     test_matrix_addition();
+    test_blocked_matches_reference();
+    test_vec_mul_matches_gemm();
+    test_packed_matches_reference();
+    test_large_dimensions();
 
     printf("\n═══════════════════════════════════════════════\n");
     printf("✅ SRS-003 Compliance Verified\n");
@@ -319,6 +597,9 @@ int main(void) {
     printf("  • SRS-003.4: Dimension validation ✓\n");
     printf("  • SRS-003.5: 64-bit accumulator protection ✓\n");
     printf("  • SRS-003.6: Bounded execution (no data-dependent branching) ✓\n");
+    printf("  • SRS-003.9: Blocked GEMM bit-identical to reference ✓\n");
+    printf("  • SRS-003.12: GEMV bit-identical to GEMM ✓\n");
+    printf("  • SRS-003.13: Pre-packed GEMM bit-identical to GEMM ✓\n");
     printf("\nCross-platform verification:\n");
     printf("  • V-003.1: Bit-perfect across 1000 runs ✓\n");
     printf("  • V-003.2: Address independence verified ✓\n");
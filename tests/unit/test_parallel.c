@@ -0,0 +1,172 @@
+/**
+ * @file test_parallel.c
+ * @project Certifiable Inference Engine
+ * @brief Verification suite for SRS-003.11 (Deterministic Parallel GEMM).
+ *
+ * @details Checks that fx_matrix_mul_parallel() is byte-identical to
+ * fx_matrix_mul() for several thread counts, over shapes that exercise both
+ * row-band and column-band partitioning, and that the pool runs every
+ * partition exactly once per job.
+ *
+ * @traceability SRS-003.11
+ * @compliance MISRA-C:2012, ISO 26262
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "parallel.h"
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#define MAX_DIM 71
+
+static fixed_t buf_a[MAX_DIM * MAX_DIM];
+static fixed_t buf_b[MAX_DIM * MAX_DIM];
+static fixed_t ref_c[MAX_DIM * MAX_DIM];
+static fixed_t out_c[MAX_DIM * MAX_DIM];
+
+static const uint32_t thread_counts[] = {1, 2, 3, 4, 7};
+
+#define THREAD_COUNT_LEN (sizeof(thread_counts) / sizeof(thread_counts[0]))
+
+static uint32_t rng_state = 31337u;
+
+static fixed_t rand_fixed(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return (fixed_t)((int32_t)rng_state >> 9);
+}
+
+static uint32_t part_hits[FX_POOL_MAX_THREADS];
+
+static void count_job(void* ctx, uint32_t part, uint32_t n_parts) {
+    (void)ctx;
+    assert(part < n_parts);
+    part_hits[part]++;
+}
+
+/**
+ * @test Pool runs each partition exactly once per job.
+ * @traceability SRS-003.11
+ */
+static void test_pool_partitions(void) {
+    printf("Testing pool runs every partition once... ");
+
+    for (size_t t = 0; t < THREAD_COUNT_LEN; t++) {
+        fx_pool_t pool;
+        const uint32_t n = thread_counts[t];
+
+        assert(fx_pool_init(&pool, n) == FX_POOL_OK);
+        memset(part_hits, 0, sizeof(part_hits));
+
+        for (int rep = 0; rep < 100; rep++) {
+            fx_pool_run(&pool, count_job, NULL);
+        }
+        for (uint32_t p = 0; p < n; p++) {
+            assert(part_hits[p] == 100u);
+        }
+
+        fx_pool_destroy(&pool);
+    }
+
+    printf("✓\n");
+}
+
+/**
+ * @test Parallel GEMM is byte-identical to fx_matrix_mul for any thread count.
+ * @traceability SRS-003.3, SRS-003.11
+ */
+static void test_parallel_matches_reference(void) {
+    printf("Testing parallel GEMM bit-identical to reference... ");
+
+    /* Includes N < threads (column bands) and P not a multiple of NR */
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {1, 64, 71}, {2, 9, 5}, {3, 17, 40},
+        {8, 8, 8}, {13, 33, 27}, {71, 71, 71}
+    };
+
+    for (size_t t = 0; t < THREAD_COUNT_LEN; t++) {
+        fx_pool_t pool;
+        assert(fx_pool_init(&pool, thread_counts[t]) == FX_POOL_OK);
+
+        for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+            const uint16_t n = shapes[s][0];
+            const uint16_t m = shapes[s][1];
+            const uint16_t p = shapes[s][2];
+            fx_matrix_t A, B, C;
+
+            fx_matrix_init(&A, buf_a, n, m);
+            fx_matrix_init(&B, buf_b, m, p);
+            for (size_t i = 0; i < (size_t)n * m; i++) {
+                A.data[i] = rand_fixed();
+            }
+            for (size_t i = 0; i < (size_t)m * p; i++) {
+                B.data[i] = rand_fixed();
+            }
+
+            fx_matrix_init(&C, ref_c, n, p);
+            fx_matrix_mul(&A, &B, &C);
+
+            fx_matrix_init(&C, out_c, n, p);
+            memset(out_c, 0x5A, sizeof(out_c));
+            fx_matrix_mul_parallel(&pool, &A, &B, &C);
+
+            assert(memcmp(ref_c, out_c, (size_t)n * p * sizeof(fixed_t)) == 0);
+        }
+
+        fx_pool_destroy(&pool);
+    }
+
+    printf("✓\n");
+}
+
+/**
+ * @test Invalid parameters fail safely.
+ * @traceability SRS-003.4, SRS-003.11
+ */
+static void test_invalid_params(void) {
+    printf("Testing parallel GEMM safe failure... ");
+
+    fx_pool_t pool;
+    assert(fx_pool_init(NULL, 2) == FX_POOL_INVALID_PARAM);
+    assert(fx_pool_init(&pool, 0) == FX_POOL_INVALID_PARAM);
+    assert(fx_pool_init(&pool, FX_POOL_MAX_THREADS + 1u) == FX_POOL_INVALID_PARAM);
+
+    assert(fx_pool_init(&pool, 2) == FX_POOL_OK);
+
+    fixed_t a_buf[6], b_buf[6], c_buf[4];
+    fx_matrix_t A, B, C;
+    fx_matrix_init(&A, a_buf, 2, 3);
+    fx_matrix_init(&B, b_buf, 2, 3);   /* Wrong: should be 3×2 */
+    fx_matrix_init(&C, c_buf, 2, 2);
+    for (int i = 0; i < 4; i++) {
+        C.data[i] = fixed_from_int(999);
+    }
+
+    fx_matrix_mul_parallel(&pool, &A, &B, &C);
+    for (int i = 0; i < 4; i++) {
+        assert(fixed_to_int(C.data[i]) == 999);
+    }
+
+    fx_pool_destroy(&pool);
+
+    printf("✓\n");
+}
+
+int main(void) {
+    printf("═══════════════════════════════════════════════\n");
+    printf("SRS-003.11 Parallel GEMM Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n\n");
+
+    test_pool_partitions();
+    test_parallel_matches_reference();
+    test_invalid_params();
+
+    printf("\n═══════════════════════════════════════════════\n");
+    printf("✅ SRS-003.11 Compliance Verified\n");
+    printf("═══════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -237,6 +237,43 @@ static void test_larger_dimensions(void) {
     TEST_ASSERT(out.data[48] == fixed_from_int(195), "Bottom-right corner correct");
 }
 
+static fixed_t big_in[512 * 256];
+static fixed_t big_out[256 * 128];
+
+/**
+ * @test Test input above 65,535 elements (512×256 → 256×128)
+ * @traceability SRS-008.6
+ */
+static void test_large_input(void) {
+    printf("\nTest: Large Input (512×256 → 256×128)\n");
+    printf("──────────────────────────────────────\n");
+
+    fx_matrix_t in, out;
+    fx_matrix_init(&in, big_in, 512, 256);
+    fx_matrix_init(&out, big_out, 256, 128);
+
+    /* value = row + col, so each window max is at [i+1][j+1] */
+    for (size_t i = 0; i < 512; i++) {
+        for (size_t j = 0; j < 256; j++) {
+            in.data[i * 256 + j] = fixed_from_int((int32_t)(i + j));
+        }
+    }
+
+    fx_maxpool_2x2(&in, &out);
+
+    int all_correct = 1;
+    for (size_t i = 0; i < 256; i++) {
+        for (size_t j = 0; j < 128; j++) {
+            if (out.data[i * 128 + j] != fixed_from_int((int32_t)(2 * i + 2 * j + 2))) {
+                all_correct = 0;
+            }
+        }
+    }
+
+    TEST_ASSERT(all_correct, "All 32,768 windows correct (no offset wrap)");
+    TEST_ASSERT(out.data[256 * 128 - 1] == fixed_from_int(766), "Bottom-right window correct");
+}
+
 /**
  * @test Test deterministic behavior (repeated operations)
  * @traceability SRS-008.7
@@ -324,6 +361,289 @@ static void test_range_preservation(void) {
     TEST_ASSERT(in_max == fixed_from_int(15), "Input max = 15");
 }
 
+/* Generic pooling fixtures: 37×41 random input */
+#define GP_H 37
+#define GP_W 41
+
+static fixed_t gp_in[GP_H * GP_W];
+static fixed_t gp_ref[GP_H * GP_W];
+static fixed_t gp_out[GP_H * GP_W];
+static fixed_t gp_scratch[GP_H * GP_W + 3 * 64];
+
+static uint32_t gp_rng = 777u;
+
+static fixed_t gp_rand(void) {
+    gp_rng = gp_rng * 1664525u + 1013904223u;
+    return (fixed_t)gp_rng;   /* Full Q16.16 range */
+}
+
+/**
+ * @brief Brute-force reference for one pooled output (max or average).
+ */
+static fixed_t gp_reference(const fx_pool_params_t* p, size_t y, size_t x, int average) {
+    int64_t sum = 0;
+    fixed_t max_val = FIXED_MIN;
+
+    for (size_t ky = 0; ky < p->pool_h; ky++) {
+        for (size_t kx = 0; kx < p->pool_w; kx++) {
+            const int64_t iy = (int64_t)(y * p->stride_h + ky) - (int64_t)p->pad_top;
+            const int64_t ix = (int64_t)(x * p->stride_w + kx) - (int64_t)p->pad_left;
+
+            if (iy >= 0 && iy < GP_H && ix >= 0 && ix < GP_W) {
+                const fixed_t v = gp_in[iy * GP_W + ix];
+                sum += v;
+                if (v > max_val) {
+                    max_val = v;
+                }
+            }
+        }
+    }
+
+    if (!average) {
+        return max_val;
+    }
+
+    /* Round half away from zero by plain division */
+    const int64_t area = (int64_t)p->pool_h * p->pool_w;
+    const int64_t mag = (sum < 0) ? -sum : sum;
+    const int64_t q = (2 * mag + area) / (2 * area);
+    return (fixed_t)((sum < 0) ? -q : q);
+}
+
+/**
+ * @brief Run fx_maxpool/fx_avgpool for p and compare against the reference.
+ */
+static int gp_matches(const fx_pool_params_t* p, int average) {
+    const uint32_t out_h = fx_pool_output_dim(GP_H, p->pool_h, p->stride_h,
+                                              p->pad_top, p->pad_bottom);
+    const uint32_t out_w = fx_pool_output_dim(GP_W, p->pool_w, p->stride_w,
+                                              p->pad_left, p->pad_right);
+    fx_matrix_t in, out;
+
+    fx_matrix_attach(&in, gp_in, GP_H, GP_W);
+    fx_matrix_init(&out, gp_out, out_h, out_w);
+
+    for (size_t y = 0; y < out_h; y++) {
+        for (size_t x = 0; x < out_w; x++) {
+            gp_ref[y * out_w + x] = gp_reference(p, y, x, average);
+        }
+    }
+
+    if (average) {
+        fx_avgpool(&in, p, &out);
+    } else {
+        fx_maxpool(&in, p, &out, gp_scratch, sizeof(gp_scratch) / sizeof(gp_scratch[0]));
+    }
+
+    return memcmp(gp_ref, gp_out, (size_t)out_h * out_w * sizeof(fixed_t)) == 0;
+}
+
+/* {pool_h, pool_w, stride_h, stride_w, pad_top, pad_bottom, pad_left, pad_right} */
+static const fx_pool_params_t gp_configs[] = {
+    {2, 2, 2, 2, 0, 0, 0, 0},    /* Classic 2×2/s2 */
+    {3, 3, 2, 2, 1, 1, 1, 1},    /* Overlapping 3×3/s2, padded */
+    {4, 4, 1, 1, 0, 0, 0, 0},    /* Power-of-two area, dense */
+    {7, 5, 1, 2, 3, 0, 2, 4},    /* vHGW vertically, asymmetric padding */
+    {9, 11, 3, 4, 4, 8, 0, 10},  /* vHGW both axes */
+    {37, 41, 1, 1, 0, 0, 0, 0}   /* Global window */
+};
+
+#define GP_CONFIG_LEN (sizeof(gp_configs) / sizeof(gp_configs[0]))
+
+/**
+ * @test Generic max pooling matches brute force for all window/stride/padding mixes
+ * @traceability SRS-008.9, SRS-008.10
+ */
+static void test_generic_maxpool(void) {
+    printf("\nTest: Generic Max Pooling (window, stride, padding)\n");
+    printf("───────────────────────────────────────────────────\n");
+
+    for (size_t i = 0; i < GP_H * GP_W; i++) {
+        gp_in[i] = gp_rand();
+    }
+
+    int all_match = 1;
+    for (size_t c = 0; c < GP_CONFIG_LEN; c++) {
+        if (!gp_matches(&gp_configs[c], 0)) {
+            all_match = 0;
+        }
+    }
+    TEST_ASSERT(all_match, "Direct and vHGW paths equal brute-force max");
+
+    /* 2×2/s2 agrees with the fixed-shape kernel */
+    fixed_t even_in[36 * 40];
+    fx_matrix_t in, ref, out;
+    const fx_pool_params_t p2 = FX_POOL_PARAMS_2X2;
+    fx_matrix_attach(&in, even_in, 36, 40);
+    for (size_t i = 0; i < 36 * 40; i++) {
+        even_in[i] = gp_in[i];
+    }
+    fx_matrix_init(&ref, gp_ref, 18, 20);
+    fx_matrix_init(&out, gp_out, 18, 20);
+    fx_maxpool_2x2(&in, &ref);
+    fx_maxpool(&in, &p2, &out, gp_scratch, sizeof(gp_scratch) / sizeof(gp_scratch[0]));
+    TEST_ASSERT(memcmp(gp_ref, gp_out, 18 * 20 * sizeof(fixed_t)) == 0,
+                "FX_POOL_PARAMS_2X2 equals fx_maxpool_2x2");
+}
+
+/**
+ * @test Average pooling: exact reciprocal division with round half away from zero
+ * @traceability SRS-008.8, SRS-008.9, SRS-008.10
+ */
+static void test_generic_avgpool(void) {
+    printf("\nTest: Generic Average Pooling (reciprocal divide)\n");
+    printf("─────────────────────────────────────────────────\n");
+
+    int all_match = 1;
+    for (size_t c = 0; c < GP_CONFIG_LEN; c++) {
+        if (!gp_matches(&gp_configs[c], 1)) {
+            all_match = 0;
+        }
+    }
+    TEST_ASSERT(all_match, "Shift and reciprocal paths equal exact rounded division");
+
+    /* Ties: ±1.5 LSB rounds away from zero, 2/3 LSB rounds to 1 */
+    fixed_t tie_in[6] = {1, 2, -1, -2, 1, 1};
+    fixed_t tie_out[3];
+    fx_matrix_t in, out;
+    const fx_pool_params_t pair = {1, 2, 1, 2, 0, 0, 0, 0};
+    fx_matrix_attach(&in, tie_in, 3, 2);
+    fx_matrix_init(&out, tie_out, 3, 1);
+    fx_avgpool(&in, &pair, &out);
+    TEST_ASSERT(tie_out[0] == 2 && tie_out[1] == -2 && tie_out[2] == 1,
+                "Half-LSB ties round away from zero");
+
+    const fx_pool_params_t triple = {1, 3, 1, 1, 0, 0, 0, 1};
+    fixed_t tri_in[2] = {1, 1};
+    fixed_t tri_out[1];
+    fx_matrix_attach(&in, tri_in, 1, 2);
+    fx_matrix_init(&out, tri_out, 1, 1);
+    fx_avgpool(&in, &triple, &out);
+    TEST_ASSERT(tri_out[0] == 1, "Padding counts as zero in the divisor (2/3 → 1)");
+
+    /* Extremes: mean of FIXED_MIN stays FIXED_MIN */
+    fixed_t ext_in[9];
+    fixed_t ext_out[1];
+    const fx_pool_params_t p3 = {3, 3, 1, 1, 0, 0, 0, 0};
+    for (int i = 0; i < 9; i++) {
+        ext_in[i] = FIXED_MIN;
+    }
+    fx_matrix_attach(&in, ext_in, 3, 3);
+    fx_matrix_init(&out, ext_out, 1, 1);
+    fx_avgpool(&in, &p3, &out);
+    TEST_ASSERT(ext_out[0] == FIXED_MIN, "Full-range input exact");
+}
+
+/**
+ * @test Invalid pooling parameters leave output unchanged
+ * @traceability SRS-008.3
+ */
+static void test_generic_invalid(void) {
+    printf("\nTest: Generic Pooling Validation\n");
+    printf("────────────────────────────────\n");
+
+    fx_matrix_t in, out;
+    const fx_pool_params_t pad_too_big = {3, 3, 1, 1, 3, 0, 0, 0};
+    const fx_pool_params_t p3 = {3, 3, 2, 2, 1, 1, 1, 1};
+    fx_matrix_attach(&in, gp_in, GP_H, GP_W);
+    fx_matrix_attach(&out, gp_out, 19, 21);
+
+    TEST_ASSERT(fx_pool_output_dim(10, 3, 1, 3, 0) == 0, "Pad >= window reported");
+    TEST_ASSERT(fx_maxpool_scratch_len(GP_H, GP_W, &pad_too_big) == 0,
+                "No scratch length for invalid params");
+
+    gp_out[0] = fixed_from_int(999);
+    fx_maxpool(&in, &pad_too_big, &out, gp_scratch, sizeof(gp_scratch) / sizeof(gp_scratch[0]));
+    fx_maxpool(&in, &p3, &out, gp_scratch, fx_maxpool_scratch_len(GP_H, GP_W, &p3) - 1u);
+    fx_avgpool(&in, &pad_too_big, &out);
+    fx_matrix_attach(&out, gp_out, 19, 20);
+    fx_avgpool(&in, &p3, &out);
+    TEST_ASSERT(gp_out[0] == fixed_from_int(999),
+                "Bad padding / scratch / output shape rejected");
+}
+
+static int64_t gp_sat[FX_INTEGRAL_LEN(GP_H, GP_W)];
+
+/**
+ * @test Integral-image box sums, box filter and GAP are exact
+ * @traceability SRS-008.12
+ */
+static void test_integral_image(void) {
+    printf("\nTest: Integral Image, Box Filter and Global Average Pool\n");
+    printf("────────────────────────────────────────────────────────\n");
+
+    fx_matrix_t in, ref, out;
+    fx_integral_t sat;
+    fx_matrix_attach(&in, gp_in, GP_H, GP_W);
+
+    fx_integral_build(&sat, gp_sat, sizeof(gp_sat) / sizeof(gp_sat[0]), &in);
+    TEST_ASSERT(sat.rows == GP_H && sat.cols == GP_W, "Table built");
+
+    /* Box sums against brute force over many rectangles */
+    int sums_exact = 1;
+    for (uint32_t y0 = 0; y0 <= GP_H; y0 += 5) {
+        for (uint32_t x0 = 0; x0 <= GP_W; x0 += 7) {
+            for (uint32_t y1 = y0; y1 <= GP_H; y1 += 6) {
+                for (uint32_t x1 = x0; x1 <= GP_W; x1 += 4) {
+                    int64_t sum = 0;
+                    for (uint32_t y = y0; y < y1; y++) {
+                        for (uint32_t x = x0; x < x1; x++) {
+                            sum += gp_in[y * GP_W + x];
+                        }
+                    }
+                    if (fx_integral_box_sum(&sat, y0, x0, y1, x1) != sum) {
+                        sums_exact = 0;
+                    }
+                }
+            }
+        }
+    }
+    TEST_ASSERT(sums_exact, "O(1) box sums equal brute force");
+
+    /* Box filter equals average pooling for every window/stride/padding */
+    int filter_match = 1;
+    for (size_t c = 0; c < GP_CONFIG_LEN; c++) {
+        const fx_pool_params_t* p = &gp_configs[c];
+        const uint32_t out_h = fx_pool_output_dim(GP_H, p->pool_h, p->stride_h,
+                                                  p->pad_top, p->pad_bottom);
+        const uint32_t out_w = fx_pool_output_dim(GP_W, p->pool_w, p->stride_w,
+                                                  p->pad_left, p->pad_right);
+
+        fx_matrix_init(&ref, gp_ref, out_h, out_w);
+        fx_matrix_init(&out, gp_out, out_h, out_w);
+        fx_avgpool(&in, p, &ref);
+        fx_box_filter(&sat, p, &out);
+        if (memcmp(gp_ref, gp_out, (size_t)out_h * out_w * sizeof(fixed_t)) != 0) {
+            filter_match = 0;
+        }
+    }
+    TEST_ASSERT(filter_match, "Box filter bit-identical to fx_avgpool");
+
+    /* GAP equals a global average-pool window */
+    const fx_pool_params_t global = {GP_H, GP_W, 1, 1, 0, 0, 0, 0};
+    fx_tensor_t t;
+    fixed_t gap[2];
+    fx_matrix_t gap_out;
+    fx_tensor_attach(&t, gp_in, 1, GP_H, GP_W, FX_LAYOUT_NCHW);
+    fx_matrix_init(&gap_out, gap, 1, 1);
+    fx_matrix_init(&ref, gp_ref, 1, 1);
+    fx_avgpool(&in, &global, &ref);
+    fx_global_avgpool(&t, &gap_out);
+    TEST_ASSERT(gap[0] == gp_ref[0], "GAP equals global fx_avgpool");
+
+    /* NHWC: channel 0 = 1..6 LSB (mean 3.5 → 4), channel 1 = −1..−6 (→ −4) */
+    fixed_t hwc[12] = {1, -1, 2, -2, 3, -3, 4, -4, 5, -5, 6, -6};
+    fx_tensor_attach(&t, hwc, 2, 2, 3, FX_LAYOUT_NHWC);
+    fx_matrix_init(&gap_out, gap, 1, 2);
+    fx_global_avgpool(&t, &gap_out);
+    TEST_ASSERT(gap[0] == 4 && gap[1] == -4, "NHWC per-channel means rounded away from zero");
+
+    /* Undersized table fails safely */
+    fx_integral_build(&sat, gp_sat, FX_INTEGRAL_LEN(GP_H, GP_W) - 1u, &in);
+    TEST_ASSERT(sat.rows == 0 && fx_integral_box_sum(&sat, 0, 0, 1, 1) == 0,
+                "Undersized table rejected");
+}
+
 int main(void) {
     printf("╔═══════════════════════════════════════════════╗\n");
     printf("║   SpeyTech Certifiable Inference Engine      ║\n");
@@ -336,8 +656,13 @@ int main(void) {
     test_negative_values();
     test_boundary_values();
     test_larger_dimensions();
+    test_large_input();
     test_deterministic_behavior();
     test_range_preservation();
+    test_generic_maxpool();
+    test_generic_avgpool();
+    test_generic_invalid();
+    test_integral_image();
 
     /* Print summary */
     printf("\n═══════════════════════════════════════════════\n");
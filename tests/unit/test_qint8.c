@@ -0,0 +1,369 @@
+/**
+ * @file test_qint8.c
+ * @project Certifiable Inference Engine
+ * @brief Verification suite for SRS-009.4-009.6 (int8 Inference).
+ *
+ * @details Checks the int8 dense and convolution layers against a direct
+ * integer reference that subtracts the input zero point per element, so the
+ * folded bias must reproduce it bit for bit; that both convolution layouts
+ * agree; that the int8 result stays within one output step of the real
+ * valued layer; that ReLU/ReLU6 fold into the clamp; and that quantize /
+ * dequantize round-trip.
+ *
+ * @traceability SRS-009-QUANTIZATION
+ * @compliance MISRA-C:2012, ISO 26262
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "qint8.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+#define MAX_DIM 64
+
+static int8_t buf_in[MAX_DIM * MAX_DIM];
+static int8_t buf_w[MAX_DIM * MAX_DIM];
+static int8_t buf_out[MAX_DIM * MAX_DIM];
+static int8_t buf_nhwc[MAX_DIM * MAX_DIM];
+static int32_t bias[MAX_DIM];
+static int32_t folded[MAX_DIM];
+static fx_requant_t rescale[MAX_DIM];
+static double w_scale[MAX_DIM];
+
+static uint32_t rng_state = 8128u;
+
+static uint32_t rand_u32(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state;
+}
+
+static int8_t rand_i8(void) {
+    return (int8_t)(rand_u32() >> 24);
+}
+
+/** @brief M · 2^-(31 + shift) ≈ real, M in [2^30, 2^31) (as tools/quantize.py) */
+static fx_requant_t quantize_multiplier(double real) {
+    int e;
+    const double m = frexp(real, &e);
+    int64_t q = llround(m * 2147483648.0);
+    fx_requant_t r;
+
+    if (q == ((int64_t)1 << 31)) {
+        q /= 2;
+        e++;
+    }
+    r.multiplier = (int32_t)q;
+    r.shift = -e;
+    return r;
+}
+
+/** @brief Direct reference: Σ (x - z_x) · w + b, rescaled, offset, clamped */
+static int8_t reference_output(int64_t acc, const fx_q8_params_t* p, size_t j) {
+    const fx_requant_t* r = p->channel ? &p->channel[j] : &p->tensor;
+    const uint32_t s = (uint32_t)(31 + r->shift);
+    int64_t y = ((acc * r->multiplier + ((int64_t)1 << (s - 1u))) >> s) + p->out_zero_point;
+
+    if (y < p->act_min) {
+        y = p->act_min;
+    }
+    if (y > p->act_max) {
+        y = p->act_max;
+    }
+    return (int8_t)y;
+}
+
+/**
+ * @test int8 GEMM equals the unfolded integer reference and the real layer within one step.
+ * @traceability SRS-009.4, SRS-009.5
+ */
+static void test_q8_matrix_mul(void) {
+    printf("Testing int8 GEMM against integer and real references... ");
+
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {1, 64, 33}, {3, 7, 8}, {5, 40, 17}
+    };
+    const double s_x = 0.05;
+    const double s_y = 0.4;
+    const int32_t z_x = -7;
+    const int32_t z_y = 11;
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        const uint16_t n = shapes[s][0];
+        const uint16_t k = shapes[s][1];
+        const uint16_t p = shapes[s][2];
+        fx_q8_matrix_t in = {buf_in, n, k};
+        fx_q8_matrix_t w = {buf_w, p, k};
+        fx_q8_matrix_t out = {buf_out, n, p};
+
+        for (size_t i = 0; i < (size_t)n * k; i++) {
+            buf_in[i] = rand_i8();
+        }
+        for (size_t i = 0; i < (size_t)p * k; i++) {
+            buf_w[i] = (int8_t)(rand_i8() | 1);     /* symmetric range [-127, 127] */
+        }
+        for (size_t j = 0; j < p; j++) {
+            w_scale[j] = 0.002 * (double)(1u + j % 5u);
+            bias[j] = (int32_t)(rand_u32() % 20001u) - 10000;
+            rescale[j] = quantize_multiplier(s_x * w_scale[j] / s_y);
+        }
+
+        for (int per_channel = 0; per_channel < 2; per_channel++) {
+            fx_q8_params_t params = {folded, per_channel ? rescale : NULL,
+                                     rescale[0], z_y, INT8_MIN, INT8_MAX};
+
+            fx_q8_fold_bias(&w, z_x, bias, folded);
+            fx_q8_matrix_mul(&in, &w, &params, &out);
+
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < p; j++) {
+                    const double sw = per_channel ? w_scale[j] : w_scale[0];
+                    int64_t acc = bias[j];
+                    double real = s_x * sw * bias[j];
+
+                    for (size_t kk = 0; kk < k; kk++) {
+                        const int32_t xv = buf_in[i * k + kk] - z_x;
+                        acc += (int64_t)xv * buf_w[j * k + kk];
+                        real += (s_x * xv) * (sw * buf_w[j * k + kk]);
+                    }
+
+                    const int8_t got = buf_out[i * p + j];
+                    assert(got == reference_output(acc, &params, j));
+
+                    double expect = real / s_y + z_y;
+                    expect = expect < -128.0 ? -128.0 : (expect > 127.0 ? 127.0 : expect);
+                    assert(fabs((double)got - expect) <= 0.5 + 1e-6);
+                }
+            }
+        }
+    }
+
+    printf("✓\n");
+}
+
+/**
+ * @test int8 convolution equals the unfolded reference in both layouts.
+ * @traceability SRS-009.4, SRS-009.5
+ */
+static void test_q8_conv2d(void) {
+    printf("Testing int8 convolution in NCHW and NHWC... ");
+
+    enum { C_IN = 3, C_OUT = 5, H = 8, W = 9, KH = 3, KW = 2 };
+    enum { OH = H - KH + 1, OW = W - KW + 1, TAPS = C_IN * KH * KW };
+    static int8_t w_nhwc[C_OUT * TAPS];
+    static int8_t out_nhwc[C_OUT * OH * OW];
+    const int32_t z_x = 5;
+
+    fx_q8_tensor_t in = {buf_in, C_IN, H, W, FX_LAYOUT_NCHW};
+    fx_q8_tensor_t in2 = {buf_nhwc, C_IN, H, W, FX_LAYOUT_NHWC};
+    fx_q8_tensor_t out = {buf_out, C_OUT, OH, OW, FX_LAYOUT_NCHW};
+    fx_q8_tensor_t out2 = {out_nhwc, C_OUT, OH, OW, FX_LAYOUT_NHWC};
+    fx_q8_matrix_t filt = {buf_w, C_OUT, TAPS};
+    fx_q8_matrix_t filt2 = {w_nhwc, C_OUT, TAPS};
+
+    for (size_t c = 0; c < C_IN; c++) {
+        for (size_t y = 0; y < H; y++) {
+            for (size_t x = 0; x < W; x++) {
+                const int8_t v = rand_i8();
+                buf_in[fx_q8_tensor_index(&in, c, y, x)] = v;
+                buf_nhwc[fx_q8_tensor_index(&in2, c, y, x)] = v;
+            }
+        }
+    }
+    for (size_t o = 0; o < C_OUT; o++) {
+        for (size_t c = 0; c < C_IN; c++) {
+            for (size_t t = 0; t < KH * KW; t++) {
+                const int8_t v = rand_i8();
+                buf_w[o * TAPS + c * KH * KW + t] = v;                 /* OIHW */
+                w_nhwc[o * TAPS + t * C_IN + c] = v;                   /* OHWI */
+            }
+        }
+        bias[o] = (int32_t)(rand_u32() % 4001u) - 2000;
+        rescale[o] = quantize_multiplier(0.0005 * (double)(o + 1u));
+    }
+
+    fx_q8_params_t params = {folded, rescale, rescale[0], -3, INT8_MIN, INT8_MAX};
+    fx_q8_fold_bias(&filt, z_x, bias, folded);
+    fx_q8_conv2d(&in, &filt, KH, KW, &params, &out);
+    fx_q8_fold_bias(&filt2, z_x, bias, folded);
+    fx_q8_conv2d(&in2, &filt2, KH, KW, &params, &out2);
+
+    for (size_t o = 0; o < C_OUT; o++) {
+        for (size_t y = 0; y < OH; y++) {
+            for (size_t x = 0; x < OW; x++) {
+                int64_t acc = bias[o];
+
+                for (size_t c = 0; c < C_IN; c++) {
+                    for (size_t ky = 0; ky < KH; ky++) {
+                        for (size_t kx = 0; kx < KW; kx++) {
+                            acc += (int64_t)(buf_in[fx_q8_tensor_index(&in, c, y + ky, x + kx)] - z_x) *
+                                   buf_w[o * TAPS + (c * KH + ky) * KW + kx];
+                        }
+                    }
+                }
+
+                const int8_t expect = reference_output(acc, &params, o);
+                assert(buf_out[fx_q8_tensor_index(&out, o, y, x)] == expect);
+                assert(out_nhwc[fx_q8_tensor_index(&out2, o, y, x)] == expect);
+            }
+        }
+    }
+
+    printf("✓\n");
+}
+
+/**
+ * @test ReLU and ReLU6 fold into the output clamp.
+ * @traceability SRS-009.4
+ */
+static void test_fold_activation(void) {
+    printf("Testing ReLU/ReLU6 folded into the requant clamp... ");
+
+    enum { K = 16, P = 32 };
+    const int32_t z_y = -20;
+    const int32_t six = 60;                     /* s_y = 0.1 */
+    fx_q8_matrix_t in = {buf_in, 1, K};
+    fx_q8_matrix_t w = {buf_w, P, K};
+    fx_q8_matrix_t out = {buf_out, 1, P};
+    static int8_t plain[P];
+    fx_q8_params_t params = {NULL, NULL, quantize_multiplier(0.02), z_y, 0, 0};
+
+    for (size_t i = 0; i < K; i++) {
+        buf_in[i] = rand_i8();
+    }
+    for (size_t i = 0; i < (size_t)P * K; i++) {
+        buf_w[i] = rand_i8();
+    }
+
+    fx_q8_fold_activation(&params, FX_ACT_IDENTITY, 0);
+    assert(params.act_min == INT8_MIN && params.act_max == INT8_MAX);
+    fx_q8_matrix_mul(&in, &w, &params, &out);
+    memcpy(plain, buf_out, P);
+
+    fx_q8_fold_activation(&params, FX_ACT_RELU, 0);
+    assert(params.act_min == z_y && params.act_max == INT8_MAX);
+    fx_q8_matrix_mul(&in, &w, &params, &out);
+    for (size_t j = 0; j < P; j++) {
+        assert(buf_out[j] == (plain[j] < z_y ? z_y : plain[j]));
+    }
+
+    fx_q8_fold_activation(&params, FX_ACT_RELU6, six);
+    assert(params.act_min == z_y && params.act_max == z_y + six);
+    fx_q8_matrix_mul(&in, &w, &params, &out);
+    for (size_t j = 0; j < P; j++) {
+        const int32_t e = plain[j] < z_y ? z_y : (plain[j] > z_y + six ? z_y + six : plain[j]);
+        assert(buf_out[j] == e);
+    }
+
+    /* Sigmoid is not a clamp: params unchanged */
+    fx_q8_fold_activation(&params, FX_ACT_SIGMOID, 0);
+    assert(params.act_min == z_y && params.act_max == z_y + six);
+
+    printf("✓\n");
+}
+
+/**
+ * @test Q16.16 → int8 → Q16.16 round-trips within half a step.
+ * @traceability SRS-009.6
+ */
+static void test_quantize_roundtrip(void) {
+    printf("Testing quantize/dequantize round trip... ");
+
+    enum { N = 200 };
+    const double s = 0.03125 * 1.3;
+    const int32_t z = 9;
+    const fx_requant_t to_q8 = quantize_multiplier(1.0 / (s * 65536.0));
+    const fx_requant_t to_fixed = quantize_multiplier(s * 65536.0);
+    static fixed_t x[N];
+    static fixed_t back[N];
+    static int8_t q[N];
+
+    for (size_t i = 0; i < N; i++) {
+        x[i] = (fixed_t)((int32_t)rand_u32() >> 10);       /* ±32.0 */
+    }
+
+    fx_q8_quantize(x, N, &to_q8, z, q);
+    fx_q8_dequantize(q, N, &to_fixed, z, back);
+
+    for (size_t i = 0; i < N; i++) {
+        const double real = x[i] / 65536.0;
+        double expect = floor(real / s + 0.5) + z;
+        expect = expect < -128.0 ? -128.0 : (expect > 127.0 ? 127.0 : expect);
+        assert(fabs((double)q[i] - expect) <= 1.0);
+        assert(fabs(back[i] / 65536.0 - (q[i] - z) * s) <= 1.0 / 65536.0);
+        if (q[i] > INT8_MIN && q[i] < INT8_MAX) {
+            assert(fabs(back[i] / 65536.0 - real) <= 0.5 * s + 2.0 / 65536.0);
+        }
+    }
+
+    printf("✓\n");
+}
+
+/**
+ * @test Invalid shapes or params leave the output unchanged.
+ * @traceability SRS-003.4, SRS-009.4
+ */
+static void test_invalid_inputs(void) {
+    printf("Testing int8 layer validation... ");
+
+    fx_q8_matrix_t in = {buf_in, 2, 6};
+    fx_q8_matrix_t w = {buf_w, 4, 6};
+    fx_q8_matrix_t out = {buf_out, 2, 4};
+    fx_requant_t bad[4] = {{1 << 30, 0}, {1 << 30, 0}, {1 << 30, 0}, {0, 0}};
+    fx_q8_params_t params = {NULL, NULL, {1 << 30, FX_Q8_SHIFT_MAX + 1}, 0, INT8_MIN, INT8_MAX};
+
+    memset(buf_out, 99, 8);
+
+    /* Shift out of range */
+    fx_q8_matrix_mul(&in, &w, &params, &out);
+    assert(buf_out[0] == 99);
+
+    /* One per-channel multiplier not positive */
+    params.channel = bad;
+    fx_q8_matrix_mul(&in, &w, &params, &out);
+    assert(buf_out[0] == 99);
+
+    /* Clamp outside int8 */
+    params.channel = NULL;
+    params.tensor.shift = 0;
+    params.act_min = -129;
+    fx_q8_matrix_mul(&in, &w, &params, &out);
+    assert(buf_out[0] == 99);
+
+    /* Inner dimension mismatch */
+    params.act_min = INT8_MIN;
+    w.cols = 5;
+    fx_q8_matrix_mul(&in, &w, &params, &out);
+    assert(buf_out[0] == 99);
+
+    /* Convolution: filter taps do not match C_in × KH × KW */
+    fx_q8_tensor_t tin = {buf_in, 2, 5, 5, FX_LAYOUT_NCHW};
+    fx_q8_tensor_t tout = {buf_out, 4, 3, 3, FX_LAYOUT_NCHW};
+    w.cols = 17;
+    fx_q8_conv2d(&tin, &w, 3, 3, &params, &tout);
+    assert(buf_out[0] == 99);
+
+    printf("✓\n");
+}
+
+int main(void) {
+    printf("═══════════════════════════════════════════════\n");
+    printf("SRS-009 int8 Inference Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n\n");
+
+    test_q8_matrix_mul();
+    test_q8_conv2d();
+    test_fold_activation();
+    test_quantize_roundtrip();
+    test_invalid_inputs();
+
+    printf("\n═══════════════════════════════════════════════\n");
+    printf("✅ SRS-009.4-009.6 Compliance Verified\n");
+    printf("═══════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,398 @@
+/**
+ * @file test_qweights.c
+ * @project Certifiable Inference Engine
+ * @brief Verification suite for SRS-009.1-009.3, 009.7 (Mixed-Precision Weights).
+ *
+ * @details Checks that int8/int16 dense and convolution layers are
+ * bit-identical to the fixed_t layers run with the expanded weights
+ * q << (16 - f), per tensor and per output channel, that fraction bits
+ * above 16 round exactly once, that the bound-selected int32_t accumulation
+ * gives the same bits as the int64_t path, and that invalid inputs leave
+ * the output untouched.
+ *
+ * @traceability SRS-009-QUANTIZATION
+ * @compliance MISRA-C:2012, ISO 26262
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "qweights.h"
+#include "dense.h"
+#include "convolution.h"
+#include "cpu_dispatch.h"
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#define MAX_DIM 41
+
+static int8_t q8[MAX_DIM * MAX_DIM];
+static int16_t q16[MAX_DIM * MAX_DIM];
+static uint8_t fracs[MAX_DIM];
+static fixed_t buf_in[MAX_DIM * MAX_DIM];
+static fixed_t buf_w[MAX_DIM * MAX_DIM];
+static fixed_t buf_b[MAX_DIM];
+static fixed_t buf_ref[MAX_DIM * MAX_DIM];
+static fixed_t buf_out[MAX_DIM * MAX_DIM];
+
+static uint32_t rng_state = 2718u;
+
+static uint32_t rand_u32(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return rng_state;
+}
+
+static fixed_t rand_fixed(void) {
+    /* ±64.0 range */
+    return (fixed_t)((int32_t)rand_u32() >> 9);
+}
+
+/**
+ * @brief Fill q8/q16 with random weights and fracs with per-channel
+ * exponents in [1, max_frac] (f >= 1 keeps int16 << (16 - f) inside int32)
+ */
+static void fill_weights(size_t n, size_t channels, uint32_t max_frac) {
+    for (size_t i = 0; i < n; i++) {
+        q8[i] = (int8_t)(rand_u32() >> 24);
+        q16[i] = (int16_t)(rand_u32() >> 16);
+    }
+    for (size_t o = 0; o < channels; o++) {
+        fracs[o] = (uint8_t)(1u + rand_u32() % max_frac);
+    }
+}
+
+/** @brief Weight (row, k) of qw widened to Q16.16 (requires f <= 16) */
+static fixed_t expand(const fx_qweights_t* qw, size_t row, size_t k) {
+    const size_t idx = row * qw->cols + k;
+    const int32_t q = (qw->type == FX_QW_INT8) ? ((const int8_t*)qw->data)[idx]
+                                               : ((const int16_t*)qw->data)[idx];
+    return (fixed_t)(q * (1 << (16u - fx_qweights_frac(qw, row))));
+}
+
+/**
+ * @brief Quantized dense vs fx_dense_forward() on expanded, transposed weights.
+ */
+static void check_dense(uint16_t n, uint16_t k, uint16_t p, fx_qw_type_t type,
+                        int per_channel, const fx_activation_t* act) {
+    fx_matrix_t in, w, b, ref, out;
+    const fx_qweights_t qw = {(type == FX_QW_INT8) ? (const void*)q8 : (const void*)q16,
+                              type, p, k, per_channel ? fracs : NULL, 12, 0};
+
+    fx_matrix_init(&in, buf_in, n, k);
+    fx_matrix_init(&w, buf_w, k, p);
+    fx_matrix_init(&b, buf_b, 1, p);
+    fx_matrix_init(&ref, buf_ref, n, p);
+    fx_matrix_init(&out, buf_out, n, p);
+
+    fill_weights((size_t)p * k, p, 16);
+    for (size_t i = 0; i < (size_t)n * k; i++) {
+        in.data[i] = rand_fixed();
+    }
+    for (size_t j = 0; j < p; j++) {
+        b.data[j] = rand_fixed();
+        for (size_t kk = 0; kk < k; kk++) {
+            w.data[kk * p + j] = expand(&qw, j, kk);
+        }
+    }
+
+    fx_dense_forward(&in, &w, &b, act, &ref);
+    fx_qdense_forward(&in, &qw, &b, act, &out);
+
+    assert(memcmp(ref.data, out.data, (size_t)n * p * sizeof(fixed_t)) == 0);
+}
+
+/**
+ * @test Quantized dense matches the fixed_t layer, int8 and int16, per tensor and per channel.
+ * @traceability SRS-009.1, SRS-009.2
+ */
+static void test_qdense_matches_fixed(void) {
+    printf("Testing int8/int16 dense matches expanded fixed_t weights... ");
+
+    static const uint16_t shapes[][3] = {
+        {1, 1, 1}, {1, 41, 33}, {3, 7, 8}, {4, 16, 17}, {13, 41, 21}
+    };
+    const fx_activation_t relu = {FX_ACT_RELU, 0, 0, 0};
+    const fx_activation_t tanh_act = {FX_ACT_TANH, 0, 0, 0};
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        const uint16_t n = shapes[s][0];
+        const uint16_t k = shapes[s][1];
+        const uint16_t p = shapes[s][2];
+
+        check_dense(n, k, p, FX_QW_INT8, 0, NULL);
+        check_dense(n, k, p, FX_QW_INT8, 1, &relu);
+        check_dense(n, k, p, FX_QW_INT16, 0, &tanh_act);
+        check_dense(n, k, p, FX_QW_INT16, 1, NULL);
+    }
+
+    printf("✓\n");
+}
+
+/**
+ * @test Fraction bits above 16 round once from the exact sum.
+ * @traceability SRS-009.2
+ */
+static void test_qdense_fine_scale(void) {
+    printf("Testing fraction bits above 16... ");
+
+    const uint16_t k = 37;
+    const uint16_t p = 9;
+    fx_matrix_t in, b, out;
+    const fx_qweights_t qw = {q16, FX_QW_INT16, p, k, fracs, 0, 0};
+
+    fx_matrix_init(&in, buf_in, 1, k);
+    fx_matrix_init(&b, buf_b, 1, p);
+    fx_matrix_init(&out, buf_out, 1, p);
+
+    fill_weights((size_t)p * k, p, FX_QW_MAX_FRAC);
+    fracs[0] = FX_QW_MAX_FRAC;
+    fracs[1] = 0;
+    for (size_t i = 0; i < k; i++) {
+        in.data[i] = rand_fixed();
+    }
+    for (size_t j = 0; j < p; j++) {
+        b.data[j] = rand_fixed();
+    }
+
+    fx_qdense_forward(&in, &qw, &b, NULL, &out);
+
+    for (size_t j = 0; j < p; j++) {
+        const uint32_t f = fracs[j];
+        int64_t acc = (int64_t)b.data[j] * ((int64_t)1 << f);
+
+        for (size_t kk = 0; kk < k; kk++) {
+            acc += (int64_t)in.data[kk] * q16[j * k + kk];
+        }
+
+        const int64_t expect = (f == 0u) ? acc : (acc + ((int64_t)1 << (f - 1u))) >> f;
+        assert(out.data[j] == (fixed_t)expect);
+    }
+
+    printf("✓\n");
+}
+
+/**
+ * @test Quantized convolution matches fx_conv2d_tensor() in both layouts.
+ * @traceability SRS-009.1, SRS-009.3
+ */
+static void test_qconv_matches_fixed(void) {
+    printf("Testing int8/int16 convolution matches expanded fixed_t filter... ");
+
+    enum { C_IN = 3, C_OUT = 4, H = 9, W = 11, KH = 3, KW = 2 };
+    enum { OH = H - KH + 1, OW = W - KW + 1, TAPS = C_IN * KH * KW };
+    static const fx_layout_t layouts[] = {FX_LAYOUT_NCHW, FX_LAYOUT_NHWC};
+    static const fx_qw_type_t types[] = {FX_QW_INT8, FX_QW_INT16};
+
+    for (size_t l = 0; l < 2; l++) {
+        for (size_t t = 0; t < 2; t++) {
+            const fx_layout_t layout = layouts[l];
+            const fx_qweights_t qw = {(types[t] == FX_QW_INT8) ? (const void*)q8 : (const void*)q16,
+                                      types[t], C_OUT, TAPS, fracs, 0, 0};
+            fx_tensor_t in, ref, out;
+            fx_conv_filter_t filter = {buf_w, C_OUT, C_IN, KH, KW, layout};
+            fx_matrix_t b;
+
+            fx_tensor_init(&in, buf_in, C_IN, H, W, layout);
+            fx_tensor_init(&ref, buf_ref, C_OUT, OH, OW, layout);
+            fx_tensor_init(&out, buf_out, C_OUT, OH, OW, layout);
+            fx_matrix_init(&b, buf_b, 1, C_OUT);
+
+            fill_weights((size_t)C_OUT * TAPS, C_OUT, 16);
+            for (size_t i = 0; i < (size_t)C_IN * H * W; i++) {
+                in.data[i] = rand_fixed();
+            }
+            for (size_t o = 0; o < C_OUT; o++) {
+                b.data[o] = rand_fixed();
+                /* Filter row order is the layout's own OIHW / OHWI order */
+                for (size_t tap = 0; tap < TAPS; tap++) {
+                    buf_w[o * TAPS + tap] = expand(&qw, o, tap);
+                }
+            }
+
+            fx_conv2d_tensor(&in, &filter, &b, &ref);
+            fx_qconv2d_tensor(&in, &qw, KH, KW, &b, &out);
+
+            assert(memcmp(ref.data, out.data, sizeof(fixed_t) * C_OUT * OH * OW) == 0);
+        }
+    }
+
+    printf("✓\n");
+}
+
+/** @brief Largest row L1 norm Σ|q| of qw, as tools/quantize.py exports it */
+static uint32_t row_l1_max(const fx_qweights_t* qw) {
+    uint32_t best = 0;
+
+    for (size_t j = 0; j < qw->rows; j++) {
+        uint32_t l1 = 0;
+        for (size_t k = 0; k < qw->cols; k++) {
+            const size_t idx = j * qw->cols + k;
+            const int32_t q = (qw->type == FX_QW_INT8) ? ((const int8_t*)qw->data)[idx]
+                                                       : ((const int16_t*)qw->data)[idx];
+            l1 += (uint32_t)(q < 0 ? -q : q);
+        }
+        best = (l1 > best) ? l1 : best;
+    }
+
+    return best;
+}
+
+/** @brief int32_t vs int64_t accumulation on the active kernel set */
+static void check_int32_accumulation(void) {
+    enum { N = 3, K = 41, P = 29, C_IN = 2, C_OUT = 3, H = 7, W = 8, KH = 3, KW = 3 };
+    enum { OH = H - KH + 1, OW = W - KW + 1, TAPS = C_IN * KH * KW };
+    static const fx_qw_type_t types[] = {FX_QW_INT8, FX_QW_INT16};
+    static fixed_t wide[MAX_DIM * MAX_DIM];
+
+    for (size_t t = 0; t < 2; t++) {
+        fx_qweights_t qw = {(types[t] == FX_QW_INT8) ? (const void*)q8 : (const void*)q16,
+                            types[t], P, K, fracs, 0, 0};
+        fx_matrix_t in, out;
+
+        fx_matrix_init(&in, buf_in, N, K);
+        fx_matrix_init(&out, buf_out, N, P);
+        fill_weights((size_t)P * K, P, 16);
+
+        const uint32_t l1 = row_l1_max(&qw);
+        /* Largest |x| for which the bound still proves int32_t safe */
+        const int32_t x_max = (int32_t)(INT32_MAX / l1);
+
+        for (size_t i = 0; i < (size_t)N * K; i++) {
+            in.data[i] = (fixed_t)((int64_t)x_max * ((int32_t)(rand_u32() % 2001u) - 1000) / 1000);
+        }
+        in.data[K] = -x_max;
+
+        for (int row_big = 0; row_big < 2; row_big++) {
+            /* Second pass: one row one step past the bound, int64_t fallback */
+            in.data[2 * K + 5] = row_big ? x_max + 1 : 0;
+
+            qw.l1_max = 0;
+            fx_qdense_forward(&in, &qw, NULL, NULL, &out);
+            memcpy(wide, out.data, sizeof(fixed_t) * N * P);
+
+            qw.l1_max = l1;
+            fx_qdense_forward(&in, &qw, NULL, NULL, &out);
+            assert(memcmp(wide, out.data, sizeof(fixed_t) * N * P) == 0);
+        }
+
+        /* Convolution: bound over the whole input tensor */
+        fx_tensor_t tin, tout;
+        qw.rows = C_OUT;
+        qw.cols = TAPS;
+        qw.l1_max = 0;
+        const int32_t c_max = (int32_t)(INT32_MAX / row_l1_max(&qw));
+        fx_tensor_init(&tin, buf_in, C_IN, H, W, FX_LAYOUT_NHWC);
+        fx_tensor_init(&tout, buf_out, C_OUT, OH, OW, FX_LAYOUT_NHWC);
+        for (size_t i = 0; i < (size_t)C_IN * H * W; i++) {
+            tin.data[i] = (fixed_t)((int64_t)c_max * ((int32_t)(rand_u32() % 2001u) - 1000) / 1000);
+        }
+
+        fx_qconv2d_tensor(&tin, &qw, KH, KW, NULL, &tout);
+        memcpy(wide, tout.data, sizeof(fixed_t) * C_OUT * OH * OW);
+        qw.l1_max = row_l1_max(&qw);
+        fx_qconv2d_tensor(&tin, &qw, KH, KW, NULL, &tout);
+        assert(memcmp(wide, tout.data, sizeof(fixed_t) * C_OUT * OH * OW) == 0);
+    }
+}
+
+/**
+ * @test int32_t accumulation, selected by the L1 bound, matches the int64_t path.
+ * @traceability SRS-009.7
+ */
+static void test_int32_accumulation(void) {
+    printf("Testing bound-selected int32 accumulation...\n");
+
+    static const fx_isa_t levels[] = {FX_ISA_SCALAR, FX_ISA_SSE41, FX_ISA_AVX2};
+
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        if (fx_dispatch_force(levels[l]) != levels[l]) {
+            printf("  - %s not available on this CPU, skipped\n", fx_isa_name(levels[l]));
+            continue;
+        }
+
+        check_int32_accumulation();
+        printf("  ✓ %s\n", fx_isa_name(levels[l]));
+    }
+
+    fx_dispatch_force(FX_ISA_AVX2);
+}
+
+static fixed_t deep_in[FX_QW_MAX_DEPTH + 1u];
+static int16_t deep_q[FX_QW_MAX_DEPTH + 1u];
+
+/**
+ * @test Invalid weights or shapes leave the output unchanged.
+ * @traceability SRS-003.4, SRS-009.1
+ */
+static void test_invalid_inputs(void) {
+    printf("Testing quantized layer validation... ");
+
+    fx_matrix_t in, out;
+    fx_qweights_t qw = {q8, FX_QW_INT8, 4, 6, NULL, FX_QW_MAX_FRAC + 1u, 0};
+
+    fx_matrix_init(&in, buf_in, 2, 6);
+    fx_matrix_init(&out, buf_out, 2, 4);
+    for (int i = 0; i < 8; i++) {
+        out.data[i] = fixed_from_int(999);
+    }
+
+    /* Fraction bits out of range */
+    fx_qdense_forward(&in, &qw, NULL, NULL, &out);
+    assert(fixed_to_int(out.data[0]) == 999);
+
+    /* Per-channel entry out of range */
+    memset(fracs, 0, sizeof(fracs));
+    fracs[3] = FX_QW_MAX_FRAC + 1u;
+    qw.frac_bits = fracs;
+    fx_qdense_forward(&in, &qw, NULL, NULL, &out);
+    assert(fixed_to_int(out.data[0]) == 999);
+
+    /* Inner dimension mismatch */
+    fracs[3] = 0;
+    qw.cols = 5;
+    fx_qdense_forward(&in, &qw, NULL, NULL, &out);
+    assert(fixed_to_int(out.data[0]) == 999);
+
+    /* Convolution: filter taps do not match C_in × KH × KW */
+    fx_tensor_t tin, tout;
+    fx_tensor_init(&tin, buf_in, 2, 5, 5, FX_LAYOUT_NCHW);
+    fx_tensor_attach(&tout, buf_out, 4, 3, 3, FX_LAYOUT_NCHW);
+    qw.cols = 17;
+    fx_qconv2d_tensor(&tin, &qw, 3, 3, NULL, &tout);
+    assert(fixed_to_int(tout.data[0]) == 999);
+
+    /* Reductions longer than FX_QW_MAX_DEPTH, otherwise well-formed */
+    const uint32_t deep = FX_QW_MAX_DEPTH + 1u;
+    const fx_qweights_t qdeep = {deep_q, FX_QW_INT16, 1, deep, NULL, 0, 0};
+    fx_matrix_attach(&in, deep_in, 1, deep);
+    fx_matrix_attach(&out, buf_out, 1, 1);
+    fx_qdense_forward(&in, &qdeep, NULL, NULL, &out);
+    assert(fixed_to_int(out.data[0]) == 999);
+
+    fx_tensor_attach(&tin, deep_in, deep, 1, 1, FX_LAYOUT_NHWC);
+    fx_tensor_attach(&tout, buf_out, 1, 1, 1, FX_LAYOUT_NHWC);
+    fx_qconv2d_tensor(&tin, &qdeep, 1, 1, NULL, &tout);
+    assert(fixed_to_int(tout.data[0]) == 999);
+
+    printf("✓\n");
+}
+
+int main(void) {
+    printf("═══════════════════════════════════════════════\n");
+    printf("SRS-009 Mixed-Precision Weights Verification Suite\n");
+    printf("═══════════════════════════════════════════════\n\n");
+
+    test_qdense_matches_fixed();
+    test_qdense_fine_scale();
+    test_qconv_matches_fixed();
+    test_int32_accumulation();
+    test_invalid_inputs();
+
+    printf("\n═══════════════════════════════════════════════\n");
+    printf("✅ SRS-009.1-009.3, 009.7 Compliance Verified\n");
+    printf("═══════════════════════════════════════════════\n");
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file test_streaming.c
+ * @project Certifiable Inference Engine
+ * @brief Unit tests for row-at-a-time convolution and max pooling.
+ *
+ * @details Feeds frames one row at a time through a streaming
+ * convolution chained into a streaming 2×2 max-pool and checks that every
+ * emitted row matches the whole-frame fx_conv2d() + fx_maxpool_2x2()
+ * pipeline byte-for-byte, with rows emitted at the earliest possible push.
+ *
+ * @traceability SRS-006.17, SRS-008.11
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ */
+
+#include "streaming.h"
+#include "convolution.h"
+#include "pooling.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Test counter */
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+/* Test result macro */
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✓ %s\n", message); \
+            tests_passed++; \
+        } else { \
+            printf("  ✗ FAILED: %s\n", message); \
+            tests_failed++; \
+        } \
+    } while(0)
+
+/* Frame 34×40, kernel 5×3 → conv 30×38 → pool 15×19 */
+#define ST_H  34
+#define ST_W  40
+#define ST_KH 5
+#define ST_KW 3
+#define ST_CH (ST_H - ST_KH + 1)
+#define ST_CW (ST_W - ST_KW + 1)
+
+static fixed_t st_frame[ST_H * ST_W];
+static fixed_t st_kernel[ST_KH * ST_KW];
+static fixed_t st_conv_ref[ST_CH * ST_CW];
+static fixed_t st_pool_ref[(ST_CH / 2) * (ST_CW / 2)];
+static fixed_t st_pool_out[(ST_CH / 2) * (ST_CW / 2)];
+static fixed_t st_ring[FX_STREAM_CONV_RING_LEN(ST_KH, ST_W)];
+static fixed_t st_pending[FX_STREAM_POOL_ROW_LEN(ST_CW)];
+
+static uint32_t rng_state = 4242u;
+
+static fixed_t st_rand(void) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return (fixed_t)((int32_t)rng_state >> 10);
+}
+
+/**
+ * @brief Run one frame through conv → pool; returns 1 if all rows match
+ * the reference and were emitted on the expected pushes.
+ */
+static int stream_frame(fx_stream_conv_t* conv, fx_stream_pool_t* pool) {
+    fixed_t conv_row[ST_CW];
+    uint32_t conv_rows = 0;
+    uint32_t pool_rows = 0;
+    int ok = 1;
+
+    memset(st_pool_out, 0, sizeof(st_pool_out));
+
+    for (uint32_t r = 0; r < ST_H; r++) {
+        if (fx_stream_conv_push(conv, &st_frame[r * ST_W], conv_row)) {
+            /* Output row y is ready exactly when input row y + KH − 1 arrives */
+            if (r != conv_rows + ST_KH - 1u ||
+                memcmp(conv_row, &st_conv_ref[conv_rows * ST_CW], sizeof(conv_row)) != 0) {
+                ok = 0;
+            }
+            conv_rows++;
+
+            if (fx_stream_pool_push(pool, conv_row, &st_pool_out[pool_rows * (ST_CW / 2)])) {
+                pool_rows++;
+            }
+        }
+    }
+
+    if (conv_rows != ST_CH || pool_rows != ST_CH / 2 ||
+        memcmp(st_pool_out, st_pool_ref, sizeof(st_pool_ref)) != 0) {
+        ok = 0;
+    }
+    return ok;
+}
+
+/**
+ * @test Streaming conv → max-pool matches the whole-frame pipeline
+ * @traceability SRS-006.17, SRS-008.11
+ */
+static void test_stream_matches_frame(void) {
+    printf("\nTest: Streaming Conv → MaxPool vs Whole Frame\n");
+    printf("─────────────────────────────────────────────\n");
+
+    fx_matrix_t frame, kernel, conv_ref, pool_ref;
+    fx_matrix_attach(&frame, st_frame, ST_H, ST_W);
+    fx_matrix_attach(&kernel, st_kernel, ST_KH, ST_KW);
+    fx_matrix_init(&conv_ref, st_conv_ref, ST_CH, ST_CW);
+    fx_matrix_init(&pool_ref, st_pool_ref, ST_CH / 2, ST_CW / 2);
+
+    for (size_t i = 0; i < ST_H * ST_W; i++) {
+        st_frame[i] = st_rand();
+    }
+    for (size_t i = 0; i < ST_KH * ST_KW; i++) {
+        st_kernel[i] = st_rand();
+    }
+    fx_conv2d(&frame, &kernel, &conv_ref);
+    fx_maxpool_2x2(&conv_ref, &pool_ref);
+
+    fx_stream_conv_t conv;
+    fx_stream_pool_t pool;
+    fx_stream_conv_init(&conv, &kernel, ST_W, st_ring, sizeof(st_ring) / sizeof(st_ring[0]));
+    fx_stream_pool_init(&pool, ST_CW, st_pending, sizeof(st_pending) / sizeof(st_pending[0]));
+    TEST_ASSERT(conv.kernel != NULL && pool.in_w == ST_CW, "Stages initialized");
+
+    TEST_ASSERT(stream_frame(&conv, &pool),
+                "Rows emitted at earliest push, bit-identical to fx_conv2d + fx_maxpool_2x2");
+
+    /* Next frame reuses the same ring after a reset */
+    fx_stream_conv_reset(&conv);
+    fx_stream_pool_reset(&pool);
+    TEST_ASSERT(stream_frame(&conv, &pool), "Second frame after reset identical");
+}
+
+/**
+ * @test Invalid configuration fails safely
+ * @traceability SRS-006.1, SRS-006.17, SRS-008.11
+ */
+static void test_stream_invalid(void) {
+    printf("\nTest: Streaming Invalid Configuration\n");
+    printf("─────────────────────────────────────\n");
+
+    fx_matrix_t kernel;
+    fx_stream_conv_t conv;
+    fx_stream_pool_t pool;
+    fixed_t row[ST_W] = {0};
+    fixed_t out_row[ST_W];
+
+    fx_matrix_attach(&kernel, st_kernel, ST_KH, ST_KW);
+
+    fx_stream_conv_init(&conv, &kernel, ST_W, st_ring, FX_STREAM_CONV_RING_LEN(ST_KH, ST_W) - 1u);
+    TEST_ASSERT(conv.kernel == NULL, "Undersized ring rejected");
+
+    fx_stream_conv_init(&conv, &kernel, ST_KW - 1u, st_ring, sizeof(st_ring) / sizeof(st_ring[0]));
+    TEST_ASSERT(conv.kernel == NULL, "Kernel wider than row rejected");
+
+    out_row[0] = fixed_from_int(999);
+    int emitted = 0;
+    for (int r = 0; r < ST_KH; r++) {
+        emitted |= fx_stream_conv_push(&conv, row, out_row);
+    }
+    TEST_ASSERT(!emitted && out_row[0] == fixed_from_int(999), "Failed stream never emits");
+
+    fx_stream_pool_init(&pool, 7, st_pending, sizeof(st_pending) / sizeof(st_pending[0]));
+    TEST_ASSERT(pool.in_w == 0, "Odd pool width rejected");
+}
+
+int main(void) {
+    printf("╔═══════════════════════════════════════════════╗\n");
+    printf("║   SpeyTech Certifiable Inference Engine      ║\n");
+    printf("║   Streaming Test Suite                       ║\n");
+    printf("╚═══════════════════════════════════════════════╝\n");
+
+    /* Run all tests */
+    test_stream_matches_frame();
+    test_stream_invalid();
+
+    /* Print summary */
+    printf("\n═══════════════════════════════════════════════\n");
+    printf("Test Results Summary\n");
+    printf("═══════════════════════════════════════════════\n");
+    printf("Tests passed: %d\n", tests_passed);
+    printf("Tests failed: %d\n", tests_failed);
+
+    if (tests_failed == 0) {
+        printf("\n✅ All tests passed! Streaming implementation verified.\n");
+        return 0;
+    } else {
+        printf("\n❌ Some tests failed. Review implementation.\n");
+        return 1;
+    }
+}
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""
+SpeyTech Activation Table Generator
+Generate the Q.30 lookup tables behind fixed_sigmoid/fixed_tanh/fixed_exp
+and the log-sum-exp of fx_log_softmax
+
+Usage:
+    python gen_lut.py [output.c]
+
+The tables are computed with the decimal module at 50 significant digits,
+so the emitted integers do not depend on the host libm. The output is
+committed as src/core/fixed_lut_tables.c; re-run this script only when the
+table geometry in src/core/fixed_lut.h changes.
+
+Author: William Murray
+Copyright (c) 2026 The Murray Family Innovation Trust
+License: GPL-3.0 or Commercial
+"""
+
+import sys
+from decimal import Decimal, getcontext, ROUND_HALF_UP
+from pathlib import Path
+
+getcontext().prec = 50
+
+# Must match FX_LUT_* in src/core/fixed_lut.h
+TABLE_BITS = 10                  # 2^10 segments, 2^10 + 1 entries
+VALUE_SHIFT = 30                 # Entries are Q.30
+SIGMOID_RANGE = 16               # sigmoid(x) tabulated on [0, 16)
+TANH_RANGE = 8                   # tanh(x) tabulated on [0, 8)
+
+ONE = Decimal(1)
+
+
+def to_q30(value: Decimal) -> int:
+    """
+    Round a non-negative value to Q.30, ties away from zero.
+
+    Args:
+        value: Exact value to quantize
+
+    Returns:
+        round(value * 2^30) as an integer
+    """
+    scaled = value * (1 << VALUE_SHIFT)
+    return int(scaled.quantize(ONE, rounding=ROUND_HALF_UP))
+
+
+def sigmoid(x: Decimal) -> Decimal:
+    return ONE / (ONE + (-x).exp())
+
+
+def tanh(x: Decimal) -> Decimal:
+    e = (2 * x).exp()
+    return (e - ONE) / (e + ONE)
+
+
+def exp2(x: Decimal) -> Decimal:
+    return (x * Decimal(2).ln()).exp()
+
+
+def log2_1p(x: Decimal) -> Decimal:
+    return (ONE + x).ln() / Decimal(2).ln()
+
+
+def build_table(fn, span: int) -> list[int]:
+    """
+    Sample fn at the 2^TABLE_BITS + 1 breakpoints of [0, span].
+
+    Args:
+        fn: Function to tabulate
+        span: Upper end of the domain
+
+    Returns:
+        List of Q.30 integers
+    """
+    segments = 1 << TABLE_BITS
+    return [to_q30(fn(Decimal(span) * i / segments)) for i in range(segments + 1)]
+
+
+def format_c_array(values: list[int], indent: str = "    ", values_per_line: int = 6) -> str:
+    """
+    Format table entries as C array initialization.
+
+    Args:
+        values: List of integers
+        indent: Indentation string
+        values_per_line: Number of values per line
+
+    Returns:
+        Formatted C array string
+    """
+    lines = []
+    for i in range(0, len(values), values_per_line):
+        chunk = values[i:i + values_per_line]
+        line = indent + ", ".join(f"{v:10d}u" for v in chunk)
+        if i + values_per_line < len(values):
+            line += ","
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def emit(path: Path) -> None:
+    tables = [
+        ("fx_lut_sigmoid", f"sigmoid(x), x = {SIGMOID_RANGE} * i / 1024",
+         build_table(sigmoid, SIGMOID_RANGE)),
+        ("fx_lut_tanh", f"tanh(x), x = {TANH_RANGE} * i / 1024",
+         build_table(tanh, TANH_RANGE)),
+        ("fx_lut_exp2", "2^x, x = i / 1024",
+         build_table(exp2, 1)),
+        ("fx_lut_log2", "log2(1 + x), x = i / 1024",
+         build_table(log2_1p, 1)),
+    ]
+
+    out = []
+    out.append("/**")
+    out.append(" * @file fixed_lut_tables.c")
+    out.append(" * @project Certifiable Inference Engine")
+    out.append(" * @brief Generated Q.30 tables for sigmoid, tanh, exp and log.")
+    out.append(" *")
+    out.append(" * @details GENERATED by tools/gen_lut.py - do not edit by hand. Each entry")
+    out.append(" * is round(f(x) * 2^30) computed in 50-digit decimal arithmetic.")
+    out.append(" *")
+    out.append(" * @traceability SRS-004.6, SRS-004.11")
+    out.append(" * @compliance MISRA-C:2012, ISO 26262, IEC 62304")
+    out.append(" *")
+    out.append(" * @author William Murray")
+    out.append(" * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.")
+    out.append(" * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.")
+    out.append(" *          For commercial licensing: william@fstopify.com")
+    out.append(" */")
+    out.append("")
+    out.append('#include "fixed_lut.h"')
+
+    for name, desc, values in tables:
+        out.append("")
+        out.append(f"/* {desc} */")
+        out.append(f"const uint32_t {name}[FX_LUT_LEN] = {{")
+        out.append(format_c_array(values))
+        out.append("};")
+
+    path.write_text("\n".join(out) + "\n")
+    print(f"Wrote {path} ({len(tables)} tables x {len(tables[0][2])} entries)")
+
+
+def main() -> int:
+    default = Path(__file__).resolve().parent.parent / "src" / "core" / "fixed_lut_tables.c"
+    path = Path(sys.argv[1]) if len(sys.argv) > 1 else default
+    emit(path)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
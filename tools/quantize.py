@@ -1,10 +1,12 @@
 #!/usr/bin/env python3
 """
 SpeyTech Model Quantizer
-Convert PyTorch model weights to Q16.16 fixed-point C headers
+Convert PyTorch model weights to Q16.16 fixed-point C headers, or to
+int8/int16 weights with power-of-two scales (include/qweights.h)
 
 Usage:
     python quantize.py model.pth layer_name output_dir
+    python quantize.py weights.npy layer_name output_dir --int8 --per-channel
 
 Author: William Murray
 Copyright (c) 2026 The Murray Family Innovation Trust
@@ -12,6 +14,7 @@ License: GPL-3.0 or Commercial
 """
 
 import sys
+import math
 import argparse
 from pathlib import Path
 from typing import Optional
@@ -190,6 +193,258 @@ def export_to_c_header(
 
     return stats
 
+# Must match FX_QW_MAX_FRAC in include/qweights.h
+QW_MAX_FRAC = 24
+
+# Largest int32_t accumulator value (fx_qweights_t int32 path)
+INT32_MAX = (1 << 31) - 1
+
+# Largest value of the uint32_t fx_qweights_t.l1_max field
+UINT32_MAX = (1 << 32) - 1
+
+
+def choose_frac_bits(max_abs: float, qmax: int) -> int:
+    """
+    Pick the finest power-of-two scale that still fits the largest weight.
+
+    Args:
+        max_abs: Largest |w| covered by the scale
+        qmax: Largest storable magnitude (127 or 32767)
+
+    Returns:
+        Fraction bits f in [0, QW_MAX_FRAC] with round(max_abs * 2^f) <= qmax
+        (0 if even f = 0 overflows; values are then clamped)
+    """
+    for f in range(QW_MAX_FRAC, -1, -1):
+        if round(max_abs * (1 << f)) <= qmax:
+            return f
+    return 0
+
+
+def quantize_multiplier(real: float) -> tuple[int, int]:
+    """
+    Express a positive real rescale as an fx_requant_t (qint8.h).
+
+    Args:
+        real: Rescale factor, e.g. s_x * s_w / s_y for an int8 layer
+
+    Returns:
+        (multiplier, shift) with multiplier in [2^30, 2^31) and
+        real ~= multiplier * 2^-(31 + shift)
+
+    Raises:
+        ValueError: If real is not positive or shift falls outside [-30, 31]
+    """
+    if real <= 0.0:
+        raise ValueError(f"rescale must be positive, got {real}")
+
+    mantissa, exponent = math.frexp(real)
+    multiplier = round(mantissa * (1 << 31))
+    if multiplier == (1 << 31):
+        multiplier //= 2
+        exponent += 1
+
+    shift = -exponent
+    if not -30 <= shift <= 31:
+        raise ValueError(f"rescale {real} out of range")
+    return multiplier, shift
+
+
+def export_l1_max(values: list[int], rows: int, cols: int, name: str) -> int:
+    """
+    Largest row L1 norm max_j sum_k |q_jk|, as stored in fx_qweights_t.l1_max.
+
+    The field is uint32_t. A larger norm (int16 weights with long rows) would
+    be truncated by the C compiler and could wrongly prove the int32 path
+    safe, so it is exported as 0 (unknown), which keeps int64_t sums.
+
+    Args:
+        values: Quantized weights, row-major rows x cols
+        rows: Output channels
+        cols: Inputs per output channel
+        name: Name for warnings
+
+    Returns:
+        l1_max, or 0 if it exceeds UINT32_MAX
+    """
+    l1_max = max(sum(abs(q) for q in values[o * cols:(o + 1) * cols]) for o in range(rows))
+    if l1_max > UINT32_MAX:
+        print(f"Warning: {name}: row L1 norm {l1_max} exceeds uint32_t, "
+              f"exporting L1_MAX = 0 (int64 accumulation only)")
+        return 0
+    return l1_max
+
+
+def quantize_narrow(weights: np.ndarray, bits: int, per_channel: bool,
+                    name: str) -> tuple[list[int], list[int], float]:
+    """
+    Quantize weights to int8/int16 with per-tensor or per-output-channel scale.
+
+    Rows are output channels: axis 0 of the array (PyTorch nn.Linear
+    (out, in) and nn.Conv2d OIHW layout); the remaining axes are flattened.
+
+    Args:
+        weights: Weight array, output channels on axis 0
+        bits: 8 or 16
+        per_channel: One scale per output channel instead of one per tensor
+        name: Name for error reporting
+
+    Returns:
+        Tuple of (quantized_values, frac_bits per scale, max_abs_error)
+    """
+    qmax = (1 << (bits - 1)) - 1
+    rows = weights.reshape(weights.shape[0], -1).astype(np.float64)
+
+    if per_channel:
+        fracs = [choose_frac_bits(float(np.max(np.abs(r))), qmax) for r in rows]
+    else:
+        fracs = [choose_frac_bits(float(np.max(np.abs(rows))), qmax)]
+
+    values = []
+    max_err = 0.0
+    clamped = 0
+    for o, row in enumerate(rows):
+        f = fracs[o] if per_channel else fracs[0]
+        for w in row:
+            q = int(round(w * (1 << f)))
+            if q > qmax or q < -qmax - 1:
+                clamped += 1
+                q = max(-qmax - 1, min(qmax, q))
+            max_err = max(max_err, abs(q / (1 << f) - w))
+            values.append(q)
+
+    if clamped:
+        print(f"Warning: {name}: {clamped} weight(s) exceed int{bits} at 2^0 scale, clamped")
+
+    return values, fracs, max_err
+
+
+def export_quantized_header(
+    layer_name: str,
+    weights: np.ndarray,
+    bias: Optional[np.ndarray],
+    output_path: Path,
+    bits: int,
+    per_channel: bool,
+    act_range: Optional[float] = None
+) -> dict:
+    """
+    Generate C header with int8/int16 weights as an fx_qweights_t.
+
+    The header also carries the largest row L1 norm l1_max = max_j sum_k |q_jk|
+    (0 if it does not fit uint32_t). Every partial sum of a dot product is
+    bounded by max|x| * l1_max; the runtime measures max|x| on each input and
+    accumulates in int32_t whenever that bound fits. A calibrated activation
+    range only adds a report of the expected bound to the header comment.
+
+    Args:
+        layer_name: Name for the layer (used in variable names)
+        weights: Weight array, output channels on axis 0
+        bias: Bias vector as numpy array (optional, stays Q16.16)
+        output_path: Path to output .h file
+        bits: 8 or 16
+        per_channel: One scale per output channel
+        act_range: Calibrated max |activation| of the layer input (optional)
+
+    Returns:
+        Dictionary with quantization statistics
+    """
+    ctype = f"int{bits}_t"
+    rows = weights.shape[0]
+    cols = int(weights.size // rows)
+
+    print(f"Quantizing weights to int{bits}: {weights.shape}"
+          f" ({'per-channel' if per_channel else 'per-tensor'} scale)")
+    values, fracs, max_err = quantize_narrow(weights, bits, per_channel,
+                                             f"{layer_name}_weights")
+    l1_max = export_l1_max(values, rows, cols, f"{layer_name}_weights")
+
+    # Worst case |sum a*w| in raw units: Q16.16 activations times integer weights
+    acc_bound = None
+    if act_range is not None and l1_max > 0:
+        acc_bound = l1_max * int(math.ceil(abs(act_range) * 65536.0))
+
+    stats = {
+        'layer_name': layer_name,
+        'weights_shape': weights.shape,
+        'weights_count': weights.size,
+        'weights_out_of_range': 0,
+        'bias_count': 0,
+        'bias_out_of_range': 0,
+        'max_abs_error': max_err,
+        'l1_max': l1_max,
+        'acc_bound': acc_bound
+    }
+
+    bias_fixed = None
+    if bias is not None:
+        print(f"Quantizing bias: {bias.shape}")
+        bias_fixed, b_oor, b_total = quantize_array(bias, f"{layer_name}_bias")
+        stats['bias_count'] = b_total
+        stats['bias_out_of_range'] = b_oor
+
+    guard = f"{layer_name.upper()}_QWEIGHTS_H"
+    with open(output_path, 'w') as f:
+        f.write(f"/**\n")
+        f.write(f" * @file {output_path.name}\n")
+        f.write(f" * @brief int{bits} weights for {layer_name} layer\n")
+        f.write(f" * \n")
+        f.write(f" * Automatically generated by SpeyTech Quantizer\n")
+        f.write(f" * DO NOT EDIT MANUALLY\n")
+        f.write(f" * \n")
+        f.write(f" * Original shapes:\n")
+        f.write(f" *   Weights: {weights.shape} (output channels first)\n")
+        if bias is not None:
+            f.write(f" *   Bias: {bias.shape}\n")
+        f.write(f" * \n")
+        f.write(f" * Quantization: int{bits}, w = q * 2^-f, "
+                f"{'per output channel' if per_channel else 'per tensor'}\n")
+        f.write(f" * Max |w - q * 2^-f|: {max_err:.3e}\n")
+        if acc_bound is not None:
+            mode = "int32" if acc_bound <= INT32_MAX else "int64"
+            f.write(f" * Accumulator bound at |x| <= {act_range}: {acc_bound} ({mode})\n")
+        f.write(f" */\n\n")
+
+        f.write(f"#ifndef {guard}\n")
+        f.write(f"#define {guard}\n\n")
+        f.write(f'#include "qweights.h"\n\n')
+
+        f.write(f"/* Layer dimensions */\n")
+        f.write(f"#define {layer_name.upper()}_OUTPUT_DIM {rows}\n")
+        f.write(f"#define {layer_name.upper()}_INPUT_DIM  {cols}\n\n")
+
+        f.write(f"/* Largest row L1 norm (0 = unknown); int32 accumulation while the\n"
+                f" * measured max|x| * L1_MAX <= INT32_MAX */\n")
+        f.write(f"#define {layer_name.upper()}_L1_MAX {l1_max}u\n\n")
+
+        f.write(f"/* Weights: {rows} x {cols} = {weights.size} elements */\n")
+        f.write(f"static const {ctype} {layer_name}_qdata[{weights.size}] = {{\n")
+        f.write(format_c_array(values))
+        f.write(f"\n}};\n\n")
+
+        if per_channel:
+            f.write(f"/* Fraction bits per output channel */\n")
+            f.write(f"static const uint8_t {layer_name}_frac_bits[{rows}] = {{\n")
+            f.write(format_c_array(fracs))
+            f.write(f"\n}};\n\n")
+
+        frac_ptr = f"{layer_name}_frac_bits" if per_channel else "NULL"
+        frac_one = 0 if per_channel else fracs[0]
+        f.write(f"static const fx_qweights_t {layer_name}_qweights = {{\n")
+        f.write(f"    {layer_name}_qdata, FX_QW_INT{bits}, {rows}, {cols}, {frac_ptr}, {frac_one},\n")
+        f.write(f"    {layer_name.upper()}_L1_MAX\n")
+        f.write(f"}};\n\n")
+
+        if bias_fixed is not None:
+            f.write(f"/* Bias: {bias.shape} = {bias.size} elements */\n")
+            f.write(f"static const fixed_t {layer_name}_bias[{bias.size}] = {{\n")
+            f.write(format_c_array(bias_fixed))
+            f.write(f"\n}};\n\n")
+
+        f.write(f"#endif /* {guard} */\n")
+
+    return stats
+
 def main():
     parser = argparse.ArgumentParser(
         description='SpeyTech Model Quantizer - Convert PyTorch weights to Q16.16 C headers',
@@ -202,6 +457,12 @@ Examples:
   # Quantize from PyTorch checkpoint
   python quantize.py --torch model.pth layer1 output/
 
+  # int8 weights, one scale per output channel (for fx_qdense_forward)
+  python quantize.py weights.npy layer1 output/ --int8 --per-channel
+
+  # ... and check int32 accumulation against calibrated inputs |x| <= 4.0
+  python quantize.py weights.npy layer1 output/ --int8 --act-range 4.0
+
 For commercial licensing and support: william@fstopify.com
         """
     )
@@ -212,6 +473,14 @@ For commercial licensing and support: william@fstopify.com
     parser.add_argument('--bias', type=str, help='Path to bias file (optional)')
     parser.add_argument('--torch', action='store_true', help='Input is PyTorch checkpoint')
     parser.add_argument('--no-dims', action='store_true', help='Skip dimension constants')
+    narrow = parser.add_mutually_exclusive_group()
+    narrow.add_argument('--int8', action='store_true', help='Export int8 weights (fx_qweights_t)')
+    narrow.add_argument('--int16', action='store_true', help='Export int16 weights (fx_qweights_t)')
+    parser.add_argument('--per-channel', action='store_true',
+                        help='With --int8/--int16: one scale per output channel (axis 0)')
+    parser.add_argument('--act-range', type=float, metavar='A',
+                        help='With --int8/--int16: calibrated max |input activation|, '
+                             'reports the expected accumulator bound (selection is at run time)')
 
     args = parser.parse_args()
 
@@ -251,23 +520,41 @@ For commercial licensing and support: william@fstopify.com
     output_dir = Path(args.output_dir)
     output_dir.mkdir(parents=True, exist_ok=True)
 
-    output_path = output_dir / f"{args.layer_name}_weights.h"
+    narrow_bits = 8 if args.int8 else (16 if args.int16 else 0)
+    suffix = "qweights" if narrow_bits else "weights"
+    output_path = output_dir / f"{args.layer_name}_{suffix}.h"
 
     print(f"\nSpeyTech Model Quantizer")
     print(f"{'='*50}")
 
     try:
-        stats = export_to_c_header(
-            args.layer_name,
-            weights,
-            bias,
-            output_path,
-            add_dimensions=not args.no_dims
-        )
+        if narrow_bits:
+            stats = export_quantized_header(
+                args.layer_name,
+                weights,
+                bias,
+                output_path,
+                narrow_bits,
+                args.per_channel,
+                args.act_range
+            )
+        else:
+            stats = export_to_c_header(
+                args.layer_name,
+                weights,
+                bias,
+                output_path,
+                add_dimensions=not args.no_dims
+            )
 
         print(f"\n✅ Quantization complete!")
         print(f"   Output: {output_path}")
         print(f"   Weights: {stats['weights_count']} values")
+        if 'max_abs_error' in stats:
+            print(f"   Max weight error: {stats['max_abs_error']:.3e}")
+        if stats.get('acc_bound') is not None:
+            mode = "int32 for calibrated inputs" if stats['acc_bound'] <= INT32_MAX else "int64"
+            print(f"   Accumulator bound: {stats['acc_bound']} -> {mode}")
         if stats['weights_out_of_range'] > 0:
             print(f"   ⚠️  {stats['weights_out_of_range']} weight(s) clamped to Q16.16 range")
         if stats['bias_count'] > 0: